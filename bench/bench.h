@@ -0,0 +1,198 @@
+/*
+ * C Header File
+ *
+ * Author: daddinuz
+ * email:  daddinuz@gmail.com
+ * Date:   October 19, 2026
+ */
+
+#ifndef LOGGER_BENCH_INCLUDED
+#define LOGGER_BENCH_INCLUDED
+
+/*
+ * A tiny harness shared by the benchmarks.
+ *
+ * Usage: bench_<name> [max-producers] [records-per-producer]
+ *
+ * Every benchmark runs with 1, 2, 4 ... up to max-producers threads (default: the number of online CPUs)
+ * and with several message sizes. Bench_T.setup builds a single state, e.g. one logger and its handler, that
+ * all the producers share, so their contention on it is part of the measure. Handlers that do not lock their
+ * own state set Bench_T.serialize: the harness then holds a mutex around each call, as an application sharing
+ * them among threads would have to.
+ * Calls are timed in batches of BENCH_BATCH_SIZE, so that reading the clock does not dominate cheap calls:
+ * throughput counts records and message bytes, latency is the mean duration of a call within a batch.
+ * The report is written to stderr, so the console benchmark can be run with stdout redirected.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <unistd.h>
+#include <pthread.h>
+#include "logger_clock.h"
+
+#define BENCH_DEFAULT_RECORDS 100000
+#define BENCH_BATCH_SIZE 64
+
+typedef struct Bench_Run_T {
+    char *message;
+    size_t messageSize;
+    char path[256];
+} Bench_Run_T;
+
+typedef struct Bench_T {
+    const char *name;
+    bool serialize;
+    void *(*setup)(const Bench_Run_T *run);
+    void (*produce)(void *state, const char *message);
+    void (*teardown)(void *state, const Bench_Run_T *run);
+} Bench_T;
+
+typedef struct Bench_Producer_T {
+    size_t records;
+    const Bench_Run_T *run;
+    void *state;
+    uint64_t *latencies;
+    uint64_t start;
+    uint64_t end;
+    pthread_mutex_t *mutex;
+    pthread_barrier_t *barrier;
+    const Bench_T *bench;
+} Bench_Producer_T;
+
+static const size_t BENCH_MESSAGE_SIZES[] = {16, 128, 1024};
+
+static void Bench_die(const char *what) {
+    fprintf(stderr, "bench: %s\n", what);
+    exit(EXIT_FAILURE);
+}
+
+static int Bench_compare(const void *a, const void *b) {
+    const uint64_t x = *(const uint64_t *) a, y = *(const uint64_t *) b;
+    return x < y ? -1 : x > y;
+}
+
+static uint64_t Bench_percentile(const uint64_t *sorted, size_t size, double percentile) {
+    size_t index = (size_t) (percentile / 100.0 * (double) size);
+    return sorted[index < size ? index : size - 1];
+}
+
+static size_t Bench_batches(size_t records) {
+    return (records + BENCH_BATCH_SIZE - 1) / BENCH_BATCH_SIZE;
+}
+
+static void *Bench_producerMain(void *arg) {
+    Bench_Producer_T *producer = arg;
+    const Bench_T *bench = producer->bench;
+    pthread_barrier_wait(producer->barrier);
+    producer->start = Logger_Clock_getMonotonicTime();
+    for (size_t i = 0, batch = 0; i < producer->records; batch++) {
+        const size_t size = producer->records - i < BENCH_BATCH_SIZE ? producer->records - i : BENCH_BATCH_SIZE;
+        const uint64_t start = Logger_Clock_getMonotonicTime();
+        for (size_t j = 0; j < size; j++) {
+            if (producer->mutex) {
+                pthread_mutex_lock(producer->mutex);
+            }
+            bench->produce(producer->state, producer->run->message);
+            if (producer->mutex) {
+                pthread_mutex_unlock(producer->mutex);
+            }
+        }
+        producer->latencies[batch] = (Logger_Clock_getMonotonicTime() - start) / size;
+        i += size;
+    }
+    producer->end = Logger_Clock_getMonotonicTime();
+    return NULL;
+}
+
+static void Bench_runOnce(const Bench_T *bench, size_t producersCount, size_t records, size_t messageSize) {
+    const size_t batches = Bench_batches(records);
+    Bench_Producer_T *producers = calloc(producersCount, sizeof(*producers));
+    pthread_t *threads = calloc(producersCount, sizeof(*threads));
+    uint64_t *latencies = calloc(producersCount * batches, sizeof(*latencies));
+    Bench_Run_T run = {.message=malloc(messageSize + 1), .messageSize=messageSize};
+    pthread_mutex_t mutex = PTHREAD_MUTEX_INITIALIZER;
+    pthread_barrier_t barrier;
+    if (!producers || !threads || !latencies || !run.message ||
+        0 != pthread_barrier_init(&barrier, NULL, (unsigned) producersCount)) {
+        Bench_die("out of memory");
+    }
+
+    for (size_t j = 0; j < messageSize; j++) {
+        run.message[j] = (char) ('a' + j % 26);
+    }
+    run.message[messageSize] = '\0';
+    snprintf(run.path, sizeof(run.path), "%s.log", bench->name);
+    void *state = bench->setup(&run);
+    if (!state) {
+        Bench_die("unable to set up the benchmark");
+    }
+
+    for (size_t i = 0; i < producersCount; i++) {
+        Bench_Producer_T *producer = &producers[i];
+        producer->records = records;
+        producer->run = &run;
+        producer->state = state;
+        producer->latencies = latencies + i * batches;
+        producer->mutex = bench->serialize ? &mutex : NULL;
+        producer->barrier = &barrier;
+        producer->bench = bench;
+    }
+    for (size_t i = 0; i < producersCount; i++) {
+        if (0 != pthread_create(&threads[i], NULL, Bench_producerMain, &producers[i])) {
+            Bench_die("unable to start the producer");
+        }
+    }
+
+    uint64_t start = UINT64_MAX, end = 0;
+    for (size_t i = 0; i < producersCount; i++) {
+        pthread_join(threads[i], NULL);
+        start = producers[i].start < start ? producers[i].start : start;
+        end = producers[i].end > end ? producers[i].end : end;
+    }
+    bench->teardown(state, &run);
+
+    const size_t total = producersCount * records;
+    const size_t totalBatches = producersCount * batches;
+    const double seconds = (double) (end - start) / 1e9;
+    qsort(latencies, totalBatches, sizeof(*latencies), Bench_compare);
+    fprintf(stderr, "%-22s %9zu %7zu %14.0f %10.2f %8llu %8llu %8llu %10llu\n",
+            bench->name, producersCount, messageSize, (double) total / seconds,
+            (double) (total * messageSize) / seconds / (1024.0 * 1024.0),
+            (unsigned long long) Bench_percentile(latencies, totalBatches, 50.0),
+            (unsigned long long) Bench_percentile(latencies, totalBatches, 99.0),
+            (unsigned long long) Bench_percentile(latencies, totalBatches, 99.9),
+            (unsigned long long) latencies[totalBatches - 1]);
+
+    pthread_barrier_destroy(&barrier);
+    pthread_mutex_destroy(&mutex);
+    free(run.message);
+    free(latencies);
+    free(threads);
+    free(producers);
+}
+
+static int Bench_main(int argc, char *argv[], const Bench_T *bench) {
+    const long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    const size_t maxProducers = argc > 1 ? strtoul(argv[1], NULL, 10) : (cpus > 0 ? (size_t) cpus : 1);
+    const size_t records = argc > 2 ? strtoul(argv[2], NULL, 10) : BENCH_DEFAULT_RECORDS;
+    if (0 == maxProducers || 0 == records) {
+        Bench_die("usage: bench_<name> [max-producers] [records-per-producer]");
+    }
+
+    fprintf(stderr, "%-22s %9s %7s %14s %10s %8s %8s %8s %10s\n",
+            "benchmark", "producers", "size", "records/s", "MB/s", "p50 ns", "p99 ns", "p99.9 ns", "max ns");
+    for (size_t i = 0; i < sizeof(BENCH_MESSAGE_SIZES) / sizeof(BENCH_MESSAGE_SIZES[0]); i++) {
+        for (size_t producers = 1;; producers = producers * 2 < maxProducers ? producers * 2 : maxProducers) {
+            Bench_runOnce(bench, producers, records, BENCH_MESSAGE_SIZES[i]);
+            if (producers == maxProducers) {
+                break;
+            }
+        }
+    }
+    return EXIT_SUCCESS;
+}
+
+#endif /* LOGGER_BENCH_INCLUDED */
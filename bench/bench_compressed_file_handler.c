@@ -0,0 +1,45 @@
+/*
+ * C Source File
+ *
+ * Author: daddinuz
+ * email:  daddinuz@gmail.com
+ * Date:   October 19, 2026
+ */
+
+#include "logger.h"
+#include "logger_builtin_formatters.h"
+#include "logger_builtin_handlers.h"
+#include "bench.h"
+
+#define BLOCK_SIZE (64 * 1024)
+
+static void *setup(const Bench_Run_T *run) {
+    Logger_Formatter_T formatter = Logger_Formatter_newSimpleFormatter();
+    Logger_T logger = Logger_new("bench_compressed_file_handler", LOGGER_LEVEL_INFO);
+    if (!formatter || !logger) {
+        return NULL;
+    }
+    Logger_Handler_Result_T result = Logger_Handler_newCompressedFileHandler(
+            LOGGER_LEVEL_INFO, formatter, run->path, LOGGER_COMPRESS_CODEC_LZ, BLOCK_SIZE
+    );
+    if (LOGGER_ERR_OK != result.err) {
+        return NULL;
+    }
+    Logger_addHandler(logger, result.handler);
+    return logger;
+}
+
+static void produce(void *state, const char *message) {
+    Logger_logInfo(state, "%s", message);
+}
+
+static void teardown(void *state, const Bench_Run_T *run) {
+    Logger_T logger = state;
+    Logger_deepDelete(&logger);
+    remove(run->path);
+}
+
+int main(int argc, char *argv[]) {
+    const Bench_T bench = {.name="compressed_file_handler", .setup=setup, .produce=produce, .teardown=teardown};
+    return Bench_main(argc, argv, &bench);
+}
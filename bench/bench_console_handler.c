@@ -0,0 +1,30 @@
+/*
+ * C Source File
+ *
+ * Author: daddinuz
+ * email:  daddinuz@gmail.com
+ * Date:   October 19, 2026
+ */
+
+#include "logger_builtin_loggers.h"
+#include "bench.h"
+
+static void *setup(const Bench_Run_T *run) {
+    (void) run;
+    return Logger_newStdoutLogger("bench_console_handler", LOGGER_LEVEL_INFO).logger;
+}
+
+static void produce(void *state, const char *message) {
+    Logger_logInfo(state, "%s", message);
+}
+
+static void teardown(void *state, const Bench_Run_T *run) {
+    Logger_T logger = state;
+    (void) run;
+    Logger_deepDelete(&logger);
+}
+
+int main(int argc, char *argv[]) {
+    const Bench_T bench = {.name="console_handler", .setup=setup, .produce=produce, .teardown=teardown};
+    return Bench_main(argc, argv, &bench);
+}
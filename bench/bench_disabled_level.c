@@ -0,0 +1,33 @@
+/*
+ * C Source File
+ *
+ * Author: daddinuz
+ * email:  daddinuz@gmail.com
+ * Date:   October 19, 2026
+ */
+
+#include "logger_builtin_loggers.h"
+#include "bench.h"
+
+/*
+ * The cost of a logging request below the logger level, the handler is never reached.
+ */
+static void *setup(const Bench_Run_T *run) {
+    (void) run;
+    return Logger_newStdoutLogger("bench_disabled_level", LOGGER_LEVEL_ERROR).logger;
+}
+
+static void produce(void *state, const char *message) {
+    Logger_logDebug(state, "%s", message);
+}
+
+static void teardown(void *state, const Bench_Run_T *run) {
+    Logger_T logger = state;
+    (void) run;
+    Logger_deepDelete(&logger);
+}
+
+int main(int argc, char *argv[]) {
+    const Bench_T bench = {.name="disabled_level", .setup=setup, .produce=produce, .teardown=teardown};
+    return Bench_main(argc, argv, &bench);
+}
@@ -0,0 +1,29 @@
+/*
+ * C Source File
+ *
+ * Author: daddinuz
+ * email:  daddinuz@gmail.com
+ * Date:   October 19, 2026
+ */
+
+#include "logger_builtin_loggers.h"
+#include "bench.h"
+
+static void *setup(const Bench_Run_T *run) {
+    return Logger_newFileLogger("bench_file_handler", LOGGER_LEVEL_INFO, run->path).logger;
+}
+
+static void produce(void *state, const char *message) {
+    Logger_logInfo(state, "%s", message);
+}
+
+static void teardown(void *state, const Bench_Run_T *run) {
+    Logger_T logger = state;
+    Logger_deepDelete(&logger);
+    remove(run->path);
+}
+
+int main(int argc, char *argv[]) {
+    const Bench_T bench = {.name="file_handler", .setup=setup, .produce=produce, .teardown=teardown};
+    return Bench_main(argc, argv, &bench);
+}
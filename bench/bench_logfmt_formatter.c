@@ -0,0 +1,59 @@
+/*
+ * C Source File
+ *
+ * Author: daddinuz
+ * email:  daddinuz@gmail.com
+ * Date:   October 19, 2026
+ */
+
+#include "logger_builtin_formatters.h"
+#include "bench.h"
+
+/*
+ * Formats a record shared by the producers, no handler involved.
+ */
+typedef struct State_T {
+    Logger_Formatter_T formatter;
+    Logger_Record_T record;
+    Logger_String_T message;
+} *State_T;
+
+static void *setup(const Bench_Run_T *run) {
+    State_T state = malloc(sizeof(*state));
+    if (!state) {
+        return NULL;
+    }
+    state->formatter = Logger_Formatter_newLogfmtFormatter();
+    state->message = Logger_String_new(run->message);
+    state->record = state->message ? Logger_Record_new(
+            "bench_logfmt_formatter", LOGGER_LEVEL_INFO, __FILE__, __LINE__, __func__, 0, state->message
+    ) : NULL;
+    if (!state->formatter || !state->record) {
+        return NULL;
+    }
+    return state;
+}
+
+static void produce(void *arg, const char *message) {
+    State_T state = arg;
+    (void) message;
+    char *formattedRecord = Logger_Formatter_formatRecord(state->formatter, state->record);
+    if (!formattedRecord) {
+        Bench_die("out of memory");
+    }
+    Logger_Formatter_deleteFormattedRecord(state->formatter, formattedRecord);
+}
+
+static void teardown(void *arg, const Bench_Run_T *run) {
+    State_T state = arg;
+    (void) run;
+    Logger_Record_delete(&state->record);
+    Logger_String_delete(&state->message);
+    Logger_Formatter_delete(&state->formatter);
+    free(state);
+}
+
+int main(int argc, char *argv[]) {
+    const Bench_T bench = {.name="logfmt_formatter", .setup=setup, .produce=produce, .teardown=teardown};
+    return Bench_main(argc, argv, &bench);
+}
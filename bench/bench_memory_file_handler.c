@@ -0,0 +1,36 @@
+/*
+ * C Source File
+ *
+ * Author: daddinuz
+ * email:  daddinuz@gmail.com
+ * Date:   October 19, 2026
+ */
+
+#include "logger_builtin_loggers.h"
+#include "bench.h"
+
+#define BYTES_BEFORE_WRITE (64 * 1024)
+
+static void *setup(const Bench_Run_T *run) {
+    return Logger_newMemoryFileLogger(
+            "bench_memory_file_handler", LOGGER_LEVEL_INFO, run->path, BYTES_BEFORE_WRITE
+    ).logger;
+}
+
+static void produce(void *state, const char *message) {
+    Logger_logInfo(state, "%s", message);
+}
+
+static void teardown(void *state, const Bench_Run_T *run) {
+    Logger_T logger = state;
+    Logger_deepDelete(&logger);
+    remove(run->path);
+}
+
+int main(int argc, char *argv[]) {
+    /* the handler does not lock its state, an application sharing it among threads must */
+    const Bench_T bench = {
+            .name="memory_file_handler", .serialize=true, .setup=setup, .produce=produce, .teardown=teardown
+    };
+    return Bench_main(argc, argv, &bench);
+}
@@ -0,0 +1,42 @@
+/*
+ * C Source File
+ *
+ * Author: daddinuz
+ * email:  daddinuz@gmail.com
+ * Date:   October 19, 2026
+ */
+
+#include "logger_builtin_loggers.h"
+#include "bench.h"
+
+#define BYTES_BEFORE_ROTATION (4 * 1024 * 1024)
+
+static void *setup(const Bench_Run_T *run) {
+    return Logger_newRotatingFileLogger(
+            "bench_rotating_file_handler", LOGGER_LEVEL_INFO, run->path, BYTES_BEFORE_ROTATION
+    ).logger;
+}
+
+static void produce(void *state, const char *message) {
+    Logger_logInfo(state, "%s", message);
+}
+
+static void teardown(void *arg, const Bench_Run_T *run) {
+    char path[sizeof(run->path) + 32];
+    Logger_T logger = arg;
+    Logger_deepDelete(&logger);
+    for (size_t i = 0;; i++) {
+        snprintf(path, sizeof(path), "%s.%zu", run->path, i);
+        if (0 != remove(path)) {
+            break;
+        }
+    }
+}
+
+int main(int argc, char *argv[]) {
+    /* the handler does not lock its state, an application sharing it among threads must */
+    const Bench_T bench = {
+            .name="rotating_file_handler", .serialize=true, .setup=setup, .produce=produce, .teardown=teardown
+    };
+    return Bench_main(argc, argv, &bench);
+}
@@ -36,6 +36,7 @@
  * the include of your alternate allocator if needed (not needed in order
  * to use the default libc allocator). */
 
-#define s_malloc malloc
-#define s_realloc realloc
-#define s_free free
+#include "logger_alloc.h"
+#define s_malloc Logger_Alloc_malloc
+#define s_realloc Logger_Alloc_realloc
+#define s_free Logger_Alloc_free
@@ -80,25 +80,8 @@ void initializeLogging(void) {
 }
 
 void terminateLogging(void) {
-    bool formatterNotYetDeleted = true;
-    for (Logger_Handler_T handler = Logger_popHandler(gLogger); handler; handler = Logger_popHandler(gLogger)) {
-        if (formatterNotYetDeleted) {
-            /*
-             * Terminate formatter
-             */
-            Logger_Formatter_T formatter = Logger_Handler_getFormatter(handler);
-            Logger_Formatter_delete(&formatter);
-            formatterNotYetDeleted = false;
-        }
-
-        /*
-         * Terminate handlers
-         */
-        Logger_Handler_delete(&handler);
-    }
-
     /*
-     * Terminate logger
+     * Terminate logger, handlers and the formatter they share
      */
-    Logger_delete(&gLogger);
+    Logger_deepDelete(&gLogger);
 }
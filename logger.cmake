@@ -1,6 +1,14 @@
+if (NOT TARGET sds)
+    include("${CMAKE_CURRENT_LIST_DIR}/../sds/sds.cmake")  # clib installs the dependencies side by side
+endif ()
+
 get_filename_component(ARCHIVE_NAME "${CMAKE_CURRENT_LIST_DIR}" NAME_WE)
 message("${ARCHIVE_NAME}@${CMAKE_CURRENT_LIST_DIR} using: ${CMAKE_CURRENT_LIST_FILE} ")
 
 file(GLOB HEADER_FILES "${CMAKE_CURRENT_LIST_DIR}/*.h")
 file(GLOB SOURCE_FILES "${CMAKE_CURRENT_LIST_DIR}/*.c")
 add_library("${ARCHIVE_NAME}" "${HEADER_FILES}" "${SOURCE_FILES}")
+
+find_package(Threads REQUIRED)
+target_link_libraries("${ARCHIVE_NAME}" PRIVATE sds PUBLIC Threads::Threads)
+target_link_libraries(sds PRIVATE "${ARCHIVE_NAME}")  # sds allocates through logger_alloc.h
@@ -10,74 +10,313 @@
 #include <stdarg.h>
 #include <string.h>
 #include <assert.h>
+#include <sched.h>
+#include <pthread.h>
+#include "logger_alloc.h"
+#include "logger_arena.h"
 #include "logger.h"
+#include "logger_level_spec.h"
+#ifdef LOGGER_HISTOGRAM
+#include "logger_histogram.h"
+#endif
 
-typedef struct Logger_HandlersList_T {
-    Logger_Handler_T handler;
-    struct Logger_HandlersList_T *next;
-} *Logger_HandlersList_T;
+/*
+ * The handlers of a logger form an immutable set, replaced as a whole on every change so that logging threads
+ * never lock: they announce themselves in one of two reader counters before loading the set. A writer publishes
+ * the new set, then flips the generation twice waiting for the counter it leaves to drain each time; after that
+ * no reader can still hold the previous set, which is freed along with the handlers removed by the caller.
+ * The set is changed under gConfigMutex but the readers are waited for with only the writer lock of the logger,
+ * which serializes its writers, so that a slow handler does not stall the configuration of the whole process.
+ */
+typedef struct Logger_HandlerSet_T {
+    size_t size;
+    Logger_Handler_T handlers[];
+} *Logger_HandlerSet_T;
 
-static Logger_HandlersList_T Logger_HandlersList_new(Logger_Handler_T handler, Logger_HandlersList_T next) {
-    assert(handler);
-    Logger_HandlersList_T self = malloc(sizeof(*self));
+static Logger_HandlerSet_T Logger_HandlerSet_new(size_t size) {
+    assert(size > 0);
+    Logger_HandlerSet_T self = Logger_Alloc_malloc(sizeof(*self) + size * sizeof(self->handlers[0]));
     if (self) {
-        self->handler = handler;
-        self->next = next;
+        self->size = size;
     }
     return self;
 }
 
-static void Logger_HandlersList_delete(Logger_HandlersList_T *ref) {
+static void Logger_HandlerSet_delete(Logger_HandlerSet_T *ref) {
     assert(ref);
-    assert(*ref);
-    Logger_HandlersList_T self = *ref;
-    free(self);
+    Logger_HandlerSet_T self = *ref;
+    Logger_Alloc_free(self);
     *ref = NULL;
 }
 
+/*
+ * Loggers returned by Logger_get are registered: they are linked to their parent and children along the
+ * dot hierarchy and own their name, stored in key. Loggers without an explicit level take the effective
+ * level of their parent, which is pushed down to them whenever it changes.
+ */
 struct Logger_T {
     const char *name;
     Logger_Level_T level;
-    Logger_HandlersList_T handlers;
+    Logger_Level_T effectiveLevel;
+    bool hasLevel;
+    bool propagate;
+    bool registered;
+    Logger_HandlerSet_T handlers;
+    Logger_HandlerSet_T retired;
+    bool replaced;
+    pthread_mutex_t writerMutex;
+    unsigned generation;
+    size_t readers[2];
+    Logger_T parent;
+    Logger_T children;
+    Logger_T sibling;
+    uint64_t hash;
+    size_t keyLength;
+    char key[];
 };
 
-Logger_T Logger_new(const char *name, Logger_Level_T level) {
-    assert(name);
-    assert(LOGGER_LEVEL_DEBUG <= level && level <= LOGGER_LEVEL_FATAL);
-    Logger_T self = malloc(sizeof(*self));
+/*
+ * Guards the tree of registered loggers, every level change and every handler set change.
+ */
+static pthread_mutex_t gConfigMutex = PTHREAD_MUTEX_INITIALIZER;
+
+static Logger_T initialize(Logger_T self, const char *name, Logger_Level_T level) {
     if (self) {
         self->name = name;
         self->level = level;
+        self->effectiveLevel = level;
+        self->hasLevel = true;
+        self->propagate = true;
+        self->registered = false;
         self->handlers = NULL;
+        self->retired = NULL;
+        self->replaced = false;
+        pthread_mutex_init(&self->writerMutex, NULL);
+        self->generation = 0;
+        self->readers[0] = 0;
+        self->readers[1] = 0;
+        self->parent = NULL;
+        self->children = NULL;
+        self->sibling = NULL;
+        self->hash = 0;
+        self->keyLength = 0;
     }
     return self;
 }
 
+Logger_T Logger_new(const char *name, Logger_Level_T level) {
+    assert(name);
+    assert(LOGGER_LEVEL_DEBUG <= level && level <= LOGGER_LEVEL_FATAL);
+    return initialize(Logger_Alloc_malloc(sizeof(struct Logger_T)), name, Logger_LevelSpec_resolve(name, level));
+}
+
 void Logger_delete(Logger_T *ref) {
     assert(ref);
     assert(*ref);
+    assert(!(*ref)->registered);
     Logger_T self = *ref;
-    Logger_HandlersList_T current, next;
-    for (current = self->handlers; current; current = next) {
-        next = current->next;
-        Logger_HandlersList_delete(&current);
-    }
-    free(self);
+    Logger_HandlerSet_delete(&self->handlers);
+    pthread_mutex_destroy(&self->writerMutex);
+    Logger_Alloc_free(self);
     *ref = NULL;
 }
 
+/*
+ * Tell whether a handler of self still uses formatter.
+ */
+static bool usesFormatter(Logger_T self, Logger_Formatter_T formatter) {
+    bool uses = false;
+    pthread_mutex_lock(&gConfigMutex);
+    for (size_t i = 0; self->handlers && i < self->handlers->size && !uses; i++) {
+        uses = formatter == Logger_Handler_getFormatter(self->handlers->handlers[i]);
+    }
+    pthread_mutex_unlock(&gConfigMutex);
+    return uses;
+}
+
 void Logger_deepDelete(Logger_T *ref) {
     assert(ref);
     assert(*ref);
     Logger_T self = *ref;
     for (Logger_Handler_T handler = Logger_popHandler(self); handler; handler = Logger_popHandler(self)) {
         Logger_Formatter_T formatter = Logger_Handler_getFormatter(handler);
-        Logger_Formatter_delete(&formatter);
-        Logger_Handler_delete(&handler);
-    };
+        Logger_Handler_delete(&handler);  /* handlers may still format pending records while closing */
+        if (formatter && !usesFormatter(self, formatter)) {  /* a shared formatter goes with its last handler */
+            Logger_Formatter_release(&formatter);
+        }
+    }
     Logger_delete(ref);
 }
 
+/*
+ * Enter a read side section on the handlers of self, return the counter to leave.
+ */
+static unsigned enterHandlers(Logger_T self) {
+    const unsigned index = __atomic_load_n(&self->generation, __ATOMIC_SEQ_CST) & 1;
+    __atomic_fetch_add(&self->readers[index], 1, __ATOMIC_SEQ_CST);
+    return index;
+}
+
+static void leaveHandlers(Logger_T self, unsigned index) {
+    __atomic_fetch_sub(&self->readers[index], 1, __ATOMIC_RELEASE);
+}
+
+/*
+ * Take the writer lock of self and gConfigMutex, in this order, before changing the handler set of self.
+ */
+static void lockHandlers(Logger_T self) {
+    pthread_mutex_lock(&self->writerMutex);
+    pthread_mutex_lock(&gConfigMutex);
+}
+
+/*
+ * Replace the handler set of self, lockHandlers must have been called.
+ */
+static void replaceHandlers(Logger_T self, Logger_HandlerSet_T handlers) {
+    assert(!self->replaced);
+    self->retired = __atomic_exchange_n(&self->handlers, handlers, __ATOMIC_SEQ_CST);
+    self->replaced = true;
+}
+
+/*
+ * Release the locks taken by lockHandlers.
+ * If the set was replaced, it returns once no thread can be publishing through the previous one.
+ */
+static void unlockHandlers(Logger_T self) {
+    pthread_mutex_unlock(&gConfigMutex);
+    if (self->replaced) {
+        for (size_t i = 0; i < 2; i++) {
+            const unsigned index = __atomic_fetch_add(&self->generation, 1, __ATOMIC_SEQ_CST) & 1;
+            while (__atomic_load_n(&self->readers[index], __ATOMIC_ACQUIRE) > 0) {
+                sched_yield();
+            }
+        }
+        Logger_HandlerSet_delete(&self->retired);
+        self->replaced = false;
+    }
+    pthread_mutex_unlock(&self->writerMutex);
+}
+
+/*
+ * Registry
+ *
+ * Open addressing table with linear probing, kept at most half full and keyed by the content of the names.
+ * Lookups never lock: a logger is fully built and linked in the tree before being published in its slot.
+ * Insertions are serialized by gConfigMutex, slots are never freed.
+ */
+#define LOGGER_REGISTRY_SLOTS (2 * LOGGER_REGISTRY_CAPACITY)
+
+static Logger_T gSlots[LOGGER_REGISTRY_SLOTS];
+static size_t gRegistrySize = 0;
+
+static uint64_t hashName(const char *name, size_t length) {
+    uint64_t hash = UINT64_C(14695981039346656037); /* FNV-1a */
+    for (size_t i = 0; i < length; i++) {
+        hash = (hash ^ (unsigned char) name[i]) * UINT64_C(1099511628211);
+    }
+    return hash;
+}
+
+/*
+ * Find the slot of name, or the free slot it would take, return LOGGER_REGISTRY_SLOTS if the table is full.
+ */
+static size_t findSlot(const char *name, size_t length, uint64_t hash) {
+    size_t slot = (size_t) hash & (LOGGER_REGISTRY_SLOTS - 1);
+    for (size_t probes = 0; probes < LOGGER_REGISTRY_SLOTS; probes++, slot = (slot + 1) & (LOGGER_REGISTRY_SLOTS - 1)) {
+        Logger_T logger = __atomic_load_n(&gSlots[slot], __ATOMIC_ACQUIRE);
+        if (!logger || (logger->hash == hash && logger->keyLength == length && 0 == memcmp(logger->key, name, length))) {
+            return slot;
+        }
+    }
+    return LOGGER_REGISTRY_SLOTS;
+}
+
+/*
+ * Push the effective level of self down to the descendants that inherit it, gConfigMutex must be held.
+ */
+static void pushDownLevel(Logger_T self, Logger_Level_T effectiveLevel) {
+    assert(self);
+    __atomic_store_n(&self->effectiveLevel, effectiveLevel, __ATOMIC_RELAXED);
+    for (Logger_T child = self->children; child; child = child->sibling) {
+        if (!child->hasLevel) {
+            pushDownLevel(child, effectiveLevel);
+        }
+    }
+}
+
+/*
+ * Get or create the registered logger of name and all of its ancestors, gConfigMutex must be held.
+ */
+static Logger_T registerLogger(const char *name, size_t length) {
+    const uint64_t hash = hashName(name, length);
+    const size_t slot = findSlot(name, length, hash);
+    if (LOGGER_REGISTRY_SLOTS == slot) {
+        return NULL;
+    }
+    if (gSlots[slot]) {
+        return gSlots[slot];
+    }
+    if (gRegistrySize >= LOGGER_REGISTRY_CAPACITY) {
+        return NULL;
+    }
+
+    Logger_T parent = NULL;
+    if (length > 0) {
+        size_t parentLength = length;
+        while (parentLength > 0 && '.' != name[parentLength - 1]) {
+            parentLength--;
+        }
+        parent = registerLogger(name, parentLength > 0 ? parentLength - 1 : 0);
+        if (!parent) {
+            return NULL;
+        }
+    }
+
+    Logger_T self = initialize(
+            Logger_Alloc_malloc(sizeof(struct Logger_T) + length + 1), "", LOGGER_REGISTRY_ROOT_LEVEL
+    );
+    if (!self) {
+        return NULL;
+    }
+    memcpy(self->key, name, length);
+    self->key[length] = '\0';
+    self->name = self->key;
+    self->registered = true;
+    self->hash = hash;
+    self->keyLength = length;
+    if (parent) {
+        self->hasLevel = false;
+        self->effectiveLevel = parent->effectiveLevel;
+        self->parent = parent;
+        self->sibling = parent->children;
+        parent->children = self;
+    }
+    /* a pattern the parent matches as well is already reflected by the level inherited from it */
+    Logger_LevelSpec_T spec = Logger_LevelSpec_getEnvironment();
+    if (spec && (parent ? Logger_LevelSpec_matchBeyond(spec, self->name, parent->keyLength, &self->level)
+                        : Logger_LevelSpec_match(spec, self->name, &self->level))) {
+        self->hasLevel = true;  /* as if Logger_setLevel was called */
+        self->effectiveLevel = self->level;
+    }
+    gRegistrySize++;
+    /* the parent may have taken a slot of the same probe sequence */
+    __atomic_store_n(&gSlots[findSlot(name, length, hash)], self, __ATOMIC_RELEASE);
+    return self;
+}
+
+Logger_T Logger_get(const char *name) {
+    assert(name);
+    const size_t length = strlen(name);
+    const size_t slot = findSlot(name, length, hashName(name, length));
+    Logger_T self = LOGGER_REGISTRY_SLOTS == slot ? NULL : __atomic_load_n(&gSlots[slot], __ATOMIC_ACQUIRE);
+    if (!self) {
+        pthread_mutex_lock(&gConfigMutex);
+        self = registerLogger(name, length);
+        pthread_mutex_unlock(&gConfigMutex);
+    }
+    return self;
+}
+
 const char *Logger_getName(Logger_T self) {
     assert(self);
     return self->name;
@@ -85,41 +324,65 @@ const char *Logger_getName(Logger_T self) {
 
 Logger_Level_T Logger_getLevel(Logger_T self) {
     assert(self);
-    return self->level;
+    return __atomic_load_n(&self->effectiveLevel, __ATOMIC_RELAXED);
+}
+
+Logger_T Logger_getParent(Logger_T self) {
+    assert(self);
+    return self->parent;
+}
+
+bool Logger_getPropagate(Logger_T self) {
+    assert(self);
+    return __atomic_load_n(&self->propagate, __ATOMIC_RELAXED);
+}
+
+/*
+ * Remove the handler at index from the set of self, lockHandlers must have been called.
+ */
+static Logger_Handler_T removeHandlerAt(Logger_T self, size_t index) {
+    Logger_HandlerSet_T current = self->handlers;
+    Logger_HandlerSet_T handlers = NULL;
+    assert(current && index < current->size);
+    if (current->size > 1) {
+        handlers = Logger_HandlerSet_new(current->size - 1);
+        if (!handlers) {
+            return NULL;
+        }
+        memcpy(handlers->handlers, current->handlers, index * sizeof(handlers->handlers[0]));
+        memcpy(
+                handlers->handlers + index, current->handlers + index + 1,
+                (current->size - index - 1) * sizeof(handlers->handlers[0])
+        );
+    }
+    Logger_Handler_T outHandler = current->handlers[index];
+    replaceHandlers(self, handlers);
+    return outHandler;
 }
 
 Logger_Handler_T Logger_removeHandler(Logger_T self, Logger_Handler_T handler) {
     assert(self);
     assert(handler);
     Logger_Handler_T outHandler = NULL;
-    Logger_HandlersList_T prev = NULL, base = self->handlers;
-    while (base) {
-        if (base->handler == handler) {
-            if (prev) {
-                prev->next = base->next;
-            } else {
-                self->handlers = base->next;
-            }
-            outHandler = base->handler;
-            Logger_HandlersList_delete(&base);
+    lockHandlers(self);
+    for (size_t i = 0; self->handlers && i < self->handlers->size; i++) {
+        if (self->handlers->handlers[i] == handler) {
+            outHandler = removeHandlerAt(self, i);
             break;
         }
-        prev = base;
-        base = base->next;
     }
+    unlockHandlers(self);
     return outHandler;
 }
 
 Logger_Handler_T Logger_popHandler(Logger_T self) {
     assert(self);
     Logger_Handler_T outHandler = NULL;
-    Logger_HandlersList_T tmp = NULL;
+    lockHandlers(self);
     if (self->handlers) {
-        tmp = self->handlers;
-        outHandler = self->handlers->handler;
-        self->handlers = self->handlers->next;
-        Logger_HandlersList_delete(&tmp);
+        outHandler = removeHandlerAt(self, 0);
     }
+    unlockHandlers(self);
     return outHandler;
 }
 
@@ -132,81 +395,272 @@ void Logger_setName(Logger_T self, const char *name) {
 void Logger_setLevel(Logger_T self, Logger_Level_T level) {
     assert(self);
     assert(LOGGER_LEVEL_DEBUG <= level && level <= LOGGER_LEVEL_FATAL);
+    pthread_mutex_lock(&gConfigMutex);
     self->level = level;
+    self->hasLevel = true;
+    pushDownLevel(self, level);
+    pthread_mutex_unlock(&gConfigMutex);
+}
+
+void Logger_resetLevel(Logger_T self) {
+    assert(self);
+    pthread_mutex_lock(&gConfigMutex);
+    if (self->parent) {
+        self->hasLevel = false;
+        pushDownLevel(self, self->parent->effectiveLevel);
+    }
+    pthread_mutex_unlock(&gConfigMutex);
+}
+
+void Logger_setPropagate(Logger_T self, bool propagate) {
+    assert(self);
+    __atomic_store_n(&self->propagate, propagate, __ATOMIC_RELAXED);
 }
 
 Logger_Handler_T Logger_addHandler(Logger_T self, Logger_Handler_T handler) {
     assert(self);
     assert(handler);
-    Logger_HandlersList_T head = Logger_HandlersList_new(handler, self->handlers);
-    if (!head) {
-        return NULL;
+    lockHandlers(self);
+    Logger_HandlerSet_T current = self->handlers;
+    Logger_HandlerSet_T handlers = Logger_HandlerSet_new(current ? current->size + 1 : 1);
+    if (handlers) {
+        handlers->handlers[0] = handler;
+        if (current) {
+            memcpy(handlers->handlers + 1, current->handlers, current->size * sizeof(handlers->handlers[0]));
+        }
+        replaceHandlers(self, handlers);
+    }
+    unlockHandlers(self);
+    return handlers ? handler : NULL;
+}
+
+Logger_Err_T Logger_reconfigure(
+        Logger_T self, Logger_Level_T level, Logger_Handler_T const *handlers, size_t handlersCount
+) {
+    assert(self);
+    assert(LOGGER_LEVEL_DEBUG <= level && level <= LOGGER_LEVEL_FATAL);
+    assert(handlers || 0 == handlersCount);
+    Logger_HandlerSet_T set = NULL;
+    if (handlersCount > 0) {
+        set = Logger_HandlerSet_new(handlersCount);
+        if (!set) {
+            return LOGGER_ERR_OUT_OF_MEMORY;
+        }
+        for (size_t i = 0; i < handlersCount; i++) {
+            assert(handlers[i]);
+            set->handlers[i] = handlers[i];
+        }
+    }
+    lockHandlers(self);
+    self->level = level;
+    self->hasLevel = true;
+    pushDownLevel(self, level);
+    replaceHandlers(self, set);
+    unlockHandlers(self);
+    return LOGGER_ERR_OK;
+}
+
+static bool containsHandler(Logger_Handler_T const *handlers, size_t handlersCount, Logger_Handler_T handler) {
+    for (size_t i = 0; i < handlersCount; i++) {
+        if (handlers[i] == handler) {
+            return true;
+        }
     }
-    self->handlers = head;
-    return handler;
+    return false;
+}
+
+Logger_Err_T Logger_replaceHandlers(
+        Logger_T self, Logger_Level_T level, Logger_Handler_T const *previous, size_t previousCount,
+        Logger_Handler_T const *handlers, size_t handlersCount
+) {
+    assert(self);
+    assert(LOGGER_LEVEL_DEBUG <= level && level <= LOGGER_LEVEL_FATAL);
+    assert(previous || 0 == previousCount);
+    assert(handlers || 0 == handlersCount);
+    lockHandlers(self);
+    Logger_HandlerSet_T current = self->handlers;
+    const size_t capacity = handlersCount + (current ? current->size : 0);
+    Logger_HandlerSet_T set = capacity > 0 ? Logger_HandlerSet_new(capacity) : NULL;
+    if (capacity > 0 && !set) {
+        unlockHandlers(self);
+        return LOGGER_ERR_OUT_OF_MEMORY;
+    }
+    size_t size = 0;
+    for (size_t i = 0; i < handlersCount; i++) {
+        assert(handlers[i]);
+        set->handlers[size++] = handlers[i];
+    }
+    for (size_t i = 0; current && i < current->size; i++) {
+        Logger_Handler_T handler = current->handlers[i];
+        if (!containsHandler(previous, previousCount, handler) && !containsHandler(handlers, handlersCount, handler)) {
+            set->handlers[size++] = handler;
+        }
+    }
+    if (0 == size && set) {
+        Logger_HandlerSet_delete(&set);
+    } else if (set) {
+        set->size = size;
+    }
+    self->level = level;
+    self->hasLevel = true;
+    pushDownLevel(self, level);
+    replaceHandlers(self, set);
+    unlockHandlers(self);
+    return LOGGER_ERR_OK;
 }
 
 bool Logger_isLoggable(Logger_T self, Logger_Level_T level) {
     assert(self);
     assert(LOGGER_LEVEL_DEBUG <= level && level <= LOGGER_LEVEL_FATAL);
-    return level >= self->level;
+    return level >= __atomic_load_n(&self->effectiveLevel, __ATOMIC_RELAXED);
 }
 
 Logger_Err_T Logger_logRecord(Logger_T self, Logger_Record_T record) {
     assert(self);
     assert(record);
     Logger_Err_T err = LOGGER_ERR_OK;
-    if (Logger_isLoggable(self, Logger_Record_getLevel(record))) {
-        for (Logger_HandlersList_T base = self->handlers; base; base = base->next) {
-            if (Logger_Handler_isLoggable(base->handler, record)) {
-                err = Logger_Handler_publish(base->handler, record);
-                if (LOGGER_ERR_OK != err) {
-                    break;
+    const Logger_CallSite_T *callSite = Logger_Record_getCallSite(record);
+    if ((callSite && Logger_CallSite_isEnabled(callSite)) || Logger_isLoggable(self, Logger_Record_getLevel(record))) {
+        for (Logger_T logger = self; logger; logger = Logger_getPropagate(logger) ? logger->parent : NULL) {
+            const unsigned index = enterHandlers(logger);
+            Logger_HandlerSet_T handlers = __atomic_load_n(&logger->handlers, __ATOMIC_SEQ_CST);
+            for (size_t i = 0; handlers && i < handlers->size; i++) {
+                if (Logger_Handler_isLoggable(handlers->handlers[i], record)) {
+                    /* a failing handler must not starve the others, report the first error */
+                    const Logger_Err_T handlerErr = Logger_Handler_publish(handlers->handlers[i], record);
+                    if (LOGGER_ERR_OK == err) {
+                        err = handlerErr;
+                    }
+                } else {
+                    Logger_Handler_addFiltered(handlers->handlers[i]);
                 }
             }
+            leaveHandlers(logger, index);
         }
     }
     return err;
 }
 
-Logger_Err_T _Logger_log(
-        Logger_T self, Logger_Level_T level, const char *file, size_t line, const char *function, time_t timestamp,
-        const char *fmt, ...
+/*
+ * Build the record of a logging request in the arena and hand it to the handlers.
+ * The message is printed from callSite->format and args, rendered from callSite->format by renderer or,
+ * when both are NULL, callSite->format itself.
+ */
+static Logger_Err_T logRequest(
+        Logger_T self, Logger_CallSite_T *callSite, const Logger_Field_T *fields, size_t fieldsCount, va_list *args,
+        Logger_Renderer_T *renderer, const void *context
 ) {
     assert(self);
-    assert(file);
-    assert(function);
-    assert(LOGGER_LEVEL_DEBUG <= level && level <= LOGGER_LEVEL_FATAL);
-    assert(fmt);
+    assert(callSite);
+    assert(callSite->file);
+    assert(callSite->function);
+    assert(callSite->format);
+    assert(LOGGER_LEVEL_DEBUG <= callSite->level && callSite->level <= LOGGER_LEVEL_FATAL);
 
-    va_list args;
     Logger_Err_T err;
     Logger_String_T message = NULL;
     Logger_Record_T record = NULL;
+    const void *arenaMark = NULL;
+
+    switch (Logger_CallSite_getState(callSite)) {
+        case LOGGER_CALLSITE_DISABLED:
+            return LOGGER_ERR_OK;
+        case LOGGER_CALLSITE_ENABLED:
+            break;
+        default:
+            if (!Logger_isLoggable(self, callSite->level)) {
+                return LOGGER_ERR_OK;
+            }
+            break;
+    }
+    if (!Logger_CallSite_admit(callSite)) {
+        return LOGGER_ERR_OK;
+    }
+#ifdef LOGGER_HISTOGRAM
+    const uint64_t startTicks = Logger_Histogram_getTicks();
+    uint64_t dispatchTicks = startTicks;
+#endif
 
-    va_start(args, fmt);
     do {
-        message = Logger_String_fromArgumentsList(fmt, args);
+        if (args) {
+            message = Logger_Arena_vprintf(callSite->format, *args);
+            arenaMark = message;
+        } else if (renderer) {
+            message = renderer(callSite->format, context);
+            arenaMark = message;
+        } else {
+            message = callSite->format;
+        }
         if (!message) {
             err = LOGGER_ERR_OUT_OF_MEMORY;
             break;
         }
 
-        record = Logger_Record_new(Logger_getName(self), level, file, line, function, timestamp, message);
+        record = _Logger_Record_newTemporary(
+                Logger_getName(self), callSite->level, callSite->file, callSite->line, callSite->function, time(NULL),
+                message
+        );
         if (!record) {
             err = LOGGER_ERR_OUT_OF_MEMORY;
             break;
         }
+        arenaMark = arenaMark ? arenaMark : record;
+        Logger_Record_setCallSite(record, callSite);
+        Logger_Record_setSuppressed(record, Logger_CallSite_takeSuppressed(callSite));
+        Logger_Record_setFields(record, fields, fieldsCount);
+        Logger_Record_setMdc(record, Logger_Mdc_current());  /* kept alive by the thread until we return */
 
+#ifdef LOGGER_HISTOGRAM
+        dispatchTicks = Logger_Histogram_getTicks();
+        _Logger_Histogram_takeIoTicks();
+#endif
         err = Logger_logRecord(self, record);
     } while (false);
-    va_end(args);
 
-    if (record) {
-        Logger_Record_delete(&record);
+#ifdef LOGGER_HISTOGRAM
+    {
+        const uint64_t endTicks = Logger_Histogram_getTicks();
+        const uint64_t ioTicks = _Logger_Histogram_takeIoTicks();
+        const uint64_t dispatchAndIoTicks = endTicks - dispatchTicks;
+        Logger_Histogram_record(LOGGER_HISTOGRAM_PHASE_FORMAT, dispatchTicks - startTicks);
+        Logger_Histogram_record(
+                LOGGER_HISTOGRAM_PHASE_DISPATCH, dispatchAndIoTicks > ioTicks ? dispatchAndIoTicks - ioTicks : 0
+        );
+        Logger_Histogram_record(LOGGER_HISTOGRAM_PHASE_IO, ioTicks);
+        Logger_Histogram_record(LOGGER_HISTOGRAM_PHASE_TOTAL, endTicks - startTicks);
     }
-    if (message) {
-        Logger_String_delete(&message);
+#endif
+
+    if (arenaMark) {
+        Logger_Arena_release(arenaMark);  /* the record and whatever the handlers left behind go with it */
     }
     return err;
 }
+
+Logger_Err_T _Logger_log(Logger_T self, Logger_CallSite_T *callSite, ...) {
+    assert(self);
+    assert(callSite);
+    va_list args;
+    va_start(args, callSite);
+    const Logger_Err_T err = logRequest(self, callSite, NULL, 0, &args, NULL, NULL);
+    va_end(args);
+    return err;
+}
+
+Logger_Err_T _Logger_logFields(
+        Logger_T self, Logger_CallSite_T *callSite, const Logger_Field_T *fields, size_t fieldsCount
+) {
+    assert(self);
+    assert(callSite);
+    assert(fields || 0 == fieldsCount);
+    return logRequest(self, callSite, fields, fieldsCount, NULL, NULL, NULL);
+}
+
+Logger_Err_T _Logger_logRendered(
+        Logger_T self, Logger_CallSite_T *callSite, Logger_Renderer_T *renderer, const void *context
+) {
+    assert(self);
+    assert(callSite);
+    assert(renderer);
+    return logRequest(self, callSite, NULL, 0, NULL, renderer, context);
+}
@@ -12,9 +12,11 @@
 #define LOGGER_VERSION "0.3.1"
 
 #include "logger_err.h"
+#include "logger_alloc.h"
 #include "logger_level.h"
 #include "logger_string.h"
 #include "logger_record.h"
+#include "logger_callsite.h"
 #include "logger_handler.h"
 #include "logger_formatter.h"
 
@@ -22,10 +24,29 @@
 extern "C" {
 #endif
 
+#ifdef __cplusplus
+typedef struct Logger_C *Logger_T;  /* C++ does not let a typedef share the name of its tag */
+#else
 typedef struct Logger_T *Logger_T;
+#endif
+
+/**
+ * The maximum number of loggers Logger_get can register, root included; it can be overridden at compile time
+ * and must be a power of 2.
+ */
+#ifndef LOGGER_REGISTRY_CAPACITY
+#define LOGGER_REGISTRY_CAPACITY 1024
+#endif
+
+/**
+ * The level of the root logger until it is changed.
+ */
+#define LOGGER_REGISTRY_ROOT_LEVEL LOGGER_LEVEL_INFO
 
 /**
  * Construct a Logger_T.
+ * If the environment variable LOGGER_LEVELS gives a level to name that level is used instead,
+ * see logger_level_spec.h.
  *
  * Checked runtime errors:
  *  - @param name must not be NULL.
@@ -38,11 +59,30 @@ typedef struct Logger_T *Logger_T;
  */
 extern Logger_T Logger_new(const char *name, Logger_Level_T level);
 
+/**
+ * Get the logger registered with name, creating it along with its ancestors on first use.
+ * Names are dot separated paths: the parent of "db.pool.conn" is "db.pool", then "db" and finally the root
+ * logger, whose name is the empty string. A registered logger takes the level of its parent until it is
+ * given one with Logger_setLevel, or by the environment variable LOGGER_LEVELS (see logger_level_spec.h),
+ * and hands its records to the handlers of its ancestors as well as its own, see Logger_setPropagate.
+ * Lookups of loggers already registered never lock nor allocate.
+ * Registered loggers live as long as the process and must not be deleted.
+ *
+ * Checked runtime errors:
+ *  - @param name must not be NULL.
+ *  - In case of OOM or if the registry is full this function will return NULL.
+ *
+ * @param name The logger name, it is copied.
+ * @return The registered Logger_T instance.
+ */
+extern Logger_T Logger_get(const char *name);
+
 /**
  * Destruct a Logger_T.
  *
  * Checked runtime errors:
  *  - @param ref must be a valid reference to a Logger_T instance.
+ *  - The instance must not be returned by Logger_get.
  *
  * @param ref The reference to the Logger_T instance.
  */
@@ -50,6 +90,8 @@ extern void Logger_delete(Logger_T *ref);
 
 /**
  * Destruct a Logger_T and recursively the handler associated and the relative formatters.
+ * A formatter shared by several handlers of the logger is released once, along with the last of them:
+ * one shared with other loggers must hold a reference for each of them (see Logger_Formatter_retain).
  *
  * Checked runtime errors:
  *  - @param ref must be a valid reference to a Logger_T instance.
@@ -70,7 +112,7 @@ extern void Logger_deepDelete(Logger_T *ref);
 extern const char *Logger_getName(Logger_T self);
 
 /**
- * Get the level for the specific logger.
+ * Get the level for the specific logger, inherited from its parent unless it has been set.
  *
  * Checked runtime errors:
  *  - @param self must not be NULL.
@@ -80,6 +122,28 @@ extern const char *Logger_getName(Logger_T self);
  */
 extern Logger_Level_T Logger_getLevel(Logger_T self);
 
+/**
+ * Get the parent of a registered logger.
+ *
+ * Checked runtime errors:
+ *  - @param self must not be NULL.
+ *
+ * @param self The Logger_T instance.
+ * @return The parent logger or NULL for the root logger and the loggers made by Logger_new.
+ */
+extern Logger_T Logger_getParent(Logger_T self);
+
+/**
+ * Check whether the records of the logger are handed to the handlers of its parent too.
+ *
+ * Checked runtime errors:
+ *  - @param self must not be NULL.
+ *
+ * @param self The Logger_T instance.
+ * @return true if records are propagated, the default.
+ */
+extern bool Logger_getPropagate(Logger_T self);
+
 /**
  * Remove a specific handler from the logger.
  *
@@ -117,7 +181,7 @@ extern Logger_Handler_T Logger_popHandler(Logger_T self);
 extern void Logger_setName(Logger_T self, const char *name);
 
 /**
- * Set the level for the specific logger.
+ * Set the level for the specific logger, the registered descendants that inherit it follow.
  *
  * Checked runtime errors:
  *  - @param self must not be NULL.
@@ -128,6 +192,28 @@ extern void Logger_setName(Logger_T self, const char *name);
  */
 extern void Logger_setLevel(Logger_T self, Logger_Level_T level);
 
+/**
+ * Make a registered logger inherit the level of its parent again.
+ * It has no effect on loggers without a parent.
+ *
+ * Checked runtime errors:
+ *  - @param self must not be NULL.
+ *
+ * @param self The Logger_T instance.
+ */
+extern void Logger_resetLevel(Logger_T self);
+
+/**
+ * Set whether the records of the logger are handed to the handlers of its parent too.
+ *
+ * Checked runtime errors:
+ *  - @param self must not be NULL.
+ *
+ * @param self The Logger_T instance.
+ * @param propagate false to stop records at the handlers of this logger.
+ */
+extern void Logger_setPropagate(Logger_T self, bool propagate);
+
 /**
  * Add a new handler to the specific logger.
  *
@@ -142,6 +228,53 @@ extern void Logger_setLevel(Logger_T self, Logger_Level_T level);
  */
 extern Logger_Handler_T Logger_addHandler(Logger_T self, Logger_Handler_T handler);
 
+/**
+ * Replace the level and the whole set of handlers of the logger at once.
+ * Logging threads never wait for it: each record is dispatched either to the previous set or to the new one,
+ * never to a mix of the two. When this function returns no thread is still publishing through the previous
+ * handlers, so those left out of the new set (and their formatters) can be deleted right away.
+ * The same holds for Logger_addHandler, Logger_removeHandler and Logger_popHandler, which must not be called
+ * from the publish callbacks of the handlers of the logger.
+ *
+ * Checked runtime errors:
+ *  - @param self must not be NULL.
+ *  - @param level must be in range LOGGER_LEVEL_DEBUG - LOGGER_LEVEL_FATAL.
+ *  - @param handlers must not be NULL unless handlersCount is 0, its items must not be NULL.
+ *
+ * @param self The Logger_T instance.
+ * @param level The level to set.
+ * @param handlers The handlers in dispatch order, the array is copied.
+ * @param handlersCount The number of handlers.
+ * @return `LOGGER_ERR_OK` or `LOGGER_ERR_OUT_OF_MEMORY`, in which case the logger is left unchanged.
+ */
+extern Logger_Err_T Logger_reconfigure(
+        Logger_T self, Logger_Level_T level, Logger_Handler_T const *handlers, size_t handlersCount
+);
+
+/**
+ * Like Logger_reconfigure, but only the handlers in previous are replaced: the set of the logger becomes handlers
+ * followed by the handlers it already had that are neither in previous nor in handlers, in their order.
+ * This lets a component swap the handlers it gave a logger without dropping those added by others meanwhile.
+ *
+ * Checked runtime errors:
+ *  - @param self must not be NULL.
+ *  - @param level must be in range LOGGER_LEVEL_DEBUG - LOGGER_LEVEL_FATAL.
+ *  - @param previous must not be NULL unless previousCount is 0.
+ *  - @param handlers must not be NULL unless handlersCount is 0, its items must not be NULL.
+ *
+ * @param self The Logger_T instance.
+ * @param level The level to set.
+ * @param previous The handlers to take out of the set.
+ * @param previousCount The number of handlers to take out.
+ * @param handlers The handlers to put first in the set, in dispatch order.
+ * @param handlersCount The number of handlers.
+ * @return `LOGGER_ERR_OK` or `LOGGER_ERR_OUT_OF_MEMORY`, in which case the logger is left unchanged.
+ */
+extern Logger_Err_T Logger_replaceHandlers(
+        Logger_T self, Logger_Level_T level, Logger_Handler_T const *previous, size_t previousCount,
+        Logger_Handler_T const *handlers, size_t handlersCount
+);
+
 /**
  * Check if a record with the given level would actually be logged by this logger.
  *
@@ -156,6 +289,9 @@ extern bool Logger_isLoggable(Logger_T self, Logger_Level_T level);
 
 /**
  * Log a Logger_Record_T.
+ * Records issued by call sites forced with Logger_CallSite_enable bypass the logger level.
+ * The record is handed to every handler, then to the handlers of the ancestors up to the first logger that
+ * does not propagate, even if some of them fail: the first error is returned.
  *
  * Checked runtime errors:
  *  - @param self must not be NULL.
@@ -173,34 +309,122 @@ extern Logger_Err_T Logger_logRecord(Logger_T self, Logger_Record_T record);
  *
  * Checked runtime errors:
  *  - @param self must not be NULL.
- *  - @param level must be in range LOGGER_LEVEL_DEBUG - LOGGER_LEVEL_FATAL.
- *  - @param file must not be NULL.
- *  - @param function must not be NULL.
- *  - @param fmt must not be NULL.
- *
- * @param self The Logger_T instance.
- * @param level The logging message level.
- * @param file The name of the file in which the logging request was issued.
- * @param line The line of the file in which the logging request was issued.
- * @param function The name of the function in which the logging request was issued.
- * @param timestamp The timestamp in which the logging request was issued (in milliseconds since 1970).
- * @param fmt The printf-like fmt string.
- * @param ...
+ *  - @param callSite must not be NULL.
+ *  - @param callSite->level must be in range LOGGER_LEVEL_DEBUG - LOGGER_LEVEL_FATAL.
+ *  - @param callSite->file must not be NULL.
+ *  - @param callSite->function must not be NULL.
+ *  - @param callSite->format must not be NULL.
+ *
+ * @param self The Logger_T instance.
+ * @param callSite The descriptor of the logging request, it must outlive the call.
+ * @param ... The arguments for the printf-like callSite->format string.
+ * @return The `LOGGER_ERR_OK` or the error code.
+ */
+extern Logger_Err_T _Logger_log(Logger_T self, Logger_CallSite_T *callSite, ...);
+
+/**
+ * Construct and log a Logger_Record_T carrying structured fields.
+ * This function should never be used directly, use the macros instead.
+ *
+ * Checked runtime errors:
+ *  - @param self must not be NULL.
+ *  - @param callSite must not be NULL.
+ *  - @param callSite->level must be in range LOGGER_LEVEL_DEBUG - LOGGER_LEVEL_FATAL.
+ *  - @param callSite->file must not be NULL.
+ *  - @param callSite->function must not be NULL.
+ *  - @param callSite->format must not be NULL.
+ *  - @param fields must not be NULL unless fieldsCount is 0.
+ *
+ * @param self The Logger_T instance.
+ * @param callSite The descriptor of the logging request, it must outlive the call.
+ *                 callSite->format is the message as is, it is not expanded.
+ * @param fields The fields attached to the record.
+ * @param fieldsCount The number of fields.
+ * @return The `LOGGER_ERR_OK` or the error code.
+ */
+extern Logger_Err_T _Logger_logFields(
+        Logger_T self, Logger_CallSite_T *callSite, const Logger_Field_T *fields, size_t fieldsCount
+);
+
+/**
+ * Render the message of a logging request in the arena of the calling thread (see logger_arena.h).
+ * The message must be the first block the renderer allocates: it is released along with the record.
+ *
+ * @param format The format of the call site.
+ * @param context The context given to _Logger_logRendered.
+ * @return The NUL terminated message or NULL on OOM.
+ */
+typedef char *Logger_Renderer_T(const char *format, const void *context);
+
+/**
+ * Construct and log a Logger_Record_T whose message is produced by renderer, which is called only if the
+ * request is actually logged. It lets front ends that know the types of their arguments (see logger.hpp)
+ * skip printf.
+ * This function should never be used directly.
+ *
+ * Checked runtime errors:
+ *  - @param self must not be NULL.
+ *  - @param callSite must not be NULL.
+ *  - @param callSite->level must be in range LOGGER_LEVEL_DEBUG - LOGGER_LEVEL_FATAL.
+ *  - @param callSite->file must not be NULL.
+ *  - @param callSite->function must not be NULL.
+ *  - @param callSite->format must not be NULL.
+ *  - @param renderer must not be NULL.
+ *
+ * @param self The Logger_T instance.
+ * @param callSite The descriptor of the logging request, it must outlive the call.
+ * @param renderer The Logger_Renderer_T producing the message.
+ * @param context The context handed to renderer, it must outlive the call.
  * @return The `LOGGER_ERR_OK` or the error code.
  */
-extern Logger_Err_T _Logger_log(
-        Logger_T self, Logger_Level_T level, const char *file, size_t line, const char *function, time_t timestamp,
-        const char *fmt, ...
+extern Logger_Err_T _Logger_logRendered(
+        Logger_T self, Logger_CallSite_T *callSite, Logger_Renderer_T *renderer, const void *context
 );
 
-#define _LOGGER_TRACE                         __FILE__, __LINE__, __func__, time(NULL)
-#define Logger_log(xSelf, xLevel, xFmt, ...)  _Logger_log(xSelf, xLevel, _LOGGER_TRACE, xFmt, __VA_ARGS__)
-#define Logger_logDebug(xSelf, xFmt, ...)     _Logger_log(xSelf, LOGGER_LEVEL_DEBUG, _LOGGER_TRACE, xFmt, __VA_ARGS__)
-#define Logger_logNotice(xSelf, xFmt, ...)    _Logger_log(xSelf, LOGGER_LEVEL_NOTICE, _LOGGER_TRACE, xFmt, __VA_ARGS__)
-#define Logger_logInfo(xSelf, xFmt, ...)      _Logger_log(xSelf, LOGGER_LEVEL_INFO, _LOGGER_TRACE, xFmt, __VA_ARGS__)
-#define Logger_logWarning(xSelf, xFmt, ...)   _Logger_log(xSelf, LOGGER_LEVEL_WARNING, _LOGGER_TRACE, xFmt, __VA_ARGS__)
-#define Logger_logError(xSelf, xFmt, ...)     _Logger_log(xSelf, LOGGER_LEVEL_ERROR, _LOGGER_TRACE, xFmt, __VA_ARGS__)
-#define Logger_logFatal(xSelf, xFmt, ...)     _Logger_log(xSelf, LOGGER_LEVEL_FATAL, _LOGGER_TRACE, xFmt, __VA_ARGS__)
+/*
+ * The logging macros declare a static Logger_CallSite_T for each call site, so the level and the format
+ * must be compile time constants (a Logger_Level_T value and a string literal).
+ * A call site disabled at runtime (see Logger_CallSite_disable) costs a single relaxed load.
+ * Compilers without GNU statement expressions get an automatic descriptor built at each call instead,
+ * such call sites are never registered and can not be toggled at runtime.
+ */
+#if defined(__GNUC__)
+#define _LOGGER_CALL(xSelf, xLevel, xFmt, xCall, ...)                                                   \
+    (__extension__ ({                                                                                   \
+        static Logger_CallSite_T _loggerCallSite = {                                                    \
+            __FILE__, __func__, xFmt, __LINE__, xLevel, LOGGER_CALLSITE_UNREGISTERED, NULL,             \
+            LOGGER_CALLSITE_LIMITS_INITIALIZER                                                          \
+        };                                                                                              \
+        LOGGER_CALLSITE_DISABLED != __atomic_load_n(&_loggerCallSite.state, __ATOMIC_RELAXED) ?         \
+            xCall(xSelf, &_loggerCallSite, __VA_ARGS__) : LOGGER_ERR_OK;                                \
+    }))
+#else
+#define _LOGGER_CALL(xSelf, xLevel, xFmt, xCall, ...)                                                   \
+    xCall(xSelf, &(Logger_CallSite_T) {                                                                 \
+        __FILE__, __func__, xFmt, __LINE__, xLevel, LOGGER_CALLSITE_DEFAULT, NULL,                      \
+        LOGGER_CALLSITE_LIMITS_INITIALIZER                                                              \
+    }, __VA_ARGS__)
+#endif
+
+#define _LOGGER_LOG(xSelf, xLevel, xFmt, ...)                                                           \
+    _LOGGER_CALL(xSelf, xLevel, xFmt, _Logger_log, __VA_ARGS__)
+
+/*
+ * The fields are gathered in an array built on the stack of the caller, at least one is required:
+ *  Logger_logFields(logger, LOGGER_LEVEL_INFO, "request served", LOGGER_INT("status", 200), LOGGER_STR("path", path));
+ */
+#define _LOGGER_LOG_FIELDS(xSelf, xLevel, xMessage, ...)                                                \
+    _LOGGER_CALL(xSelf, xLevel, xMessage, _Logger_logFields, ((const Logger_Field_T[]) {__VA_ARGS__}), \
+                 sizeof((const Logger_Field_T[]) {__VA_ARGS__}) / sizeof(Logger_Field_T))
+
+#define Logger_log(xSelf, xLevel, xFmt, ...)  _LOGGER_LOG(xSelf, xLevel, xFmt, __VA_ARGS__)
+#define Logger_logDebug(xSelf, xFmt, ...)     _LOGGER_LOG(xSelf, LOGGER_LEVEL_DEBUG, xFmt, __VA_ARGS__)
+#define Logger_logNotice(xSelf, xFmt, ...)    _LOGGER_LOG(xSelf, LOGGER_LEVEL_NOTICE, xFmt, __VA_ARGS__)
+#define Logger_logInfo(xSelf, xFmt, ...)      _LOGGER_LOG(xSelf, LOGGER_LEVEL_INFO, xFmt, __VA_ARGS__)
+#define Logger_logWarning(xSelf, xFmt, ...)   _LOGGER_LOG(xSelf, LOGGER_LEVEL_WARNING, xFmt, __VA_ARGS__)
+#define Logger_logError(xSelf, xFmt, ...)     _LOGGER_LOG(xSelf, LOGGER_LEVEL_ERROR, xFmt, __VA_ARGS__)
+#define Logger_logFatal(xSelf, xFmt, ...)     _LOGGER_LOG(xSelf, LOGGER_LEVEL_FATAL, xFmt, __VA_ARGS__)
+#define Logger_logFields(xSelf, xLevel, xMessage, ...)  _LOGGER_LOG_FIELDS(xSelf, xLevel, xMessage, __VA_ARGS__)
 
 #ifdef __cplusplus
 }
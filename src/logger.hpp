@@ -0,0 +1,921 @@
+/*
+ * C++ Header File
+ *
+ * Author: daddinuz
+ * email:  daddinuz@gmail.com
+ * Date:   October 19, 2026
+ */
+
+#ifndef LOGGER_LOGGER_HPP_INCLUDED
+#define LOGGER_LOGGER_HPP_INCLUDED
+
+#if __cplusplus < 201703L
+#error "logger.hpp requires C++17"
+#endif
+
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "logger.h"
+#include "logger_arena.h"
+#include "logger_builtin_formatters.h"
+#include "logger_builtin_handlers.h"
+
+/**
+ * A header-only C++ front end to the logging macros of logger.h:
+ *
+ *  logger::info(self, LOGGER_FORMAT("served %s in %u ms"), path, elapsed);
+ *  logger::log<LOGGER_LEVEL_WARNING>(self, LOGGER_FORMAT("%d retries left"), retries);
+ *
+ * The printf-like format is parsed at compile time: a malformed format or an argument whose type does not
+ * match its conversion fails to compile. Formats made only of plain conversions (no flags, width nor
+ * precision; %a, %p and %Lf excluded) take the fast path: the arguments are captured by type into an array
+ * of Logger_Field_T at the call site and the message is rendered with std::to_chars, only if the request is
+ * actually logged (see _Logger_logRendered). The other formats, or all of them when LOGGER_HPP_PRINTF is
+ * defined, go through _Logger_log. Both render the same message.
+ *
+ * Accepted arguments: integers for %d %i %u %o %x %X %c (of the size selected by the length modifier, after
+ * integer promotion), floating point numbers for %f %F %e %E %g %G %a %A, const char * and std::string
+ * for %s, pointers for %p.
+ *
+ * logger::Formatter, logger::Handler and logger::Logger own the C objects they wrap:
+ *
+ *  logger::Formatter formatter = logger::Formatter::simple();
+ *  logger::Logger self("app", LOGGER_LEVEL_INFO);
+ *  self.addHandler(logger::Handler::console(LOGGER_LEVEL_DEBUG, formatter, LOGGER_OSTREAM_STDOUT));
+ *  self.addHandler(logger::Handler::file(LOGGER_LEVEL_ERROR, formatter, "app.log"));
+ *
+ * Formatters and handlers are shared: copies retain the same object (see Logger_Formatter_retain), moves
+ * transfer the reference, the last one destructs it. A handler keeps its formatter alive. Constructors throw
+ * logger::Error on failure.
+ */
+
+/**
+ * Wrap a format string literal for the functions of logger.hpp, recording where it is used.
+ * Every expansion declares its own call site (see logger_callsite.h).
+ */
+#define LOGGER_FORMAT(xFmt)                                                                             \
+    (::logger::detail::makeFormat([] {                                                                  \
+        struct Source {                                                                                 \
+            static constexpr const char *string() { return xFmt; }                                      \
+            static constexpr const char *file() { return __FILE__; }                                    \
+            static constexpr std::size_t line() { return __LINE__; }                                    \
+        };                                                                                              \
+        return Source();                                                                                \
+    }(), __func__))
+
+namespace logger {
+
+/**
+ * A format string known at compile time, build it with LOGGER_FORMAT.
+ */
+template<typename Source>
+class Format {
+public:
+    explicit constexpr Format(const char *function) noexcept : function_(function) {}
+
+    constexpr const char *function() const noexcept {
+        return function_;
+    }
+
+private:
+    const char *function_;
+};
+
+namespace detail {
+
+template<typename Source>
+constexpr Format<Source> makeFormat(Source, const char *function) noexcept {
+    return Format<Source>(function);
+}
+
+/*
+ * Format parsing
+ */
+enum class Error {
+    None, Unterminated, Unsupported, TooFewArguments, TooManyArguments, WrongType
+};
+
+enum class Kind : unsigned char {
+    Percent, Signed, Unsigned, Char, Double, String, Pointer
+};
+
+enum class Length : unsigned char {
+    None, Char, Short, Long, LongLong, IntMax, Size, PtrDiff, LongDouble
+};
+
+/*
+ * A conversion and the literal text preceding it.
+ */
+struct Spec {
+    std::size_t literalBegin;
+    std::size_t literalLength;
+    Kind kind;
+    Length length;
+    char conversion;
+    bool plain;  /* neither flags, width nor precision */
+};
+
+template<std::size_t N>
+struct Parsed {
+    Spec specs[N > 0 ? N : 1];
+    std::size_t size;
+    std::size_t arguments;
+    std::size_t tailBegin;
+    std::size_t tailLength;
+    Error error;
+    bool plain;
+};
+
+constexpr bool isDigit(char c) {
+    return '0' <= c && c <= '9';
+}
+
+constexpr bool isFlag(char c) {
+    return '-' == c || '+' == c || ' ' == c || '#' == c || '0' == c;
+}
+
+constexpr std::size_t countSpecs(const char *format) {
+    std::size_t count = 0;
+    for (std::size_t i = 0; '\0' != format[i]; i++) {
+        if ('%' == format[i]) {
+            count++;
+            i += '%' == format[i + 1] ? 1 : 0;
+        }
+    }
+    return count;
+}
+
+constexpr Length parseLength(const char *format, std::size_t &i) {
+    switch (format[i]) {
+        case 'h':
+            if ('h' == format[i + 1]) {
+                i += 2;
+                return Length::Char;
+            }
+            i++;
+            return Length::Short;
+        case 'l':
+            if ('l' == format[i + 1]) {
+                i += 2;
+                return Length::LongLong;
+            }
+            i++;
+            return Length::Long;
+        case 'j':
+            i++;
+            return Length::IntMax;
+        case 'z':
+            i++;
+            return Length::Size;
+        case 't':
+            i++;
+            return Length::PtrDiff;
+        case 'L':
+            i++;
+            return Length::LongDouble;
+        default:
+            return Length::None;
+    }
+}
+
+template<std::size_t N>
+constexpr Parsed<N> parse(const char *format) {
+    Parsed<N> self{};
+    std::size_t literal = 0;
+    std::size_t i = 0;
+    self.plain = true;
+    self.error = Error::None;
+
+    while ('\0' != format[i]) {
+        if ('%' != format[i]) {
+            i++;
+            continue;
+        }
+        Spec &spec = self.specs[self.size++];
+        spec.literalBegin = literal;
+        spec.literalLength = i - literal;
+        spec.length = Length::None;
+        spec.plain = true;
+        i++;
+        if ('%' == format[i]) {
+            spec.kind = Kind::Percent;
+            spec.conversion = '%';
+            literal = ++i;
+            continue;
+        }
+        for (; isFlag(format[i]); i++) {
+            spec.plain = false;
+        }
+        for (; isDigit(format[i]); i++) {
+            spec.plain = false;
+        }
+        if ('.' == format[i]) {
+            spec.plain = false;
+            for (i++; isDigit(format[i]); i++) {
+            }
+        }
+        if ('*' == format[i]) {
+            self.error = Error::Unsupported;
+            return self;
+        }
+
+        spec.length = parseLength(format, i);
+        spec.conversion = format[i];
+        switch (format[i]) {
+            case 'd':
+            case 'i':
+                spec.kind = Kind::Signed;
+                break;
+            case 'u':
+            case 'o':
+            case 'x':
+            case 'X':
+                spec.kind = Kind::Unsigned;
+                break;
+            case 'c':
+                spec.kind = Kind::Char;
+                break;
+            case 'f':
+            case 'F':
+            case 'e':
+            case 'E':
+            case 'g':
+            case 'G':
+                spec.kind = Kind::Double;
+                break;
+            case 'a':
+            case 'A':
+                spec.kind = Kind::Double;
+                spec.plain = false;
+                break;
+            case 's':
+                spec.kind = Kind::String;
+                break;
+            case 'p':
+                spec.kind = Kind::Pointer;
+                spec.plain = false;
+                break;
+            case '\0':
+                self.error = Error::Unterminated;
+                return self;
+            default:
+                self.error = Error::Unsupported;
+                return self;
+        }
+        switch (spec.kind) {
+            case Kind::Signed:
+            case Kind::Unsigned:
+                if (Length::LongDouble == spec.length) {
+                    self.error = Error::Unsupported;
+                }
+                break;
+            case Kind::Double:
+                if (Length::None != spec.length && Length::Long != spec.length && Length::LongDouble != spec.length) {
+                    self.error = Error::Unsupported;
+                }
+                spec.plain = spec.plain && Length::LongDouble != spec.length;
+                break;
+            default:
+                if (Length::None != spec.length) {
+                    self.error = Error::Unsupported;  /* wide characters and strings */
+                }
+                break;
+        }
+        if (Error::None != self.error) {
+            return self;
+        }
+        self.arguments++;
+        self.plain = self.plain && spec.plain;
+        literal = ++i;
+    }
+    self.tailBegin = literal;
+    self.tailLength = i - literal;
+    return self;
+}
+
+/*
+ * Argument checking
+ */
+template<typename T>
+using Decay = std::remove_cv_t<std::decay_t<T>>;
+
+/*
+ * The type of an integer after integer promotion, as passed to printf.
+ */
+template<typename T>
+using Promoted = std::conditional_t<(sizeof(T) < sizeof(int)), int, T>;
+
+constexpr std::size_t expectedSize(Length length) {
+    switch (length) {
+        case Length::Long:
+            return sizeof(long);
+        case Length::LongLong:
+            return sizeof(long long);
+        case Length::IntMax:
+            return sizeof(std::intmax_t);
+        case Length::Size:
+            return sizeof(std::size_t);
+        case Length::PtrDiff:
+            return sizeof(std::ptrdiff_t);
+        default:
+            return sizeof(int);
+    }
+}
+
+template<typename T>
+constexpr bool isString() {
+    return std::is_same_v<T, const char *> || std::is_same_v<T, char *> || std::is_same_v<T, std::string>;
+}
+
+template<typename T>
+constexpr bool accepts(const Spec &spec) {
+    switch (spec.kind) {
+        case Kind::Signed:
+        case Kind::Unsigned:
+        case Kind::Char:
+            if constexpr (std::is_integral_v<T>) {
+                return sizeof(Promoted<T>) == expectedSize(spec.length);
+            } else {
+                return false;
+            }
+        case Kind::Double:
+            return std::is_floating_point_v<T> &&
+                   (Length::LongDouble == spec.length) == std::is_same_v<T, long double>;
+        case Kind::String:
+            return isString<T>();
+        case Kind::Pointer:
+            return std::is_pointer_v<T> || std::is_null_pointer_v<T>;
+        default:
+            return false;
+    }
+}
+
+/*
+ * Get the index of the spec of the index-th argument.
+ */
+template<std::size_t N>
+constexpr std::size_t argumentSpec(const Parsed<N> &parsed, std::size_t index) {
+    for (std::size_t i = 0; i < parsed.size; i++) {
+        if (Kind::Percent != parsed.specs[i].kind && 0 == index--) {
+            return i;
+        }
+    }
+    return 0;
+}
+
+template<typename... Args, std::size_t N, std::size_t... I>
+constexpr Error check(const Parsed<N> &parsed, std::index_sequence<I...>) {
+    if (Error::None != parsed.error) {
+        return parsed.error;
+    }
+    if (sizeof...(Args) < parsed.arguments) {
+        return Error::TooFewArguments;
+    }
+    if (sizeof...(Args) > parsed.arguments) {
+        return Error::TooManyArguments;
+    }
+    return (accepts<Args>(parsed.specs[argumentSpec(parsed, I)]) && ... && true) ? Error::None : Error::WrongType;
+}
+
+template<typename Source, typename... Args>
+struct Checked {
+    static constexpr auto parsed = parse<countSpecs(Source::string())>(Source::string());
+    static constexpr Error error = check<Args...>(parsed, std::index_sequence_for<Args...>());
+
+    static_assert(Error::Unterminated != error, "logger.hpp: the format ends in the middle of a conversion");
+    static_assert(Error::Unsupported != error, "logger.hpp: the format has an unsupported conversion");
+    static_assert(Error::TooFewArguments != error, "logger.hpp: the format has more conversions than arguments");
+    static_assert(Error::TooManyArguments != error, "logger.hpp: the format has fewer conversions than arguments");
+    static_assert(Error::WrongType != error, "logger.hpp: an argument does not match its conversion");
+};
+
+/*
+ * Capture
+ */
+template<typename Checked, std::size_t I, typename T>
+inline Logger_Field_T capture(const T &value) {
+    constexpr Spec spec = Checked::parsed.specs[argumentSpec(Checked::parsed, I)];
+    Logger_Field_T field{};
+    if constexpr (std::is_integral_v<T>) {
+        /* as printf does, read the value as the type selected by the length modifier */
+        if constexpr (Kind::Signed == spec.kind) {
+            field.type = LOGGER_FIELD_TYPE_INT;
+            switch (spec.length) {
+                case Length::Char:
+                    field.value.asInt = static_cast<signed char>(value);
+                    break;
+                case Length::Short:
+                    field.value.asInt = static_cast<short>(value);
+                    break;
+                case Length::None:
+                    field.value.asInt = static_cast<int>(value);
+                    break;
+                default:
+                    field.value.asInt = static_cast<std::make_signed_t<Promoted<T>>>(value);
+                    break;
+            }
+        } else if constexpr (Kind::Unsigned == spec.kind) {
+            field.type = LOGGER_FIELD_TYPE_UINT;
+            switch (spec.length) {
+                case Length::Char:
+                    field.value.asUint = static_cast<unsigned char>(value);
+                    break;
+                case Length::Short:
+                    field.value.asUint = static_cast<unsigned short>(value);
+                    break;
+                case Length::None:
+                    field.value.asUint = static_cast<unsigned>(value);
+                    break;
+                default:
+                    field.value.asUint = static_cast<std::make_unsigned_t<Promoted<T>>>(value);
+                    break;
+            }
+        } else {
+            field.type = LOGGER_FIELD_TYPE_INT;
+            field.value.asInt = static_cast<unsigned char>(value);
+        }
+    } else if constexpr (std::is_floating_point_v<T>) {
+        field.type = LOGGER_FIELD_TYPE_DOUBLE;
+        field.value.asDouble = static_cast<double>(value);
+    } else if constexpr (std::is_same_v<T, std::string>) {
+        field.type = LOGGER_FIELD_TYPE_STR;
+        field.value.asStr = value.c_str();
+    } else {
+        field.type = LOGGER_FIELD_TYPE_STR;
+        field.value.asStr = value;
+    }
+    return field;
+}
+
+/*
+ * Rendering
+ */
+class Writer {
+public:
+    Writer(char *data, std::size_t capacity) noexcept : data_(data), capacity_(capacity), size_(0) {}
+
+    /*
+     * Pieces that do not fit are only counted.
+     */
+    void append(const char *piece, std::size_t length) noexcept {
+        if (size_ + length <= capacity_) {
+            std::memcpy(data_ + size_, piece, length);
+        }
+        size_ += length;
+    }
+
+    std::size_t size() const noexcept {
+        return size_;
+    }
+
+private:
+    char *data_;
+    std::size_t capacity_;
+    std::size_t size_;
+};
+
+inline void appendUppercase(Writer &writer, char *begin, char *end) {
+    for (char *p = begin; p < end; p++) {
+        *p = 'a' <= *p && *p <= 'z' ? static_cast<char>(*p - 'a' + 'A') : *p;
+    }
+    writer.append(begin, static_cast<std::size_t>(end - begin));
+}
+
+inline void appendValue(Writer &writer, const Spec &spec, const Logger_Field_T &field) {
+    char buffer[512];  /* large enough for DBL_MAX as %f */
+    char *const end = buffer + sizeof(buffer);
+    switch (spec.kind) {
+        case Kind::Signed:
+            writer.append(buffer, static_cast<std::size_t>(std::to_chars(buffer, end, field.value.asInt).ptr - buffer));
+            break;
+        case Kind::Unsigned: {
+            const int base = 'o' == spec.conversion ? 8 : 'u' == spec.conversion ? 10 : 16;
+            char *const last = std::to_chars(buffer, end, field.value.asUint, base).ptr;
+            if ('X' == spec.conversion) {
+                appendUppercase(writer, buffer, last);
+            } else {
+                writer.append(buffer, static_cast<std::size_t>(last - buffer));
+            }
+            break;
+        }
+        case Kind::Char:
+            buffer[0] = static_cast<char>(field.value.asInt);
+            writer.append(buffer, 1);
+            break;
+        case Kind::Double: {
+            const char conversion = static_cast<char>(spec.conversion | 0x20);  /* lowercase */
+            const std::chars_format format = 'f' == conversion ? std::chars_format::fixed :
+                                             'e' == conversion ? std::chars_format::scientific :
+                                             std::chars_format::general;
+            char *const last = std::to_chars(buffer, end, field.value.asDouble, format, 6).ptr;
+            if (conversion == spec.conversion) {
+                writer.append(buffer, static_cast<std::size_t>(last - buffer));
+            } else {
+                appendUppercase(writer, buffer, last);
+            }
+            break;
+        }
+        case Kind::String: {
+            const char *string = field.value.asStr ? field.value.asStr : "(null)";
+            writer.append(string, std::strlen(string));
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+template<typename Checked>
+void write(Writer &writer, const char *format, const Logger_Field_T *fields) {
+    constexpr auto &parsed = Checked::parsed;
+    for (std::size_t i = 0, argument = 0; i < parsed.size; i++) {
+        const Spec &spec = parsed.specs[i];
+        writer.append(format + spec.literalBegin, spec.literalLength);
+        if (Kind::Percent == spec.kind) {
+            writer.append("%", 1);
+        } else {
+            appendValue(writer, spec, fields[argument++]);
+        }
+    }
+    writer.append(format + parsed.tailBegin, parsed.tailLength);
+}
+
+/*
+ * A Logger_Renderer_T: short messages are rendered once on the stack, longer ones are measured first.
+ */
+template<typename Checked>
+char *render(const char *format, const void *context) {
+    const Logger_Field_T *fields = static_cast<const Logger_Field_T *>(context);
+    char buffer[256];
+    Writer writer(buffer, sizeof(buffer));
+    write<Checked>(writer, format, fields);
+
+    const std::size_t size = writer.size();
+    char *message = static_cast<char *>(Logger_Arena_allocate(size + 1));
+    if (!message) {
+        return nullptr;
+    }
+    if (size <= sizeof(buffer)) {
+        std::memcpy(message, buffer, size);
+    } else {
+        Writer again(message, size);
+        write<Checked>(again, format, fields);
+    }
+    message[size] = '\0';
+    return message;
+}
+
+template<typename Checked, std::size_t... I, typename... Args>
+inline Logger_Err_T logRendered(
+        Logger_T self, Logger_CallSite_T *callSite, std::index_sequence<I...>, const Args &... args
+) {
+    const Logger_Field_T fields[sizeof...(Args) + 1] = {capture<Checked, I>(args)..., Logger_Field_T{}};
+    return _Logger_logRendered(self, callSite, render<Checked>, fields);
+}
+
+template<typename T>
+inline auto vararg(const T &value) {
+    if constexpr (std::is_same_v<T, std::string>) {
+        return value.c_str();
+    } else if constexpr (std::is_array_v<T>) {
+        return static_cast<const std::remove_extent_t<T> *>(value);
+    } else {
+        return value;
+    }
+}
+
+}  /* namespace detail */
+
+/**
+ * The exception thrown by the constructors of the handles below.
+ */
+class Error : public std::exception {
+public:
+    explicit Error(Logger_Err_T err) noexcept : err_(err) {}
+
+    Logger_Err_T err() const noexcept {
+        return err_;
+    }
+
+    const char *what() const noexcept override {
+        return Logger_Err_gerString(err_);
+    }
+
+private:
+    Logger_Err_T err_;
+};
+
+namespace detail {
+
+/**
+ * A counted reference to a C object, null only once moved from.
+ */
+template<typename T, T (*Retain)(T), void (*Release)(T *)>
+class Reference {
+public:
+    explicit Reference(T self) : self_(self) {
+        if (!self_) {
+            throw Error(LOGGER_ERR_OUT_OF_MEMORY);
+        }
+    }
+
+    Reference(const Reference &other) noexcept : self_(other.self_ ? Retain(other.self_) : nullptr) {}
+
+    Reference(Reference &&other) noexcept : self_(std::exchange(other.self_, nullptr)) {}
+
+    Reference &operator=(Reference other) noexcept {
+        std::swap(self_, other.self_);
+        return *this;
+    }
+
+    ~Reference() {
+        if (self_) {
+            Release(&self_);
+        }
+    }
+
+    T get() const noexcept {
+        return self_;
+    }
+
+private:
+    T self_;
+};
+
+}  /* namespace detail */
+
+/**
+ * A shared Logger_Formatter_T.
+ */
+class Formatter {
+public:
+    /**
+     * Adopt formatter, taking over the reference it was created with.
+     *
+     * @param formatter The Logger_Formatter_T instance, NULL throws LOGGER_ERR_OUT_OF_MEMORY.
+     */
+    explicit Formatter(Logger_Formatter_T formatter) : self_(formatter) {}
+
+    static Formatter simple() {
+        return Formatter(Logger_Formatter_newSimpleFormatter());
+    }
+
+    static Formatter json() {
+        return Formatter(Logger_Formatter_newJsonFormatter());
+    }
+
+    static Formatter logfmt() {
+        return Formatter(Logger_Formatter_newLogfmtFormatter());
+    }
+
+    static Formatter binary() {
+        return Formatter(Logger_Formatter_newBinaryFormatter());
+    }
+
+    Logger_Formatter_T get() const noexcept {
+        return self_.get();
+    }
+
+private:
+    detail::Reference<Logger_Formatter_T, Logger_Formatter_retain, Logger_Formatter_release> self_;
+};
+
+/**
+ * A shared Logger_Handler_T, along with a reference to its formatter.
+ */
+class Handler {
+public:
+    /**
+     * Adopt handler, taking over the reference it was created with.
+     *
+     * @param handler The Logger_Handler_T instance, NULL throws LOGGER_ERR_OUT_OF_MEMORY.
+     * @param formatter The formatter used by handler.
+     */
+    Handler(Logger_Handler_T handler, Formatter formatter) : formatter_(std::move(formatter)), self_(handler) {}
+
+    static Handler console(Logger_Level_T level, Formatter formatter, Logger_OStream_T stream) {
+        const Logger_Handler_Result_T result = Logger_Handler_newConsoleHandler(level, formatter.get(), stream);
+        return adopt(result, std::move(formatter));
+    }
+
+    static Handler file(Logger_Level_T level, Formatter formatter, const char *filePath) {
+        const Logger_Handler_Result_T result = Logger_Handler_newFileHandler(level, formatter.get(), filePath);
+        return adopt(result, std::move(formatter));
+    }
+
+    /**
+     * filePath is retained, it must outlive the handler.
+     */
+    static Handler rotatingFile(
+            Logger_Level_T level, Formatter formatter, const char *filePath, std::size_t bytesBeforeRotation
+    ) {
+        const Logger_Handler_Result_T result = Logger_Handler_newRotatingFileHandler(
+                level, formatter.get(), filePath, bytesBeforeRotation
+        );
+        return adopt(result, std::move(formatter));
+    }
+
+    static Handler memoryFile(
+            Logger_Level_T level, Formatter formatter, const char *filePath, std::size_t bytesBeforeWrite
+    ) {
+        const Logger_Handler_Result_T result = Logger_Handler_newMemoryFileHandler(
+                level, formatter.get(), filePath, bytesBeforeWrite
+        );
+        return adopt(result, std::move(formatter));
+    }
+
+    static Handler compressedFile(
+            Logger_Level_T level, Formatter formatter, const char *filePath, Logger_Compress_Codec_T codec,
+            std::size_t blockSize
+    ) {
+        const Logger_Handler_Result_T result = Logger_Handler_newCompressedFileHandler(
+                level, formatter.get(), filePath, codec, blockSize
+        );
+        return adopt(result, std::move(formatter));
+    }
+
+    Logger_Handler_T get() const noexcept {
+        return self_.get();
+    }
+
+    const Formatter &formatter() const noexcept {
+        return formatter_;
+    }
+
+private:
+    static Handler adopt(Logger_Handler_Result_T result, Formatter formatter) {
+        if (LOGGER_ERR_OK != result.err) {
+            throw Error(result.err);
+        }
+        return Handler(result.handler, std::move(formatter));
+    }
+
+    Formatter formatter_;  /* declared first, destructed after the handler that may format while closing */
+    detail::Reference<Logger_Handler_T, Logger_Handler_retain, Logger_Handler_release> self_;
+};
+
+/**
+ * An owned Logger_T, holding a reference to each of its handlers.
+ * It converts to Logger_T so it can be passed to the logging functions.
+ */
+class Logger {
+public:
+    Logger(const std::string &name, Logger_Level_T level) : name_(new char[name.size() + 1]) {
+        std::memcpy(name_.get(), name.c_str(), name.size() + 1);
+        self_ = Logger_new(name_.get(), level);
+        if (!self_) {
+            throw Error(LOGGER_ERR_OUT_OF_MEMORY);
+        }
+    }
+
+    Logger(const Logger &) = delete;
+
+    Logger(Logger &&other) noexcept
+            : name_(std::move(other.name_)), handlers_(std::move(other.handlers_)),
+              self_(std::exchange(other.self_, nullptr)) {}
+
+    Logger &operator=(const Logger &) = delete;
+
+    Logger &operator=(Logger &&other) noexcept {
+        if (this != &other) {
+            destroy();
+            name_ = std::move(other.name_);
+            handlers_ = std::move(other.handlers_);
+            self_ = std::exchange(other.self_, nullptr);
+        }
+        return *this;
+    }
+
+    ~Logger() {
+        destroy();
+    }
+
+    /**
+     * Add handler, see Logger_addHandler.
+     */
+    Logger &addHandler(Handler handler) {
+        handlers_.push_back(std::move(handler));
+        if (!Logger_addHandler(self_, handlers_.back().get())) {
+            handlers_.pop_back();
+            throw Error(LOGGER_ERR_OUT_OF_MEMORY);
+        }
+        return *this;
+    }
+
+    /**
+     * Remove handler, see Logger_removeHandler.
+     *
+     * @return true if handler was a handler of the logger.
+     */
+    bool removeHandler(const Handler &handler) {
+        if (!Logger_removeHandler(self_, handler.get())) {
+            return false;
+        }
+        for (auto it = handlers_.begin(); it != handlers_.end(); ++it) {
+            if (it->get() == handler.get()) {
+                handlers_.erase(it);
+                break;
+            }
+        }
+        return true;
+    }
+
+    Logger_T get() const noexcept {
+        return self_;
+    }
+
+    operator Logger_T() const noexcept {
+        return self_;
+    }
+
+private:
+    void destroy() noexcept {
+        if (self_) {
+            while (Logger_popHandler(self_)) {}  /* returns once no thread is publishing, handlers_ go next */
+            Logger_delete(&self_);
+        }
+        handlers_.clear();
+    }
+
+    std::unique_ptr<char[]> name_;  /* Logger_T does not copy its name */
+    std::vector<Handler> handlers_;
+    Logger_T self_;
+};
+
+/**
+ * Log a message, see LOGGER_FORMAT.
+ *
+ * Checked runtime errors:
+ *  - @param self must not be NULL.
+ *
+ * @tparam Level The level of the message.
+ * @param self The Logger_T instance.
+ * @param format The format built with LOGGER_FORMAT.
+ * @param args The arguments of the format.
+ * @return The `LOGGER_ERR_OK` or the error code.
+ */
+template<Logger_Level_T Level, typename Source, typename... Args>
+inline Logger_Err_T log(Logger_T self, Format<Source> format, const Args &... args) {
+    static_assert(LOGGER_LEVEL_DEBUG <= Level && Level <= LOGGER_LEVEL_FATAL, "logger.hpp: invalid level");
+    using Checked = detail::Checked<Source, detail::Decay<Args>...>;
+
+    if constexpr (detail::Error::None != Checked::error) {
+        return LOGGER_ERR_UNKNOWN;  /* not reached, Checked does not compile */
+    } else {
+        static Logger_CallSite_T callSite = {
+                Source::file(), format.function(), Source::string(), Source::line(), Level,
+                LOGGER_CALLSITE_UNREGISTERED, nullptr, LOGGER_CALLSITE_LIMITS_INITIALIZER
+        };
+        if (LOGGER_CALLSITE_DISABLED == __atomic_load_n(&callSite.state, __ATOMIC_RELAXED)) {
+            return LOGGER_ERR_OK;
+        }
+#ifndef LOGGER_HPP_PRINTF
+        if constexpr (Checked::parsed.plain) {
+            return detail::logRendered<Checked>(self, &callSite, std::index_sequence_for<Args...>(), args...);
+        }
+#endif
+        return _Logger_log(self, &callSite, detail::vararg(args)...);
+    }
+}
+
+template<typename Source, typename... Args>
+inline Logger_Err_T debug(Logger_T self, Format<Source> format, const Args &... args) {
+    return log<LOGGER_LEVEL_DEBUG>(self, format, args...);
+}
+
+template<typename Source, typename... Args>
+inline Logger_Err_T notice(Logger_T self, Format<Source> format, const Args &... args) {
+    return log<LOGGER_LEVEL_NOTICE>(self, format, args...);
+}
+
+template<typename Source, typename... Args>
+inline Logger_Err_T info(Logger_T self, Format<Source> format, const Args &... args) {
+    return log<LOGGER_LEVEL_INFO>(self, format, args...);
+}
+
+template<typename Source, typename... Args>
+inline Logger_Err_T warning(Logger_T self, Format<Source> format, const Args &... args) {
+    return log<LOGGER_LEVEL_WARNING>(self, format, args...);
+}
+
+template<typename Source, typename... Args>
+inline Logger_Err_T error(Logger_T self, Format<Source> format, const Args &... args) {
+    return log<LOGGER_LEVEL_ERROR>(self, format, args...);
+}
+
+template<typename Source, typename... Args>
+inline Logger_Err_T fatal(Logger_T self, Format<Source> format, const Args &... args) {
+    return log<LOGGER_LEVEL_FATAL>(self, format, args...);
+}
+
+}  /* namespace logger */
+
+#endif /* LOGGER_LOGGER_HPP_INCLUDED */
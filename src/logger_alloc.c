@@ -0,0 +1,84 @@
+/*
+ * C Source File
+ *
+ * Author: daddinuz
+ * email:  daddinuz@gmail.com
+ * Date:   October 19, 2026
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include "logger_alloc.h"
+
+static void *defaultMalloc(size_t size, void *userdata) {
+    (void) userdata;
+    return malloc(size);
+}
+
+static void *defaultRealloc(void *ptr, size_t size, void *userdata) {
+    (void) userdata;
+    return realloc(ptr, size);
+}
+
+static void defaultFree(void *ptr, void *userdata) {
+    (void) userdata;
+    free(ptr);
+}
+
+static Logger_Alloc_MallocCallback_T *gMalloc = defaultMalloc;
+static Logger_Alloc_ReallocCallback_T *gRealloc = defaultRealloc;
+static Logger_Alloc_FreeCallback_T *gFree = defaultFree;
+static void *gUserdata = NULL;
+
+void Logger_setAllocator(
+        Logger_Alloc_MallocCallback_T mallocCallback, Logger_Alloc_ReallocCallback_T reallocCallback,
+        Logger_Alloc_FreeCallback_T freeCallback, void *userdata
+) {
+    const bool custom = NULL != mallocCallback;
+    assert(custom == (NULL != reallocCallback));
+    assert(custom == (NULL != freeCallback));
+    gMalloc = custom ? mallocCallback : defaultMalloc;
+    gRealloc = custom ? reallocCallback : defaultRealloc;
+    gFree = custom ? freeCallback : defaultFree;
+    gUserdata = custom ? userdata : NULL;
+}
+
+void *Logger_Alloc_malloc(size_t size) {
+    return gMalloc(size, gUserdata);
+}
+
+void *Logger_Alloc_calloc(size_t count, size_t size) {
+    if (size > 0 && count > SIZE_MAX / size) {
+        return NULL;
+    }
+    void *ptr = gMalloc(count * size, gUserdata);
+    if (ptr) {
+        memset(ptr, 0, count * size);
+    }
+    return ptr;
+}
+
+void *Logger_Alloc_realloc(void *ptr, size_t size) {
+    return gRealloc(ptr, size, gUserdata);
+}
+
+void Logger_Alloc_free(void *ptr) {
+    gFree(ptr, gUserdata);
+}
+
+Logger_Alloc_Allocator_T Logger_Alloc_getAllocator(void) {
+    return (Logger_Alloc_Allocator_T) {.freeCallback=gFree, .userdata=gUserdata};
+}
+
+bool Logger_Alloc_isCurrent(const Logger_Alloc_Allocator_T *allocator) {
+    assert(allocator);
+    return allocator->freeCallback == gFree && allocator->userdata == gUserdata;
+}
+
+void Logger_Alloc_freeWith(const Logger_Alloc_Allocator_T *allocator, void *ptr) {
+    assert(allocator);
+    allocator->freeCallback(ptr, allocator->userdata);
+}
@@ -0,0 +1,89 @@
+/*
+ * C Header File
+ *
+ * Author: daddinuz
+ * email:  daddinuz@gmail.com
+ * Date:   October 19, 2026
+ */
+
+#ifndef LOGGER_LOGGER_ALLOC_INCLUDED
+#define LOGGER_LOGGER_ALLOC_INCLUDED
+
+#include <stddef.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * The functions with this signature are used to allocate memory, as malloc does.
+ * They receive the userdata given to Logger_setAllocator.
+ */
+typedef void *Logger_Alloc_MallocCallback_T(size_t size, void *userdata);
+
+/**
+ * The functions with this signature are used to resize an allocation, as realloc does.
+ * They receive the userdata given to Logger_setAllocator.
+ */
+typedef void *Logger_Alloc_ReallocCallback_T(void *ptr, size_t size, void *userdata);
+
+/**
+ * The functions with this signature are used to release an allocation, as free does.
+ * They must accept NULL and receive the userdata given to Logger_setAllocator.
+ */
+typedef void Logger_Alloc_FreeCallback_T(void *ptr, void *userdata);
+
+/**
+ * Set the allocator used by the whole library, sds strings included.
+ * Passing NULL for all the callbacks restores the standard library allocator.
+ *
+ * The allocator is not switched atomically: it must be set before the library allocates anything
+ * or after everything it allocated has been released, since memory is always given back to the
+ * allocator in use at the time it is released. The caches the library keeps for each thread (the arena
+ * and the output buffer of the formatters) are the exception: they are given back to the allocator
+ * that allocated them, and replaced on their next use after a swap.
+ *
+ * Checked runtime errors:
+ *  - @param mallocCallback, @param reallocCallback and @param freeCallback must be either all NULL or all not NULL.
+ *
+ * @param mallocCallback The allocation function.
+ * @param reallocCallback The reallocation function.
+ * @param freeCallback The deallocation function.
+ * @param userdata Passed as is to the callbacks, may be NULL.
+ */
+extern void Logger_setAllocator(
+        Logger_Alloc_MallocCallback_T mallocCallback, Logger_Alloc_ReallocCallback_T reallocCallback,
+        Logger_Alloc_FreeCallback_T freeCallback, void *userdata
+);
+
+/**
+ * The allocator a cache of the library was allocated with, see Logger_Alloc_getAllocator.
+ */
+typedef struct Logger_Alloc_Allocator_T {
+    Logger_Alloc_FreeCallback_T *freeCallback;
+    void *userdata;
+} Logger_Alloc_Allocator_T;
+
+/*
+ * Caches that outlive an allocator swap record the allocator in use when they are allocated,
+ * check it before growing and give their memory back to it.
+ */
+extern Logger_Alloc_Allocator_T Logger_Alloc_getAllocator(void);
+extern bool Logger_Alloc_isCurrent(const Logger_Alloc_Allocator_T *allocator);
+extern void Logger_Alloc_freeWith(const Logger_Alloc_Allocator_T *allocator, void *ptr);
+
+/*
+ * Every allocation made by the library, sds strings included (see deps/sds/sdsalloc.h),
+ * goes through these functions. They behave as their standard library counterparts.
+ */
+extern void *Logger_Alloc_malloc(size_t size);
+extern void *Logger_Alloc_calloc(size_t count, size_t size);
+extern void *Logger_Alloc_realloc(void *ptr, size_t size);
+extern void Logger_Alloc_free(void *ptr);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LOGGER_LOGGER_ALLOC_INCLUDED */
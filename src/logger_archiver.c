@@ -0,0 +1,280 @@
+/*
+ * C Source File
+ *
+ * Author: daddinuz
+ * email:  daddinuz@gmail.com
+ * Date:   October 19, 2026
+ */
+
+#include <errno.h>
+#include <assert.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+#include "logger_alloc.h"
+#include "logger_archiver.h"
+#ifdef LOGGER_ZLIB
+#include <zlib.h>
+#endif
+
+#define ARCHIVE_BLOCK_SIZE (64 * 1024)
+
+/*
+ * queue is a ring of capacity paths starting at head, guarded by mutex along with everything but codec.
+ */
+struct Logger_Archiver_T {
+    Logger_Compress_Codec_T codec;
+    pthread_mutex_t mutex;
+    pthread_cond_t changed;
+    char **queue;
+    size_t capacity;
+    size_t head;
+    size_t size;
+    size_t busy;
+    bool stopping;
+    Logger_Archiver_Stats_T stats;
+    size_t threadsCount;
+    pthread_t threads[];
+};
+
+static char *concat(const char *prefix, const char *suffix) {
+    const size_t prefixLength = strlen(prefix);
+    const size_t suffixLength = strlen(suffix);
+    char *result = Logger_Alloc_malloc(prefixLength + suffixLength + 1);
+    if (result) {
+        memcpy(result, prefix, prefixLength);
+        memcpy(result + prefixLength, suffix, suffixLength + 1);
+    }
+    return result;
+}
+
+/*
+ * Compress source into target as a sequence of blocks.
+ */
+static bool compressToBlocks(FILE *source, const char *target) {
+    bool ok = false;
+    FILE *out = fopen(target, "wb");
+    unsigned char *block = Logger_Alloc_malloc(ARCHIVE_BLOCK_SIZE);
+    unsigned char *output = Logger_Alloc_malloc(LOGGER_COMPRESS_HEADER_SIZE + ARCHIVE_BLOCK_SIZE);
+    if (out && block && output) {
+        size_t read;
+        ok = true;
+        while (ok && (read = fread(block, 1, ARCHIVE_BLOCK_SIZE, source)) > 0) {
+            const size_t size = Logger_Compress_encodeBlock(LOGGER_COMPRESS_CODEC_LZ, block, read, output);
+            ok = fwrite(output, 1, size, out) == size;
+        }
+        ok = ok && !ferror(source);
+    }
+    if (out) {
+        ok = 0 == fclose(out) && ok;
+    }
+    Logger_Alloc_free(block);
+    Logger_Alloc_free(output);
+    return ok;
+}
+
+#ifdef LOGGER_ZLIB
+
+/*
+ * Compress source into target as a gzip file.
+ */
+static bool compressToGzip(FILE *source, const char *target) {
+    bool ok = false;
+    gzFile out = gzopen(target, "wb1");
+    unsigned char *block = Logger_Alloc_malloc(ARCHIVE_BLOCK_SIZE);
+    if (out && block) {
+        size_t read;
+        ok = true;
+        while (ok && (read = fread(block, 1, ARCHIVE_BLOCK_SIZE, source)) > 0) {
+            ok = gzwrite(out, block, (unsigned) read) == (int) read;
+        }
+        ok = ok && !ferror(source);
+    }
+    if (out) {
+        ok = Z_OK == gzclose(out) && ok;
+    }
+    Logger_Alloc_free(block);
+    return ok;
+}
+
+#endif
+
+/*
+ * Link temporary as path followed by extension, or as path.1, path.2 and so on followed by extension
+ * if that name is taken: an existing archive is never overwritten.
+ */
+static bool publishArchive(const char *temporary, const char *path, const char *extension) {
+    bool ok = false;
+    char *target = concat(path, extension);
+    for (size_t i = 1; target && !(ok = 0 == link(temporary, target)) && EEXIST == errno; i++) {
+        const int length = snprintf(NULL, 0, "%s.%zu%s", path, i, extension);
+        Logger_Alloc_free(target);
+        target = length > 0 ? Logger_Alloc_malloc((size_t) length + 1) : NULL;
+        if (target) {
+            snprintf(target, (size_t) length + 1, "%s.%zu%s", path, i, extension);
+        }
+    }
+    Logger_Alloc_free(target);
+    return ok;
+}
+
+/*
+ * Compress path next to it and remove it, on errors path is left untouched.
+ */
+static bool archiveFile(Logger_Compress_Codec_T codec, const char *path) {
+    bool ok = false;
+    const char *extension = LOGGER_COMPRESS_CODEC_ZLIB == codec ? ".gz" : ".lgz";
+    char *temporary = concat(path, LOGGER_COMPRESS_CODEC_ZLIB == codec ? ".gz.tmp" : ".lgz.tmp");
+    FILE *source = fopen(path, "rb");
+    if (temporary && source) {
+#ifdef LOGGER_ZLIB
+        ok = LOGGER_COMPRESS_CODEC_ZLIB == codec ? compressToGzip(source, temporary) : compressToBlocks(source, temporary);
+#else
+        ok = compressToBlocks(source, temporary);
+#endif
+        ok = ok && publishArchive(temporary, path, extension);
+        unlink(temporary);
+    }
+    if (source) {
+        fclose(source);
+    }
+    ok = ok && 0 == unlink(path);
+    Logger_Alloc_free(temporary);
+    return ok;
+}
+
+static void *worker(void *arg) {
+    Logger_Archiver_T self = arg;
+    pthread_mutex_lock(&self->mutex);
+    for (;;) {
+        while (0 == self->size && !self->stopping) {
+            pthread_cond_wait(&self->changed, &self->mutex);
+        }
+        if (0 == self->size) {
+            break;  /* stopping, the queue is drained */
+        }
+        char *path = self->queue[self->head];
+        self->head = (self->head + 1) % self->capacity;
+        self->size--;
+        self->busy++;
+        pthread_mutex_unlock(&self->mutex);
+
+        const bool ok = archiveFile(self->codec, path);
+        Logger_Alloc_free(path);
+
+        pthread_mutex_lock(&self->mutex);
+        self->busy--;
+        if (ok) {
+            self->stats.archived++;
+        } else {
+            self->stats.failed++;
+        }
+        pthread_cond_broadcast(&self->changed);
+    }
+    pthread_mutex_unlock(&self->mutex);
+    return NULL;
+}
+
+/*
+ * Stop and join the first threadsCount workers.
+ */
+static void stopWorkers(Logger_Archiver_T self, size_t threadsCount) {
+    pthread_mutex_lock(&self->mutex);
+    self->stopping = true;
+    pthread_cond_broadcast(&self->changed);
+    pthread_mutex_unlock(&self->mutex);
+    for (size_t i = 0; i < threadsCount; i++) {
+        pthread_join(self->threads[i], NULL);
+    }
+}
+
+static void deleteArchiver(Logger_Archiver_T self) {
+    pthread_cond_destroy(&self->changed);
+    pthread_mutex_destroy(&self->mutex);
+    Logger_Alloc_free(self->queue);
+    Logger_Alloc_free(self);
+}
+
+Logger_Archiver_Result_T Logger_Archiver_new(
+        Logger_Compress_Codec_T codec, size_t concurrency, size_t queueCapacity
+) {
+    assert(LOGGER_COMPRESS_CODEC_LZ == codec || LOGGER_COMPRESS_CODEC_ZLIB == codec);
+    assert(concurrency > 0);
+    assert(queueCapacity > 0);
+    if (LOGGER_COMPRESS_CODEC_ZLIB == codec && !Logger_Compress_hasZlib()) {
+        return (Logger_Archiver_Result_T) {.err=LOGGER_ERR_INVALID_CONFIG, .archiver=NULL};
+    }
+    Logger_Archiver_T self = Logger_Alloc_malloc(sizeof(*self) + concurrency * sizeof(self->threads[0]));
+    if (!self) {
+        return (Logger_Archiver_Result_T) {.err=LOGGER_ERR_OUT_OF_MEMORY, .archiver=NULL};
+    }
+    self->codec = codec;
+    self->queue = Logger_Alloc_malloc(queueCapacity * sizeof(self->queue[0]));
+    self->capacity = queueCapacity;
+    self->head = 0;
+    self->size = 0;
+    self->busy = 0;
+    self->stopping = false;
+    self->stats = (Logger_Archiver_Stats_T) {.archived=0, .failed=0, .dropped=0};
+    self->threadsCount = 0;
+    pthread_mutex_init(&self->mutex, NULL);
+    pthread_cond_init(&self->changed, NULL);
+
+    while (self->queue && self->threadsCount < concurrency &&
+           0 == pthread_create(&self->threads[self->threadsCount], NULL, worker, self)) {
+        self->threadsCount++;
+    }
+    if (self->threadsCount < concurrency) {
+        stopWorkers(self, self->threadsCount);
+        deleteArchiver(self);
+        return (Logger_Archiver_Result_T) {.err=LOGGER_ERR_OUT_OF_MEMORY, .archiver=NULL};
+    }
+    return (Logger_Archiver_Result_T) {.err=LOGGER_ERR_OK, .archiver=self};
+}
+
+void Logger_Archiver_delete(Logger_Archiver_T *ref) {
+    assert(ref);
+    assert(*ref);
+    Logger_Archiver_T self = *ref;
+    stopWorkers(self, self->threadsCount);
+    deleteArchiver(self);
+    *ref = NULL;
+}
+
+bool Logger_Archiver_submit(Logger_Archiver_T self, const char *path) {
+    assert(self);
+    assert(path);
+    char *copy = concat(path, "");
+    pthread_mutex_lock(&self->mutex);
+    const bool queued = copy && self->size < self->capacity;
+    if (queued) {
+        self->queue[(self->head + self->size) % self->capacity] = copy;
+        self->size++;
+        pthread_cond_signal(&self->changed);
+    } else {
+        self->stats.dropped++;
+    }
+    pthread_mutex_unlock(&self->mutex);
+    if (!queued) {
+        Logger_Alloc_free(copy);
+    }
+    return queued;
+}
+
+void Logger_Archiver_wait(Logger_Archiver_T self) {
+    assert(self);
+    pthread_mutex_lock(&self->mutex);
+    while (self->size > 0 || self->busy > 0) {
+        pthread_cond_wait(&self->changed, &self->mutex);
+    }
+    pthread_mutex_unlock(&self->mutex);
+}
+
+Logger_Archiver_Stats_T Logger_Archiver_getStats(Logger_Archiver_T self) {
+    assert(self);
+    pthread_mutex_lock(&self->mutex);
+    const Logger_Archiver_Stats_T stats = self->stats;
+    pthread_mutex_unlock(&self->mutex);
+    return stats;
+}
@@ -0,0 +1,119 @@
+/*
+ * C Header File
+ *
+ * Author: daddinuz
+ * email:  daddinuz@gmail.com
+ * Date:   October 19, 2026
+ */
+
+#ifndef LOGGER_LOGGER_ARCHIVER_INCLUDED
+#define LOGGER_LOGGER_ARCHIVER_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "logger_err.h"
+#include "logger_compress.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Logger_Archiver_T compresses finished log files in the background, e.g. the files left behind by a rotating
+ * file handler (see Logger_Handler_newArchivingRotatingFileHandler).
+ * A file is compressed to a temporary file next to it, linked to its final name once complete and only then
+ * the original is removed, so an interrupted job leaves the original in place:
+ *  - LOGGER_COMPRESS_CODEC_LZ: `path.lgz`, the blocks of logger_compress.h (see logger-decompress).
+ *  - LOGGER_COMPRESS_CODEC_ZLIB: `path.gz`, a gzip file.
+ * Existing archives are never overwritten: if the final name is taken, `path.1.lgz`, `path.2.lgz` and so on
+ * are tried instead.
+ * Files are queued and compressed by a fixed number of worker threads, the queue is bounded and submitting
+ * never waits: when the queue is full the file is left as is.
+ */
+#ifdef __cplusplus
+typedef struct Logger_Archiver_C *Logger_Archiver_T;
+#else
+typedef struct Logger_Archiver_T *Logger_Archiver_T;
+#endif
+
+typedef struct Logger_Archiver_Result_T {
+    Logger_Err_T err;
+    Logger_Archiver_T archiver;
+} Logger_Archiver_Result_T;
+
+typedef struct Logger_Archiver_Stats_T {
+    uint64_t archived;
+    uint64_t failed;
+    uint64_t dropped;
+} Logger_Archiver_Stats_T;
+
+/**
+ * Construct a Logger_Archiver_T and start its workers.
+ *
+ * Checked runtime errors:
+ *  - @param codec must be LOGGER_COMPRESS_CODEC_LZ or LOGGER_COMPRESS_CODEC_ZLIB.
+ *  - @param concurrency must be greater than 0.
+ *  - @param queueCapacity must be greater than 0.
+ *  - In case of errors this function will set Logger_Archiver_Result_T.err to the error value,
+ *    `LOGGER_ERR_INVALID_CONFIG` if codec is LOGGER_COMPRESS_CODEC_ZLIB and the library is built without zlib.
+ *
+ * @param codec The codec used to compress the files.
+ * @param concurrency The number of files compressed at the same time.
+ * @param queueCapacity The number of files waiting to be compressed.
+ * @return A Logger_Archiver_Result_T wrapper. If no err occurred archiver will be the new instance of a Logger_Archiver_T.
+ */
+extern Logger_Archiver_Result_T Logger_Archiver_new(
+        Logger_Compress_Codec_T codec, size_t concurrency, size_t queueCapacity
+);
+
+/**
+ * Destruct a Logger_Archiver_T, once the files queued are compressed.
+ * The handlers submitting to it must be deleted before.
+ *
+ * Checked runtime errors:
+ *  - @param ref must be a valid reference to a Logger_Archiver_T instance.
+ *
+ * @param ref The reference to the Logger_Archiver_T instance.
+ */
+extern void Logger_Archiver_delete(Logger_Archiver_T *ref);
+
+/**
+ * Queue a file to be compressed, it is safe to call from many threads.
+ *
+ * Checked runtime errors:
+ *  - @param self must not be NULL.
+ *  - @param path must not be NULL.
+ *
+ * @param self The Logger_Archiver_T instance.
+ * @param path The path of the file, it is copied.
+ * @return true if the file is queued, false if the queue is full or on OOM.
+ */
+extern bool Logger_Archiver_submit(Logger_Archiver_T self, const char *path);
+
+/**
+ * Wait for the files queued to be compressed.
+ *
+ * Checked runtime errors:
+ *  - @param self must not be NULL.
+ *
+ * @param self The Logger_Archiver_T instance.
+ */
+extern void Logger_Archiver_wait(Logger_Archiver_T self);
+
+/**
+ * Get the number of files compressed, of those that could not be and of those dropped because the queue was full.
+ *
+ * Checked runtime errors:
+ *  - @param self must not be NULL.
+ *
+ * @param self The Logger_Archiver_T instance.
+ * @return The counters.
+ */
+extern Logger_Archiver_Stats_T Logger_Archiver_getStats(Logger_Archiver_T self);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LOGGER_LOGGER_ARCHIVER_INCLUDED */
@@ -0,0 +1,186 @@
+/*
+ * C Source File
+ *
+ * Author: daddinuz
+ * email:  daddinuz@gmail.com
+ * Date:   October 19, 2026
+ */
+
+#include <stdio.h>
+#include <assert.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <pthread.h>
+#include "logger_alloc.h"
+#include "logger_arena.h"
+
+#define ALIGNMENT   (2 * sizeof(void *))
+
+typedef struct Chunk_T {
+    struct Chunk_T *next;
+    Logger_Alloc_Allocator_T allocator;  /* chunks outlive allocator swaps */
+    size_t capacity;
+    size_t used;
+    unsigned char data[];
+} Chunk_T;
+
+static pthread_key_t gArenaKey;
+static pthread_once_t gArenaOnce = PTHREAD_ONCE_INIT;
+static __thread Chunk_T *gHead = NULL;
+static __thread Chunk_T *gCurrent = NULL;
+
+static void chunksDelete(Chunk_T *chunk) {
+    while (chunk) {
+        Chunk_T *next = chunk->next;
+        Logger_Alloc_freeWith(&chunk->allocator, chunk);
+        chunk = next;
+    }
+}
+
+static void arenaDestructor(void *head) {
+    chunksDelete(head);
+    gHead = NULL;  /* a later TLS destructor logging on this thread starts a new arena */
+    gCurrent = NULL;
+}
+
+static void arenaInitialize(void) {
+    pthread_key_create(&gArenaKey, arenaDestructor);
+}
+
+static Chunk_T *chunkNew(size_t capacity) {
+    Chunk_T *self = Logger_Alloc_malloc(sizeof(*self) + capacity);
+    if (self) {
+        self->next = NULL;
+        self->allocator = Logger_Alloc_getAllocator();
+        self->capacity = capacity;
+        self->used = 0;
+    }
+    return self;
+}
+
+static void setHead(Chunk_T *head) {
+    pthread_once(&gArenaOnce, arenaInitialize);
+    gHead = head;
+    gCurrent = head;
+    pthread_setspecific(gArenaKey, head);
+}
+
+static size_t alignOffset(const Chunk_T *chunk, size_t offset) {
+    const uintptr_t address = (uintptr_t) (chunk->data + offset);
+    return offset + (ALIGNMENT - address % ALIGNMENT) % ALIGNMENT;
+}
+
+static bool chunkContains(const Chunk_T *chunk, const void *ptr) {
+    const uintptr_t address = (uintptr_t) ptr, start = (uintptr_t) chunk->data;
+    return start <= address && address <= start + chunk->capacity;
+}
+
+/*
+ * Once the arena is empty, replace a chain of chunks with a single one of the same total capacity.
+ * On failure the chain is simply kept.
+ */
+static void compact(void) {
+    size_t capacity = 0;
+    for (const Chunk_T *chunk = gHead; chunk; chunk = chunk->next) {
+        capacity += chunk->capacity;
+    }
+    Chunk_T *head = chunkNew(capacity);
+    if (head) {
+        chunksDelete(gHead);
+        setHead(head);
+    }
+}
+
+void *Logger_Arena_allocate(size_t size) {
+    if (size > SIZE_MAX / 2 - ALIGNMENT) {
+        return NULL;
+    }
+    if (!gHead) {
+        Chunk_T *head = chunkNew(size + ALIGNMENT > LOGGER_ARENA_CHUNK_SIZE ? size + ALIGNMENT : LOGGER_ARENA_CHUNK_SIZE);
+        if (!head) {
+            return NULL;
+        }
+        setHead(head);
+    }
+
+    while (true) {
+        const size_t offset = alignOffset(gCurrent, gCurrent->used);
+        if (offset <= gCurrent->capacity && size <= gCurrent->capacity - offset) {
+            gCurrent->used = offset + size;
+            return gCurrent->data + offset;
+        }
+        if (!gCurrent->next) {
+            const size_t capacity = 2 * gCurrent->capacity;
+            gCurrent->next = chunkNew(size + ALIGNMENT > capacity ? size + ALIGNMENT : capacity);
+            if (!gCurrent->next) {
+                return NULL;
+            }
+        }
+        gCurrent = gCurrent->next;
+        gCurrent->used = 0;
+    }
+}
+
+char *Logger_Arena_vprintf(const char *fmt, va_list args) {
+    assert(fmt);
+    va_list copy;
+    int length;
+
+    /* try to format in place first, the common case needs a single pass */
+    va_copy(copy, args);
+    if (gCurrent && gCurrent->used < gCurrent->capacity) {
+        char *str = (char *) (gCurrent->data + gCurrent->used);
+        const size_t available = gCurrent->capacity - gCurrent->used;
+        length = vsnprintf(str, available, fmt, copy);
+        if (length >= 0 && (size_t) length < available) {
+            va_end(copy);
+            gCurrent->used += (size_t) length + 1;
+            return str;
+        }
+    } else {
+        length = vsnprintf(NULL, 0, fmt, copy);
+    }
+    va_end(copy);
+    if (length < 0) {
+        return NULL;
+    }
+
+    char *str = Logger_Arena_allocate((size_t) length + 1);
+    if (str) {
+        vsnprintf(str, (size_t) length + 1, fmt, args);
+    }
+    return str;
+}
+
+void Logger_Arena_release(const void *ptr) {
+    assert(ptr);
+    bool afterCurrent = false;
+    Chunk_T *chunk = gHead;
+    for (; chunk && !chunkContains(chunk, ptr); chunk = chunk->next) {
+        afterCurrent = afterCurrent || chunk == gCurrent;
+    }
+    assert(chunk);
+    if (afterCurrent) {
+        return;     /* released along with an earlier block */
+    }
+
+    const size_t offset = (size_t) ((uintptr_t) ptr - (uintptr_t) chunk->data);
+    if (chunk != gCurrent || offset <= chunk->used) {
+        chunk->used = offset;
+        gCurrent = chunk;
+    }
+    if (gCurrent == gHead && gHead->used <= alignOffset(gHead, 0) && gHead->next) {
+        compact();
+    }
+}
+
+size_t Logger_Arena_getUsed(void) {
+    size_t used = 0;
+    for (const Chunk_T *chunk = gHead; chunk; chunk = chunk->next) {
+        used += chunk->used;
+        if (chunk == gCurrent) {
+            break;
+        }
+    }
+    return used;
+}
@@ -0,0 +1,80 @@
+/*
+ * C Header File
+ *
+ * Author: daddinuz
+ * email:  daddinuz@gmail.com
+ * Date:   October 19, 2026
+ */
+
+#ifndef LOGGER_LOGGER_ARENA_INCLUDED
+#define LOGGER_LOGGER_ARENA_INCLUDED
+
+#include <stddef.h>
+#include <stdarg.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * A per-thread bump arena for the temporaries of a logging request: the message, the record
+ * and the records formatted by the handlers.
+ *
+ * Allocations are released in stack order: releasing a pointer gives back it and everything
+ * allocated after it by the same thread. _Logger_log releases its first block once the handlers are done,
+ * which resets the arena, and formatters release their output when it is deleted.
+ * Chunks are kept across releases and, when the arena empties, merged into a single one as large as
+ * all of them together: once warmed up, a logging request does not allocate at all.
+ * The chunks are obtained through logger_alloc.h and freed when the thread exits.
+ */
+#ifndef LOGGER_ARENA_CHUNK_SIZE
+#define LOGGER_ARENA_CHUNK_SIZE 4096
+#endif
+
+/**
+ * Allocate a block suitably aligned for any type from the arena of the calling thread.
+ *
+ * Checked runtime errors:
+ *  - In case of OOM this function will return NULL.
+ *
+ * @param size The size of the block.
+ * @return The block.
+ */
+extern void *Logger_Arena_allocate(size_t size);
+
+/**
+ * Format a string in the arena of the calling thread.
+ *
+ * Checked runtime errors:
+ *  - @param fmt must not be NULL.
+ *  - In case of OOM this function will return NULL.
+ *
+ * @param fmt The printf-like fmt string.
+ * @param args The arguments list.
+ * @return The NUL terminated string.
+ */
+extern char *Logger_Arena_vprintf(const char *fmt, va_list args);
+
+/**
+ * Release a block and every block allocated after it by the calling thread.
+ * Releasing a block that has already been released does nothing.
+ *
+ * Checked runtime errors:
+ *  - @param ptr must not be NULL and must have been allocated from the arena of the calling thread.
+ *
+ * @param ptr The block.
+ */
+extern void Logger_Arena_release(const void *ptr);
+
+/**
+ * Get the number of bytes currently allocated from the arena of the calling thread, alignment included.
+ *
+ * @return The number of bytes.
+ */
+extern size_t Logger_Arena_getUsed(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LOGGER_LOGGER_ARENA_INCLUDED */
@@ -0,0 +1,51 @@
+/*
+ * C Source File
+ *
+ * Author: daddinuz
+ * email:  daddinuz@gmail.com
+ * Date:   October 19, 2026
+ */
+
+#include <assert.h>
+#include "logger_binary.h"
+
+size_t Logger_Binary_encodeVarint(uint64_t value, unsigned char *out) {
+    assert(out);
+    size_t i = 0;
+    while (value >= 0x80) {
+        out[i++] = (unsigned char) (value | 0x80);
+        value >>= 7;
+    }
+    out[i++] = (unsigned char) value;
+    return i;
+}
+
+size_t Logger_Binary_encodeSignedVarint(int64_t value, unsigned char *out) {
+    assert(out);
+    return Logger_Binary_encodeVarint(((uint64_t) value << 1) ^ (uint64_t) (value >> 63), out);
+}
+
+size_t Logger_Binary_decodeVarint(const unsigned char *data, size_t size, uint64_t *value) {
+    assert(data);
+    assert(value);
+    uint64_t result = 0;
+    for (size_t i = 0; i < size && i < LOGGER_BINARY_VARINT_MAX_SIZE; i++) {
+        result |= (uint64_t) (data[i] & 0x7F) << (7 * i);
+        if (!(data[i] & 0x80)) {
+            *value = result;
+            return i + 1;
+        }
+    }
+    return 0;
+}
+
+size_t Logger_Binary_decodeSignedVarint(const unsigned char *data, size_t size, int64_t *value) {
+    assert(data);
+    assert(value);
+    uint64_t raw = 0;
+    const size_t read = Logger_Binary_decodeVarint(data, size, &raw);
+    if (read) {
+        *value = (int64_t) (raw >> 1) ^ -(int64_t) (raw & 1);
+    }
+    return read;
+}
@@ -0,0 +1,115 @@
+/*
+ * C Header File
+ *
+ * Author: daddinuz
+ * email:  daddinuz@gmail.com
+ * Date:   October 19, 2026
+ */
+
+#ifndef LOGGER_LOGGER_BINARY_INCLUDED
+#define LOGGER_LOGGER_BINARY_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Logger_Binary_FrameType_T identifies the payload of a frame written by the binary formatter.
+ *
+ * A binary log is a sequence of frames, each one made of an unsigned varint holding the payload size
+ * followed by the payload. The first byte of the payload is the frame type:
+ *  - LOGGER_BINARY_FRAME_EPOCH: signed varint, the base timestamp of the stream, followed by an unsigned varint
+ *    identifying the scope it opens.
+ *  - LOGGER_BINARY_FRAME_DEFINITION: unsigned varint id, followed by the bytes of the string it stands for.
+ *  - LOGGER_BINARY_FRAME_RECORD: unsigned varints level and line, signed varint timestamp delta from the epoch,
+ *    unsigned varint ids of logger name, file and function, followed by the bytes of the message.
+ *  - LOGGER_BINARY_FRAME_SUPPRESSED: unsigned varint, the number of records of the same call site suppressed
+ *    by sampling or rate limiting; it is written right before the record frame it refers to.
+ *  - LOGGER_BINARY_FRAME_FIELDS: unsigned varint count followed by the structured fields of the record frame
+ *    written right after it. Each field is an unsigned varint key length, the key bytes, a type byte
+ *    (a Logger_Field_Type_T value) and the value: a signed varint for LOGGER_FIELD_TYPE_INT, an unsigned one for
+ *    LOGGER_FIELD_TYPE_UINT, 8 little endian bytes of the IEEE 754 representation for LOGGER_FIELD_TYPE_DOUBLE,
+ *    one byte for LOGGER_FIELD_TYPE_BOOL, an unsigned varint length and the bytes for LOGGER_FIELD_TYPE_STR.
+ *  - LOGGER_BINARY_FRAME_MDC: unsigned varint count followed by the diagnostic context entries of the record frame
+ *    written right after it, each one an unsigned varint key length, the key bytes, an unsigned varint value length
+ *    and the value bytes.
+ *
+ * Frames apply in stream order. An epoch frame opens a new scope, with no ids defined, unless it repeats the
+ * scope of the current one; ids are defined by the definition frames that precede, in the same scope,
+ * the first record referencing them. Streams appended to the same file, e.g. by several runs, thus
+ * decode independently.
+ */
+typedef enum Logger_Binary_FrameType_T {
+    LOGGER_BINARY_FRAME_EPOCH = 1,
+    LOGGER_BINARY_FRAME_DEFINITION,
+    LOGGER_BINARY_FRAME_RECORD,
+    LOGGER_BINARY_FRAME_SUPPRESSED,
+    LOGGER_BINARY_FRAME_FIELDS,
+    LOGGER_BINARY_FRAME_MDC,
+} Logger_Binary_FrameType_T;
+
+/**
+ * The maximum number of bytes needed to encode a 64 bits varint.
+ */
+#define LOGGER_BINARY_VARINT_MAX_SIZE 10
+
+/**
+ * Encode an unsigned varint (LEB128).
+ *
+ * Checked runtime errors:
+ *  - @param out must not be NULL and must have room for at least LOGGER_BINARY_VARINT_MAX_SIZE bytes.
+ *
+ * @param value The value to be encoded.
+ * @param out The output buffer.
+ * @return The number of bytes written.
+ */
+extern size_t Logger_Binary_encodeVarint(uint64_t value, unsigned char *out);
+
+/**
+ * Encode a signed varint (zig-zag LEB128).
+ *
+ * Checked runtime errors:
+ *  - @param out must not be NULL and must have room for at least LOGGER_BINARY_VARINT_MAX_SIZE bytes.
+ *
+ * @param value The value to be encoded.
+ * @param out The output buffer.
+ * @return The number of bytes written.
+ */
+extern size_t Logger_Binary_encodeSignedVarint(int64_t value, unsigned char *out);
+
+/**
+ * Decode an unsigned varint (LEB128).
+ *
+ * Checked runtime errors:
+ *  - @param data must not be NULL.
+ *  - @param value must not be NULL.
+ *
+ * @param data The input buffer.
+ * @param size The number of bytes available in data.
+ * @param value The decoded value.
+ * @return The number of bytes read or 0 if data does not hold a complete varint.
+ */
+extern size_t Logger_Binary_decodeVarint(const unsigned char *data, size_t size, uint64_t *value);
+
+/**
+ * Decode a signed varint (zig-zag LEB128).
+ *
+ * Checked runtime errors:
+ *  - @param data must not be NULL.
+ *  - @param value must not be NULL.
+ *
+ * @param data The input buffer.
+ * @param size The number of bytes available in data.
+ * @param value The decoded value.
+ * @return The number of bytes read or 0 if data does not hold a complete varint.
+ */
+extern size_t Logger_Binary_decodeSignedVarint(const unsigned char *data, size_t size, int64_t *value);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LOGGER_LOGGER_BINARY_INCLUDED */
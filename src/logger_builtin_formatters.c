@@ -3,42 +3,988 @@
  *
  * Author: daddinuz
  * email:  daddinuz@gmail.com
- * Date:   August 04, 2017 
+ * Date:   August 04, 2017
  */
 
+#include <math.h>
+#include <stdio.h>
 #include <assert.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <string.h>
+#include <stdbool.h>
+#include <pthread.h>
+#include <unistd.h>
 #include "sds/sds.h"
+#include "logger_alloc.h"
+#include "logger_arena.h"
+#include "logger_binary.h"
+#include "logger_intern.h"
 #include "logger_builtin_formatters.h"
 
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+/*
+ * Output Buffer
+ *
+ * Formatters built on top of the output buffer append into a per-thread sds that is cleared,
+ * not freed, between records: once it has grown to the size of the largest record no further
+ * allocation takes place. The formatted record handed to the handler is the buffer itself,
+ * so the matching delete callback does nothing.
+ */
+typedef struct OutputBuffer_T {
+    sds data;
+    bool failed;
+} OutputBuffer_T;
+
+static pthread_key_t gOutputBufferKey;
+static pthread_once_t gOutputBufferOnce = PTHREAD_ONCE_INIT;
+static __thread sds gOutputBuffer = NULL;
+static __thread Logger_Alloc_Allocator_T gOutputBufferAllocator;
+
+static void outputBufferDestructor(void *data) {
+    Logger_Alloc_freeWith(&gOutputBufferAllocator, sdsAllocPtr(data));
+    gOutputBuffer = NULL;  /* a later TLS destructor formatting on this thread gets a new buffer */
+}
+
+static void outputBufferInitialize(void) {
+    pthread_key_create(&gOutputBufferKey, outputBufferDestructor);
+}
+
+static OutputBuffer_T outputBufferAcquire(void) {
+    if (gOutputBuffer && !Logger_Alloc_isCurrent(&gOutputBufferAllocator)) {
+        /* the allocator was swapped, growing the buffer would realloc it with the new one */
+        Logger_Alloc_freeWith(&gOutputBufferAllocator, sdsAllocPtr(gOutputBuffer));
+        gOutputBuffer = NULL;
+        pthread_setspecific(gOutputBufferKey, NULL);
+    }
+    if (!gOutputBuffer) {
+        pthread_once(&gOutputBufferOnce, outputBufferInitialize);
+        gOutputBufferAllocator = Logger_Alloc_getAllocator();
+        gOutputBuffer = sdsempty();
+        if (gOutputBuffer) {
+            pthread_setspecific(gOutputBufferKey, gOutputBuffer);
+        }
+    } else {
+        sdsclear(gOutputBuffer);
+    }
+    return (OutputBuffer_T) {.data=gOutputBuffer, .failed=(NULL == gOutputBuffer)};
+}
+
+static char *outputBufferRelease(OutputBuffer_T *buffer) {
+    assert(buffer);
+    if (buffer->data != gOutputBuffer) {
+        gOutputBuffer = buffer->data;
+        pthread_setspecific(gOutputBufferKey, gOutputBuffer);
+    }
+    return buffer->failed ? NULL : buffer->data;
+}
+
+static void outputBufferAppend(OutputBuffer_T *buffer, const char *data, size_t length) {
+    assert(buffer);
+    assert(data);
+    if (!buffer->failed) {
+        sds tmp = sdscatlen(buffer->data, data, length);
+        if (tmp) {
+            buffer->data = tmp;
+        } else {
+            buffer->failed = true;
+        }
+    }
+}
+
+static void outputBufferAppendString(OutputBuffer_T *buffer, const char *str) {
+    assert(buffer);
+    assert(str);
+    outputBufferAppend(buffer, str, strlen(str));
+}
+
+static void outputBufferAppendUnsigned(OutputBuffer_T *buffer, unsigned long long value) {
+    assert(buffer);
+    char digits[24];
+    size_t i = sizeof(digits);
+    do {
+        digits[--i] = (char) ('0' + value % 10);
+        value /= 10;
+    } while (value);
+    outputBufferAppend(buffer, digits + i, sizeof(digits) - i);
+}
+
+static void outputBufferAppendSigned(OutputBuffer_T *buffer, long long value) {
+    assert(buffer);
+    if (value < 0) {
+        outputBufferAppend(buffer, "-", 1);
+        outputBufferAppendUnsigned(buffer, 0ULL - (unsigned long long) value);
+    } else {
+        outputBufferAppendUnsigned(buffer, (unsigned long long) value);
+    }
+}
+
+static void outputBufferAppendDouble(OutputBuffer_T *buffer, double value) {
+    assert(buffer);
+    char digits[32];
+    const int length = snprintf(digits, sizeof(digits), "%.17g", value);
+    if (length > 0) {
+        outputBufferAppend(buffer, digits, (size_t) length);
+    }
+}
+
+static void outputBufferAppendTimestamp(OutputBuffer_T *buffer, time_t timestamp, const char *fmt) {
+    assert(buffer);
+    assert(fmt);
+    struct tm tm;
+    char time_string[32] = "";
+    if (gmtime_r(&timestamp, &tm)) {
+        strftime(time_string, sizeof(time_string) / sizeof(time_string[0]), fmt, &tm);
+    }
+    outputBufferAppendString(buffer, time_string);
+}
+
+static void outputBufferDeleteCallback(Logger_Formatter_T formatter, char *formattedRecord) {
+    assert(formatter);
+    (void) formatter;
+    (void) formattedRecord; /* owned by the thread, reused by the next record */
+}
+
+static size_t sdsSizeCallback(Logger_Formatter_T formatter, const char *formattedRecord) {
+    assert(formatter);
+    assert(formattedRecord);
+    (void) formatter;
+    return sdslen((const sds) formattedRecord);
+}
+
+/*
+ * Arena Output
+ *
+ * Formatters built on top of the arena (see logger_arena.h) print the record in the arena of the
+ * calling thread and release it when the handler deletes the formatted record.
+ */
+static char *arenaPrintf(const char *fmt, ...) {
+    assert(fmt);
+    va_list args;
+    va_start(args, fmt);
+    char *str = Logger_Arena_vprintf(fmt, args);
+    va_end(args);
+    return str;
+}
+
+static void arenaDeleteCallback(Logger_Formatter_T formatter, char *formattedRecord) {
+    assert(formatter);
+    assert(formattedRecord);
+    (void) formatter;
+    Logger_Arena_release(formattedRecord);
+}
+
+static size_t stringSizeCallback(Logger_Formatter_T formatter, const char *formattedRecord) {
+    assert(formatter);
+    assert(formattedRecord);
+    (void) formatter;
+    return strlen(formattedRecord);
+}
+
+/*
+ * JSON Escaping
+ */
+
+/*
+ * Return the offset of the first byte in data that can not be copied verbatim into a JSON string
+ * (control characters, quotation mark and reverse solidus) or length if there is none.
+ */
+static size_t jsonFindEscape(const char *data, size_t length) {
+    size_t i = 0;
+#if defined(__AVX2__)
+    const __m256i quote32 = _mm256_set1_epi8('"');
+    const __m256i backslash32 = _mm256_set1_epi8('\\');
+    const __m256i control32 = _mm256_set1_epi8(0x1F);
+    for (; i + 32 <= length; i += 32) {
+        const __m256i chunk = _mm256_loadu_si256((const __m256i *) (data + i));
+        const __m256i mask = _mm256_or_si256(
+                _mm256_or_si256(_mm256_cmpeq_epi8(chunk, quote32), _mm256_cmpeq_epi8(chunk, backslash32)),
+                _mm256_cmpeq_epi8(_mm256_max_epu8(chunk, control32), control32)
+        );
+        const unsigned bits = (unsigned) _mm256_movemask_epi8(mask);
+        if (bits) {
+            return i + __builtin_ctz(bits);
+        }
+    }
+#endif
+#if defined(__SSE2__)
+    const __m128i quote16 = _mm_set1_epi8('"');
+    const __m128i backslash16 = _mm_set1_epi8('\\');
+    const __m128i control16 = _mm_set1_epi8(0x1F);
+    for (; i + 16 <= length; i += 16) {
+        const __m128i chunk = _mm_loadu_si128((const __m128i *) (data + i));
+        const __m128i mask = _mm_or_si128(
+                _mm_or_si128(_mm_cmpeq_epi8(chunk, quote16), _mm_cmpeq_epi8(chunk, backslash16)),
+                _mm_cmpeq_epi8(_mm_max_epu8(chunk, control16), control16)
+        );
+        const unsigned bits = (unsigned) _mm_movemask_epi8(mask);
+        if (bits) {
+            return i + __builtin_ctz(bits);
+        }
+    }
+#endif
+    for (; i < length; i++) {
+        const unsigned char c = (unsigned char) data[i];
+        if (c < 0x20 || '"' == c || '\\' == c) {
+            break;
+        }
+    }
+    return i;
+}
+
+/*
+ * Append data escaping the bytes that can not appear verbatim in a JSON string.
+ */
+static void outputBufferAppendEscaped(OutputBuffer_T *buffer, const char *data, size_t length) {
+    assert(buffer);
+    assert(data);
+    static const char HEX_DIGITS[] = "0123456789abcdef";
+    while (length > 0) {
+        const size_t clean = jsonFindEscape(data, length);
+        outputBufferAppend(buffer, data, clean);
+        if (clean == length) {
+            break;
+        }
+        const unsigned char c = (unsigned char) data[clean];
+        switch (c) {
+            case '"':
+                outputBufferAppend(buffer, "\\\"", 2);
+                break;
+            case '\\':
+                outputBufferAppend(buffer, "\\\\", 2);
+                break;
+            case '\b':
+                outputBufferAppend(buffer, "\\b", 2);
+                break;
+            case '\f':
+                outputBufferAppend(buffer, "\\f", 2);
+                break;
+            case '\n':
+                outputBufferAppend(buffer, "\\n", 2);
+                break;
+            case '\r':
+                outputBufferAppend(buffer, "\\r", 2);
+                break;
+            case '\t':
+                outputBufferAppend(buffer, "\\t", 2);
+                break;
+            default: {
+                const char escape[] = {'\\', 'u', '0', '0', HEX_DIGITS[c >> 4], HEX_DIGITS[c & 0xF]};
+                outputBufferAppend(buffer, escape, sizeof(escape));
+                break;
+            }
+        }
+        data += clean + 1;
+        length -= clean + 1;
+    }
+}
+
+static void outputBufferAppendJsonString(OutputBuffer_T *buffer, const char *data, size_t length) {
+    assert(buffer);
+    assert(data);
+    outputBufferAppend(buffer, "\"", 1);
+    outputBufferAppendEscaped(buffer, data, length);
+    outputBufferAppend(buffer, "\"", 1);
+}
+
+/*
+ * The value of a string field, a NULL one is written as "(null)" by the formatters with no null literal.
+ */
+static const char *fieldString(const Logger_Field_T *field) {
+    assert(field);
+    return field->value.asStr ? field->value.asStr : "(null)";
+}
+
+static void outputBufferAppendJsonFields(OutputBuffer_T *buffer, const Logger_Field_T *fields, size_t fieldsCount) {
+    assert(buffer);
+    assert(fields || 0 == fieldsCount);
+    outputBufferAppend(buffer, "{", 1);
+    for (size_t i = 0; i < fieldsCount; i++) {
+        const Logger_Field_T *field = &fields[i];
+        if (i > 0) {
+            outputBufferAppend(buffer, ",", 1);
+        }
+        outputBufferAppendJsonString(buffer, field->key, strlen(field->key));
+        outputBufferAppend(buffer, ":", 1);
+        switch (field->type) {
+            case LOGGER_FIELD_TYPE_INT:
+                outputBufferAppendSigned(buffer, field->value.asInt);
+                break;
+            case LOGGER_FIELD_TYPE_UINT:
+                outputBufferAppendUnsigned(buffer, field->value.asUint);
+                break;
+            case LOGGER_FIELD_TYPE_DOUBLE:
+                if (isfinite(field->value.asDouble)) {
+                    outputBufferAppendDouble(buffer, field->value.asDouble);
+                } else {
+                    outputBufferAppendString(buffer, "null");   /* JSON has no infinities nor NaNs */
+                }
+                break;
+            case LOGGER_FIELD_TYPE_BOOL:
+                outputBufferAppendString(buffer, field->value.asBool ? "true" : "false");
+                break;
+            default:
+                if (field->value.asStr) {
+                    outputBufferAppendJsonString(buffer, field->value.asStr, strlen(field->value.asStr));
+                } else {
+                    outputBufferAppendString(buffer, "null");
+                }
+                break;
+        }
+    }
+    outputBufferAppend(buffer, "}", 1);
+}
+
+static void outputBufferAppendJsonMdc(OutputBuffer_T *buffer, Logger_Mdc_T mdc) {
+    assert(buffer);
+    assert(mdc);
+    const Logger_Mdc_Entry_T *entries = Logger_Mdc_getEntries(mdc);
+    outputBufferAppend(buffer, "{", 1);
+    for (size_t i = 0; i < Logger_Mdc_getSize(mdc); i++) {
+        if (i > 0) {
+            outputBufferAppend(buffer, ",", 1);
+        }
+        outputBufferAppendJsonString(buffer, entries[i].key, strlen(entries[i].key));
+        outputBufferAppend(buffer, ":", 1);
+        outputBufferAppendJsonString(buffer, entries[i].value, strlen(entries[i].value));
+    }
+    outputBufferAppend(buffer, "}", 1);
+}
+
+/*
+ * Logfmt Quoting
+ */
+
+/*
+ * Return the offset of the first byte in data that forces a logfmt value to be quoted
+ * (spaces, control characters, equal sign, quotation mark and reverse solidus) or length if there is none.
+ */
+static size_t logfmtFindQuote(const char *data, size_t length) {
+    size_t i = 0;
+#if defined(__AVX2__)
+    const __m256i space32 = _mm256_set1_epi8(' ');
+    const __m256i delete32 = _mm256_set1_epi8(0x7F);
+    const __m256i equal32 = _mm256_set1_epi8('=');
+    const __m256i quote32 = _mm256_set1_epi8('"');
+    const __m256i backslash32 = _mm256_set1_epi8('\\');
+    for (; i + 32 <= length; i += 32) {
+        const __m256i chunk = _mm256_loadu_si256((const __m256i *) (data + i));
+        const __m256i mask = _mm256_or_si256(
+                _mm256_or_si256(
+                        _mm256_cmpeq_epi8(_mm256_max_epu8(chunk, space32), space32),
+                        _mm256_cmpeq_epi8(chunk, delete32)
+                ),
+                _mm256_or_si256(
+                        _mm256_cmpeq_epi8(chunk, equal32),
+                        _mm256_or_si256(_mm256_cmpeq_epi8(chunk, quote32), _mm256_cmpeq_epi8(chunk, backslash32))
+                )
+        );
+        const unsigned bits = (unsigned) _mm256_movemask_epi8(mask);
+        if (bits) {
+            return i + __builtin_ctz(bits);
+        }
+    }
+#endif
+#if defined(__SSE2__)
+    const __m128i space16 = _mm_set1_epi8(' ');
+    const __m128i delete16 = _mm_set1_epi8(0x7F);
+    const __m128i equal16 = _mm_set1_epi8('=');
+    const __m128i quote16 = _mm_set1_epi8('"');
+    const __m128i backslash16 = _mm_set1_epi8('\\');
+    for (; i + 16 <= length; i += 16) {
+        const __m128i chunk = _mm_loadu_si128((const __m128i *) (data + i));
+        const __m128i mask = _mm_or_si128(
+                _mm_or_si128(_mm_cmpeq_epi8(_mm_max_epu8(chunk, space16), space16), _mm_cmpeq_epi8(chunk, delete16)),
+                _mm_or_si128(
+                        _mm_cmpeq_epi8(chunk, equal16),
+                        _mm_or_si128(_mm_cmpeq_epi8(chunk, quote16), _mm_cmpeq_epi8(chunk, backslash16))
+                )
+        );
+        const unsigned bits = (unsigned) _mm_movemask_epi8(mask);
+        if (bits) {
+            return i + __builtin_ctz(bits);
+        }
+    }
+#endif
+    for (; i < length; i++) {
+        const unsigned char c = (unsigned char) data[i];
+        if (c <= ' ' || 0x7F == c || '=' == c || '"' == c || '\\' == c) {
+            break;
+        }
+    }
+    return i;
+}
+
+/*
+ * The bytes before the first one that forces quoting are copied as they are, the rest is escaped:
+ * every byte is looked at once.
+ */
+static void outputBufferAppendLogfmtValue(OutputBuffer_T *buffer, const char *data, size_t length) {
+    assert(buffer);
+    assert(data);
+    const size_t clean = logfmtFindQuote(data, length);
+    if (clean == length && length > 0) {
+        outputBufferAppend(buffer, data, length);
+        return;
+    }
+    outputBufferAppend(buffer, "\"", 1);
+    outputBufferAppend(buffer, data, clean);
+    outputBufferAppendEscaped(buffer, data + clean, length - clean);
+    outputBufferAppend(buffer, "\"", 1);
+}
+
+/*
+ * Keys can not be quoted: the bytes that would force quoting are replaced by underscores.
+ */
+static void outputBufferAppendLogfmtKey(OutputBuffer_T *buffer, const char *key) {
+    assert(buffer);
+    assert(key);
+    size_t length = strlen(key);
+    outputBufferAppend(buffer, " ", 1);
+    if (0 == length) {
+        outputBufferAppend(buffer, "_", 1);
+    }
+    while (length > 0) {
+        const size_t clean = logfmtFindQuote(key, length);
+        outputBufferAppend(buffer, key, clean);
+        if (clean == length) {
+            break;
+        }
+        outputBufferAppend(buffer, "_", 1);
+        key += clean + 1;
+        length -= clean + 1;
+    }
+    outputBufferAppend(buffer, "=", 1);
+}
+
+static void outputBufferAppendLogfmtFields(OutputBuffer_T *buffer, const Logger_Field_T *fields, size_t fieldsCount) {
+    assert(buffer);
+    assert(fields || 0 == fieldsCount);
+    for (size_t i = 0; i < fieldsCount; i++) {
+        const Logger_Field_T *field = &fields[i];
+        outputBufferAppendLogfmtKey(buffer, field->key);
+        switch (field->type) {
+            case LOGGER_FIELD_TYPE_INT:
+                outputBufferAppendSigned(buffer, field->value.asInt);
+                break;
+            case LOGGER_FIELD_TYPE_UINT:
+                outputBufferAppendUnsigned(buffer, field->value.asUint);
+                break;
+            case LOGGER_FIELD_TYPE_DOUBLE:
+                outputBufferAppendDouble(buffer, field->value.asDouble);
+                break;
+            case LOGGER_FIELD_TYPE_BOOL:
+                outputBufferAppendString(buffer, field->value.asBool ? "true" : "false");
+                break;
+            default: {
+                const char *value = fieldString(field);
+                outputBufferAppendLogfmtValue(buffer, value, strlen(value));
+                break;
+            }
+        }
+    }
+}
+
+static void outputBufferAppendLogfmtMdc(OutputBuffer_T *buffer, Logger_Mdc_T mdc) {
+    assert(buffer);
+    const Logger_Mdc_Entry_T *entries = mdc ? Logger_Mdc_getEntries(mdc) : NULL;
+    for (size_t i = 0; mdc && i < Logger_Mdc_getSize(mdc); i++) {
+        outputBufferAppendLogfmtKey(buffer, entries[i].key);
+        outputBufferAppendLogfmtValue(buffer, entries[i].value, strlen(entries[i].value));
+    }
+}
+
 /*
  * Logger Formatters Callbacks
  */
-static char *formatRecordCallback(Logger_Record_T record) {
+/*
+ * Print into dst at most size bytes of a field as " key=value", return what snprintf returns.
+ */
+static int printField(char *dst, size_t size, const Logger_Field_T *field) {
+    assert(field);
+    switch (field->type) {
+        case LOGGER_FIELD_TYPE_INT:
+            return snprintf(dst, size, " %s=%lld", field->key, field->value.asInt);
+        case LOGGER_FIELD_TYPE_UINT:
+            return snprintf(dst, size, " %s=%llu", field->key, field->value.asUint);
+        case LOGGER_FIELD_TYPE_DOUBLE:
+            return snprintf(dst, size, " %s=%.17g", field->key, field->value.asDouble);
+        case LOGGER_FIELD_TYPE_BOOL:
+            return snprintf(dst, size, " %s=%s", field->key, field->value.asBool ? "true" : "false");
+        default:
+            return snprintf(dst, size, " %s=%s", field->key, fieldString(field));
+    }
+}
+
+/*
+ * Print into dst at most size bytes of a record with its context and fields, return the total length as snprintf does.
+ */
+static int printRecordWithFields(
+        char *dst, size_t size, Logger_Record_T record, const char *timeString, const char *suppressedString
+) {
     assert(record);
-    char time_string[32] = "";
-    time_t timestamp = Logger_Record_getTimestamp(record);
-    strftime(time_string, sizeof(time_string) / sizeof(time_string[0]), "%Y-%m-%d %H:%M:%S UTC", gmtime(&timestamp));
-    sds result = sdscatprintf(
-            sdsempty(),
-            "%s [%s] %s %s:%zu:%s\n%s\n",
+    assert(timeString);
+    assert(suppressedString);
+    const Logger_Field_T *fields = Logger_Record_getFields(record);
+    const size_t fieldsCount = Logger_Record_getFieldsCount(record);
+    Logger_Mdc_T mdc = Logger_Record_getMdc(record);
+    const Logger_Mdc_Entry_T *entries = mdc ? Logger_Mdc_getEntries(mdc) : NULL;
+    const size_t entriesCount = mdc ? Logger_Mdc_getSize(mdc) : 0;
+    int length = snprintf(
+            dst, size,
+            "%s [%s] %s %s:%zu:%s%s\n%s",
             Logger_Record_getLoggerName(record),
             Logger_Level_getName(Logger_Record_getLevel(record)),
-            time_string,
+            timeString,
             Logger_Record_getFile(record),
             Logger_Record_getLine(record),
             Logger_Record_getFunction(record),
+            suppressedString,
             Logger_Record_getMessage(record)
     );
+    for (size_t i = 0; length >= 0 && i <= entriesCount + fieldsCount; i++) {
+        char *tail = dst ? dst + length : NULL;
+        const size_t available = size > (size_t) length ? size - (size_t) length : 0;
+        const int written = i < entriesCount ?
+                            snprintf(tail, available, " %s=%s", entries[i].key, entries[i].value) :
+                            i < entriesCount + fieldsCount ?
+                            printField(tail, available, &fields[i - entriesCount]) :
+                            snprintf(tail, available, "\n");
+        length = written < 0 ? written : length + written;
+    }
+    return length;
+}
+
+static char *formatRecordCallback(Logger_Formatter_T formatter, Logger_Record_T record) {
+    assert(formatter);
+    assert(record);
+    (void) formatter;
+    struct tm tm;
+    char time_string[32] = "";
+    char suppressed_string[48] = "";
+    time_t timestamp = Logger_Record_getTimestamp(record);
+    if (gmtime_r(&timestamp, &tm)) {  /* gmtime shares its result among threads */
+        strftime(time_string, sizeof(time_string) / sizeof(time_string[0]), "%Y-%m-%d %H:%M:%S UTC", &tm);
+    }
+    if (Logger_Record_getSuppressed(record) > 0) {
+        snprintf(suppressed_string, sizeof(suppressed_string), " (%zu suppressed)", Logger_Record_getSuppressed(record));
+    }
+    if (0 == Logger_Record_getFieldsCount(record) && !Logger_Record_getMdc(record)) {
+        return arenaPrintf(
+                "%s [%s] %s %s:%zu:%s%s\n%s\n",
+                Logger_Record_getLoggerName(record),
+                Logger_Level_getName(Logger_Record_getLevel(record)),
+                time_string,
+                Logger_Record_getFile(record),
+                Logger_Record_getLine(record),
+                Logger_Record_getFunction(record),
+                suppressed_string,
+                Logger_Record_getMessage(record)
+        );
+    }
+
+    /* records with context or fields are printed in two passes: measure first, then print in a block of the right size */
+    const int length = printRecordWithFields(NULL, 0, record, time_string, suppressed_string);
+    char *result = length < 0 ? NULL : Logger_Arena_allocate((size_t) length + 1);
+    if (result) {
+        printRecordWithFields(result, (size_t) length + 1, record, time_string, suppressed_string);
+    }
     return result;
 }
 
-static void deleteFormattedRecordCallback(char *formattedRecord) {
-    sdsfree(formattedRecord);
+static char *jsonFormatRecordCallback(Logger_Formatter_T formatter, Logger_Record_T record) {
+    assert(formatter);
+    assert(record);
+    (void) formatter;
+    const char *loggerName = Logger_Record_getLoggerName(record);
+    const char *file = Logger_Record_getFile(record);
+    const char *function = Logger_Record_getFunction(record);
+    Logger_String_T message = Logger_Record_getMessage(record);
+    OutputBuffer_T buffer = outputBufferAcquire();
+
+    outputBufferAppendString(&buffer, "{\"logger\":");
+    outputBufferAppendJsonString(&buffer, loggerName, strlen(loggerName));
+    outputBufferAppendString(&buffer, ",\"level\":\"");
+    outputBufferAppendString(&buffer, Logger_Level_getName(Logger_Record_getLevel(record)));
+    outputBufferAppendString(&buffer, "\",\"timestamp\":\"");
+    outputBufferAppendTimestamp(&buffer, Logger_Record_getTimestamp(record), "%Y-%m-%dT%H:%M:%SZ");
+    outputBufferAppendString(&buffer, "\",\"file\":");
+    outputBufferAppendJsonString(&buffer, file, strlen(file));
+    outputBufferAppendString(&buffer, ",\"line\":");
+    outputBufferAppendUnsigned(&buffer, Logger_Record_getLine(record));
+    outputBufferAppendString(&buffer, ",\"function\":");
+    outputBufferAppendJsonString(&buffer, function, strlen(function));
+    if (Logger_Record_getSuppressed(record) > 0) {
+        outputBufferAppendString(&buffer, ",\"suppressed\":");
+        outputBufferAppendUnsigned(&buffer, Logger_Record_getSuppressed(record));
+    }
+    outputBufferAppendString(&buffer, ",\"message\":");
+    outputBufferAppendJsonString(&buffer, message, strlen(message));
+    if (Logger_Record_getMdc(record)) {
+        outputBufferAppendString(&buffer, ",\"mdc\":");
+        outputBufferAppendJsonMdc(&buffer, Logger_Record_getMdc(record));
+    }
+    if (Logger_Record_getFieldsCount(record) > 0) {
+        outputBufferAppendString(&buffer, ",\"fields\":");
+        outputBufferAppendJsonFields(&buffer, Logger_Record_getFields(record), Logger_Record_getFieldsCount(record));
+    }
+    outputBufferAppendString(&buffer, "}\n");
+
+    return outputBufferRelease(&buffer);
+}
+
+static char *logfmtFormatRecordCallback(Logger_Formatter_T formatter, Logger_Record_T record) {
+    assert(formatter);
+    assert(record);
+    (void) formatter;
+    const char *loggerName = Logger_Record_getLoggerName(record);
+    const char *file = Logger_Record_getFile(record);
+    const char *function = Logger_Record_getFunction(record);
+    Logger_String_T message = Logger_Record_getMessage(record);
+    OutputBuffer_T buffer = outputBufferAcquire();
+
+    outputBufferAppendString(&buffer, "timestamp=");
+    outputBufferAppendTimestamp(&buffer, Logger_Record_getTimestamp(record), "%Y-%m-%dT%H:%M:%SZ");
+    outputBufferAppendString(&buffer, " level=");
+    outputBufferAppendString(&buffer, Logger_Level_getName(Logger_Record_getLevel(record)));
+    outputBufferAppendString(&buffer, " logger=");
+    outputBufferAppendLogfmtValue(&buffer, loggerName, strlen(loggerName));
+    outputBufferAppendString(&buffer, " file=");
+    outputBufferAppendLogfmtValue(&buffer, file, strlen(file));
+    outputBufferAppendString(&buffer, " line=");
+    outputBufferAppendUnsigned(&buffer, Logger_Record_getLine(record));
+    outputBufferAppendString(&buffer, " function=");
+    outputBufferAppendLogfmtValue(&buffer, function, strlen(function));
+    if (Logger_Record_getSuppressed(record) > 0) {
+        outputBufferAppendString(&buffer, " suppressed=");
+        outputBufferAppendUnsigned(&buffer, Logger_Record_getSuppressed(record));
+    }
+    outputBufferAppendString(&buffer, " message=");
+    outputBufferAppendLogfmtValue(&buffer, message, strlen(message));
+    outputBufferAppendLogfmtMdc(&buffer, Logger_Record_getMdc(record));
+    outputBufferAppendLogfmtFields(&buffer, Logger_Record_getFields(record), Logger_Record_getFieldsCount(record));
+    outputBufferAppendString(&buffer, "\n");
+
+    return outputBufferRelease(&buffer);
+}
+
+/*
+ * Binary Formatter
+ *
+ * Logger name, file and function are replaced by their id in the process wide interning table.
+ * Every formatter tracks which ids its stream has already seen. The bit of an id is set when the
+ * record carrying its definition is deleted, that is after the handler wrote it: until then every
+ * record using the id carries the definition too, so no record reaches the stream before it.
+ * The epoch frame is tracked the same way and carries the scope of the stream, so that repeats of
+ * it can be told apart from the start of a new stream, e.g. another run appending to the file.
+ */
+#define BINARY_FORMATTER_WORDS ((LOGGER_INTERN_CAPACITY + 63) / 64)
+
+typedef struct binaryFormatterContext {
+    time_t epoch;
+    uint64_t scope;
+    bool epochEmitted;
+    uint64_t emitted[BINARY_FORMATTER_WORDS];
+} *binaryFormatterContext;
+
+typedef struct binaryFormatterClaims {
+    binaryFormatterContext context;
+    uint64_t scope;
+    bool epoch;
+    size_t count;
+    uint32_t ids[3];
+} binaryFormatterClaims;
+
+/* the frames emitted by the last record formatted on this thread, confirmed when it is deleted */
+static __thread binaryFormatterClaims gBinaryFormatterClaims;
+
+/*
+ * Return a scope that is unlikely to be repeated by any other stream, in this process or another one.
+ */
+static uint64_t binaryFormatterNewScope(void) {
+    static uint64_t counter = 0;
+    struct timespec now;
+    clock_gettime(CLOCK_REALTIME, &now);
+    uint64_t scope = (uint64_t) now.tv_sec * UINT64_C(1000000000) + (uint64_t) now.tv_nsec;
+    scope ^= (uint64_t) getpid() << 32;
+    scope += __atomic_add_fetch(&counter, 1, __ATOMIC_RELAXED) * UINT64_C(0x9E3779B97F4A7C15);
+    scope = (scope ^ (scope >> 30)) * UINT64_C(0xBF58476D1CE4E5B9);  /* splitmix64 finalizer */
+    scope = (scope ^ (scope >> 27)) * UINT64_C(0x94D049BB133111EB);
+    return scope ^ (scope >> 31);
+}
+
+static void outputBufferAppendFrame(
+        OutputBuffer_T *buffer, const unsigned char *header, size_t headerSize, const char *body, size_t bodySize
+) {
+    assert(buffer);
+    assert(header);
+    assert(body);
+    unsigned char prefix[LOGGER_BINARY_VARINT_MAX_SIZE];
+    outputBufferAppend(buffer, (const char *) prefix, Logger_Binary_encodeVarint(headerSize + bodySize, prefix));
+    outputBufferAppend(buffer, (const char *) header, headerSize);
+    outputBufferAppend(buffer, body, bodySize);
+}
+
+/*
+ * Return the id of str, emitting its definition frame into buffer unless the stream already holds it.
+ */
+static uint64_t binaryFormatterIntern(
+        binaryFormatterContext context, binaryFormatterClaims *claims, OutputBuffer_T *buffer, const char *str
+) {
+    assert(context);
+    assert(claims);
+    assert(buffer);
+    assert(str);
+    const uint32_t id = Logger_Intern_getId(str);
+    if (LOGGER_INTERN_NO_ID == id) {
+        return id;  /* no definition maps to it, the record is still written */
+    }
+
+    if (!(__atomic_load_n(&context->emitted[id / 64], __ATOMIC_RELAXED) & (UINT64_C(1) << (id % 64)))) {
+        unsigned char header[1 + LOGGER_BINARY_VARINT_MAX_SIZE];
+        size_t headerSize = 0;
+        header[headerSize++] = LOGGER_BINARY_FRAME_DEFINITION;
+        headerSize += Logger_Binary_encodeVarint(id, header + headerSize);
+        outputBufferAppendFrame(buffer, header, headerSize, str, strlen(str));
+        claims->ids[claims->count++] = id;
+    }
+    return id;
+}
+
+/*
+ * Append data to buffer unless it is NULL, return length: the fields frame is measured and written by the same code.
+ */
+static size_t binaryFormatterAppend(OutputBuffer_T *buffer, const void *data, size_t length) {
+    assert(data);
+    if (buffer) {
+        outputBufferAppend(buffer, data, length);
+    }
+    return length;
+}
+
+static size_t binaryFormatterAppendVarint(OutputBuffer_T *buffer, uint64_t value) {
+    unsigned char varint[LOGGER_BINARY_VARINT_MAX_SIZE];
+    return binaryFormatterAppend(buffer, varint, Logger_Binary_encodeVarint(value, varint));
+}
+
+/*
+ * Append the payload of the fields frame, after its type byte, to buffer or just measure it if buffer is NULL.
+ */
+static size_t binaryFormatterAppendFields(OutputBuffer_T *buffer, const Logger_Field_T *fields, size_t fieldsCount) {
+    assert(fields);
+    size_t size = binaryFormatterAppendVarint(buffer, fieldsCount);
+    for (size_t i = 0; i < fieldsCount; i++) {
+        const Logger_Field_T *field = &fields[i];
+        const unsigned char type = (unsigned char) field->type;
+        const size_t keyLength = strlen(field->key);
+        size += binaryFormatterAppendVarint(buffer, keyLength);
+        size += binaryFormatterAppend(buffer, field->key, keyLength);
+        size += binaryFormatterAppend(buffer, &type, 1);
+        switch (field->type) {
+            case LOGGER_FIELD_TYPE_INT: {
+                unsigned char varint[LOGGER_BINARY_VARINT_MAX_SIZE];
+                size += binaryFormatterAppend(
+                        buffer, varint, Logger_Binary_encodeSignedVarint(field->value.asInt, varint)
+                );
+                break;
+            }
+            case LOGGER_FIELD_TYPE_UINT:
+                size += binaryFormatterAppendVarint(buffer, field->value.asUint);
+                break;
+            case LOGGER_FIELD_TYPE_DOUBLE: {
+                uint64_t bits;
+                unsigned char bytes[8];
+                memcpy(&bits, &field->value.asDouble, sizeof(bits));
+                for (size_t j = 0; j < sizeof(bytes); j++) {
+                    bytes[j] = (unsigned char) (bits >> (8 * j));
+                }
+                size += binaryFormatterAppend(buffer, bytes, sizeof(bytes));
+                break;
+            }
+            case LOGGER_FIELD_TYPE_BOOL: {
+                const unsigned char value = field->value.asBool ? 1 : 0;
+                size += binaryFormatterAppend(buffer, &value, 1);
+                break;
+            }
+            default: {
+                const char *value = fieldString(field);
+                const size_t length = strlen(value);
+                size += binaryFormatterAppendVarint(buffer, length);
+                size += binaryFormatterAppend(buffer, value, length);
+                break;
+            }
+        }
+    }
+    return size;
+}
+
+/*
+ * Append the payload of the context frame, after its type byte, to buffer or just measure it if buffer is NULL.
+ */
+static size_t binaryFormatterAppendMdc(OutputBuffer_T *buffer, Logger_Mdc_T mdc) {
+    assert(mdc);
+    const Logger_Mdc_Entry_T *entries = Logger_Mdc_getEntries(mdc);
+    size_t size = binaryFormatterAppendVarint(buffer, Logger_Mdc_getSize(mdc));
+    for (size_t i = 0; i < Logger_Mdc_getSize(mdc); i++) {
+        const size_t keyLength = strlen(entries[i].key), valueLength = strlen(entries[i].value);
+        size += binaryFormatterAppendVarint(buffer, keyLength);
+        size += binaryFormatterAppend(buffer, entries[i].key, keyLength);
+        size += binaryFormatterAppendVarint(buffer, valueLength);
+        size += binaryFormatterAppend(buffer, entries[i].value, valueLength);
+    }
+    return size;
+}
+
+static char *binaryFormatRecordCallback(Logger_Formatter_T formatter, Logger_Record_T record) {
+    assert(formatter);
+    assert(record);
+    binaryFormatterContext context = Logger_Formatter_getContext(formatter);
+    Logger_String_T message = Logger_Record_getMessage(record);
+    OutputBuffer_T buffer = outputBufferAcquire();
+    binaryFormatterClaims claims = {
+            .context=context, .scope=__atomic_load_n(&context->scope, __ATOMIC_RELAXED), .epoch=false, .count=0
+    };
+    unsigned char header[1 + 6 * LOGGER_BINARY_VARINT_MAX_SIZE];
+    size_t headerSize = 0;
+
+    if (!__atomic_load_n(&context->epochEmitted, __ATOMIC_RELAXED)) {
+        header[headerSize++] = LOGGER_BINARY_FRAME_EPOCH;
+        headerSize += Logger_Binary_encodeSignedVarint(context->epoch, header + headerSize);
+        headerSize += Logger_Binary_encodeVarint(claims.scope, header + headerSize);
+        outputBufferAppendFrame(&buffer, header, headerSize, "", 0);
+        claims.epoch = true;
+        headerSize = 0;
+    }
+    const uint64_t loggerNameId = binaryFormatterIntern(context, &claims, &buffer, Logger_Record_getLoggerName(record));
+    const uint64_t fileId = binaryFormatterIntern(context, &claims, &buffer, Logger_Record_getFile(record));
+    const uint64_t functionId = binaryFormatterIntern(context, &claims, &buffer, Logger_Record_getFunction(record));
+
+    if (Logger_Record_getSuppressed(record) > 0) {
+        header[headerSize++] = LOGGER_BINARY_FRAME_SUPPRESSED;
+        headerSize += Logger_Binary_encodeVarint(Logger_Record_getSuppressed(record), header + headerSize);
+        outputBufferAppendFrame(&buffer, header, headerSize, "", 0);
+        headerSize = 0;
+    }
+    if (Logger_Record_getFieldsCount(record) > 0) {
+        const Logger_Field_T *fields = Logger_Record_getFields(record);
+        const size_t fieldsCount = Logger_Record_getFieldsCount(record);
+        unsigned char prefix[LOGGER_BINARY_VARINT_MAX_SIZE];
+        const unsigned char type = LOGGER_BINARY_FRAME_FIELDS;
+        const size_t payloadSize = 1 + binaryFormatterAppendFields(NULL, fields, fieldsCount);
+        outputBufferAppend(&buffer, (const char *) prefix, Logger_Binary_encodeVarint(payloadSize, prefix));
+        outputBufferAppend(&buffer, (const char *) &type, 1);
+        binaryFormatterAppendFields(&buffer, fields, fieldsCount);
+    }
+    if (Logger_Record_getMdc(record)) {
+        Logger_Mdc_T mdc = Logger_Record_getMdc(record);
+        unsigned char prefix[LOGGER_BINARY_VARINT_MAX_SIZE];
+        const unsigned char type = LOGGER_BINARY_FRAME_MDC;
+        const size_t payloadSize = 1 + binaryFormatterAppendMdc(NULL, mdc);
+        outputBufferAppend(&buffer, (const char *) prefix, Logger_Binary_encodeVarint(payloadSize, prefix));
+        outputBufferAppend(&buffer, (const char *) &type, 1);
+        binaryFormatterAppendMdc(&buffer, mdc);
+    }
+    const Logger_Level_T level = Logger_Record_getLevel(record);
+    header[headerSize++] = LOGGER_BINARY_FRAME_RECORD;
+    headerSize += Logger_Binary_encodeVarint((uint64_t) level, header + headerSize);
+    headerSize += Logger_Binary_encodeVarint(Logger_Record_getLine(record), header + headerSize);
+    headerSize += Logger_Binary_encodeSignedVarint(Logger_Record_getTimestamp(record) - context->epoch, header + headerSize);
+    headerSize += Logger_Binary_encodeVarint(loggerNameId, header + headerSize);
+    headerSize += Logger_Binary_encodeVarint(fileId, header + headerSize);
+    headerSize += Logger_Binary_encodeVarint(functionId, header + headerSize);
+    outputBufferAppendFrame(&buffer, header, headerSize, message, strlen(message));
+
+    /* on failure the record is dropped, so are the frames it carried */
+    gBinaryFormatterClaims = buffer.failed ? (binaryFormatterClaims) {.context=NULL} : claims;
+    return outputBufferRelease(&buffer);
+}
+
+/*
+ * The handler is done with the record: mark the frames it carried as part of the stream.
+ */
+static void binaryDeleteCallback(Logger_Formatter_T formatter, char *formattedRecord) {
+    assert(formatter);
+    binaryFormatterContext context = Logger_Formatter_getContext(formatter);
+    binaryFormatterClaims *claims = &gBinaryFormatterClaims;
+    outputBufferDeleteCallback(formatter, formattedRecord);
+    if (context != claims->context || claims->scope != __atomic_load_n(&context->scope, __ATOMIC_RELAXED)) {
+        return;  /* formatted by another formatter or before a reset */
+    }
+    if (claims->epoch) {
+        __atomic_store_n(&context->epochEmitted, true, __ATOMIC_RELAXED);
+    }
+    for (size_t i = 0; i < claims->count; i++) {
+        const uint32_t id = claims->ids[i];
+        __atomic_fetch_or(&context->emitted[id / 64], UINT64_C(1) << (id % 64), __ATOMIC_RELAXED);
+    }
+    claims->context = NULL;
+}
+
+/*
+ * Write the epoch and the definitions again from the next record on, e.g. at the start of a new file.
+ */
+static void binaryResetCallback(Logger_Formatter_T formatter) {
+    assert(formatter);
+    binaryFormatterContext context = Logger_Formatter_getContext(formatter);
+    __atomic_store_n(&context->scope, binaryFormatterNewScope(), __ATOMIC_RELAXED);
+    __atomic_store_n(&context->epochEmitted, false, __ATOMIC_RELAXED);
+    for (size_t i = 0; i < BINARY_FORMATTER_WORDS; i++) {
+        __atomic_store_n(&context->emitted[i], 0, __ATOMIC_RELAXED);
+    }
+}
+
+static void binaryCloseCallback(Logger_Formatter_T formatter) {
+    assert(formatter);
+    Logger_Alloc_free(Logger_Formatter_getContext(formatter));
 }
 
 /*
  * Logger Formatters
  */
 Logger_Formatter_T Logger_Formatter_newSimpleFormatter(void) {
-    return Logger_Formatter_new(formatRecordCallback, deleteFormattedRecordCallback);
+    Logger_Formatter_T self = Logger_Formatter_newContextual(formatRecordCallback, arenaDeleteCallback);
+    if (self) {
+        Logger_Formatter_setSizeFormattedRecordCallback(self, stringSizeCallback);
+    }
+    return self;
+}
+
+Logger_Formatter_T Logger_Formatter_newJsonFormatter(void) {
+    Logger_Formatter_T self = Logger_Formatter_newContextual(jsonFormatRecordCallback, outputBufferDeleteCallback);
+    if (self) {
+        Logger_Formatter_setSizeFormattedRecordCallback(self, sdsSizeCallback);
+    }
+    return self;
+}
+
+Logger_Formatter_T Logger_Formatter_newLogfmtFormatter(void) {
+    Logger_Formatter_T self = Logger_Formatter_newContextual(logfmtFormatRecordCallback, outputBufferDeleteCallback);
+    if (self) {
+        Logger_Formatter_setSizeFormattedRecordCallback(self, sdsSizeCallback);
+    }
+    return self;
+}
+
+Logger_Formatter_T Logger_Formatter_newBinaryFormatter(void) {
+    Logger_Formatter_T self = NULL;
+    binaryFormatterContext context = Logger_Alloc_calloc(1, sizeof(*context));
+    if (!context) {
+        return NULL;
+    }
+    context->epoch = time(NULL);
+    context->scope = binaryFormatterNewScope();
+
+    self = Logger_Formatter_newContextual(binaryFormatRecordCallback, binaryDeleteCallback);
+    if (!self) {
+        Logger_Alloc_free(context);
+        return NULL;
+    }
+    Logger_Formatter_setContext(self, context);
+    Logger_Formatter_setSizeFormattedRecordCallback(self, sdsSizeCallback);
+    Logger_Formatter_setCloseCallback(self, binaryCloseCallback);
+    Logger_Formatter_setResetCallback(self, binaryResetCallback);
+    return self;
 }
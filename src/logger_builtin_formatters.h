@@ -25,6 +25,49 @@ extern "C" {
  */
 extern Logger_Formatter_T Logger_Formatter_newSimpleFormatter(void);
 
+/**
+ * Allocates and initializes a Logger_Formatter_T that emits every record as a single-line JSON object
+ * (JSON lines) holding logger name, level, timestamp (ISO 8601, UTC), file, line, function and message;
+ * the structured fields of the record, if any, are nested in a "fields" object.
+ * The formatted record is built in a per-thread buffer that is reused across records.
+ *
+ * Checked runtime errors:
+ *  - In case of OOM this function will return NULL.
+ *
+ * @return A new instance of a JSON Logger_Formatter_T.
+ */
+extern Logger_Formatter_T Logger_Formatter_newJsonFormatter(void);
+
+/**
+ * Allocates and initializes a Logger_Formatter_T that emits every record as a length-prefixed binary frame
+ * (see logger_binary.h) where logger name, file and function are replaced by their id in the interning table
+ * (see logger_intern.h); the definition of an id is emitted in front of the records using it until one of them
+ * has been handed back (see Logger_Formatter_deleteFormattedRecord), file handlers reset the formatter whenever
+ * they open a file (see Logger_Formatter_reset). Once the table is full new strings
+ * are written as LOGGER_INTERN_NO_ID, which no definition maps to.
+ * Each output stream must have its own binary formatter; use logger-decode to turn the output back into text.
+ *
+ * Checked runtime errors:
+ *  - In case of OOM this function will return NULL.
+ *
+ * @return A new instance of a binary Logger_Formatter_T.
+ */
+extern Logger_Formatter_T Logger_Formatter_newBinaryFormatter(void);
+
+/**
+ * Allocates and initializes a Logger_Formatter_T that emits every record as a logfmt line: space separated
+ * key=value pairs for timestamp, level, logger, file, line, function and message followed by the structured
+ * fields of the record. Values are quoted, and escaped as JSON strings, only when they hold spaces, control
+ * characters, equal signs, quotation marks or reverse solidi, or are empty.
+ * The formatted record is built in a per-thread buffer that is reused across records.
+ *
+ * Checked runtime errors:
+ *  - In case of OOM this function will return NULL.
+ *
+ * @return A new instance of a logfmt Logger_Formatter_T.
+ */
+extern Logger_Formatter_T Logger_Formatter_newLogfmtFormatter(void);
+
 #ifdef __cplusplus
 }
 #endif
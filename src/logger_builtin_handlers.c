@@ -9,9 +9,15 @@
 #include <errno.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <assert.h>
+#include <dirent.h>
+#include <stdint.h>
+#include <pthread.h>
+#include "logger_alloc.h"
 #include "sds/sds.h"
 #include "logger_err.h"
+#include "logger_clock.h"
 #include "logger_stream.h"
 #include "logger_builtin_handlers.h"
 
@@ -23,6 +29,30 @@ static void invalidate_ptr(void **ref, void destructor()) {
     *ref = NULL;
 }
 
+/*
+ * Write the formatted record as is, binary formatters may produce NUL bytes.
+ * Returns the number of bytes written or -1 on error.
+ */
+static long writeFormattedRecord(FILE *file, Logger_Formatter_T formatter, const char *log) {
+    assert(file);
+    assert(formatter);
+    assert(log);
+    const size_t size = Logger_Formatter_sizeFormattedRecord(formatter, log);
+    if (size > 0 && fwrite(log, 1, size, file) != size) {
+        return -1;
+    }
+    return (long) size;
+}
+
+/*
+ * The size of a file opened for appending, the records already in it are kept.
+ */
+static size_t fileSize(FILE *file) {
+    assert(file);
+    const long size = 0 == fseek(file, 0, SEEK_END) ? ftell(file) : -1;
+    return size > 0 ? (size_t) size : 0;
+}
+
 /*
  * Console Handler
  */
@@ -41,10 +71,12 @@ static Logger_Err_T consoleHandlerPublishCallback(Logger_Handler_T handler, Logg
             break;
         }
 
-        if (fprintf(file, "%s", log) < 0) {
+        const long bytesWritten = writeFormattedRecord(file, formatter, log);
+        if (bytesWritten < 0) {
             err = LOGGER_ERR_IO;
             break;
         }
+        Logger_Handler_addBytesWritten(handler, (size_t) bytesWritten);
     } while (false);
 
     Logger_Formatter_deleteFormattedRecord(formatter, log);
@@ -104,10 +136,12 @@ static Logger_Err_T fileHandlerPublishCallback(Logger_Handler_T handler, Logger_
             break;
         }
 
-        if (fprintf(file, "%s", log) < 0) {
+        const long bytesWritten = writeFormattedRecord(file, formatter, log);
+        if (bytesWritten < 0) {
             err = LOGGER_ERR_IO;
             break;
         }
+        Logger_Handler_addBytesWritten(handler, (size_t) bytesWritten);
     } while (false);
 
     Logger_Formatter_deleteFormattedRecord(formatter, log);
@@ -135,7 +169,7 @@ Logger_Handler_Result_T Logger_Handler_newFileHandler(
     Logger_Handler_T self = NULL;
 
     do {
-        FILE *file = fopen(filePath, "w");
+        FILE *file = fopen(filePath, "a");
         if (!file) {
             err = Logger_Err_fromErrno(errno);
             break;
@@ -151,6 +185,7 @@ Logger_Handler_Result_T Logger_Handler_newFileHandler(
         Logger_Handler_setContext(self, file);
         Logger_Handler_setLevel(self, level);
         Logger_Handler_setFormatter(self, formatter);
+        Logger_Formatter_reset(formatter);
     } while (false);
 
     return (Logger_Handler_Result_T) {.err=err, .handler=self};
@@ -165,8 +200,62 @@ typedef struct rotatingFileHandlerContext {
     size_t rotationCounter;
     const char *filePath;
     FILE *file;
+    Logger_Archiver_T archiver;
 } *rotatingFileHandlerContext;
 
+/*
+ * Return the counter to start from so that the archives of a previous run are never overwritten:
+ * the highest N of an existing filePath.N, or the one after the highest archived filePath.N.lgz (or .gz).
+ */
+static size_t rotatingFileHandlerFirstCounter(const char *filePath) {
+    size_t counter = 0;
+    const char *slash = strrchr(filePath, '/');
+    const char *baseName = slash ? slash + 1 : filePath;
+    const size_t baseNameLength = strlen(baseName);
+    sds directoryPath = slash ? sdsnewlen(filePath, slash == filePath ? 1 : (size_t) (slash - filePath)) : sdsnew(".");
+    DIR *directory = directoryPath ? opendir(directoryPath) : NULL;
+    sdsfree(directoryPath);
+    if (!directory) {
+        return counter;  /* nothing can be found, rotating may still work */
+    }
+
+    const struct dirent *entry;
+    while ((entry = readdir(directory))) {
+        const char *name = entry->d_name;
+        if (strncmp(name, baseName, baseNameLength) || '.' != name[baseNameLength] ||
+            name[baseNameLength + 1] < '0' || name[baseNameLength + 1] > '9') {
+            continue;
+        }
+        char *end = NULL;
+        errno = 0;
+        const unsigned long long n = strtoull(name + baseNameLength + 1, &end, 10);
+        if (errno || n >= SIZE_MAX) {
+            continue;
+        }
+        if ('\0' == *end && n > counter) {
+            counter = (size_t) n;
+        } else if ((0 == strcmp(end, ".lgz") || 0 == strcmp(end, ".gz")) && n + 1 > counter) {
+            counter = (size_t) n + 1;
+        }
+    }
+    closedir(directory);
+    return counter;
+}
+
+/*
+ * Hand the file just closed to the archiver, if it can not be queued it stays as is.
+ */
+static void rotatingFileHandlerArchive(rotatingFileHandlerContext context) {
+    sds rotatedFilePath = sdsempty();
+    if (rotatedFilePath) {
+        rotatedFilePath = sdscatprintf(rotatedFilePath, "%s.%zu", context->filePath, context->rotationCounter - 1);
+    }
+    if (rotatedFilePath) {
+        Logger_Archiver_submit(context->archiver, rotatedFilePath);
+    }
+    sdsfree(rotatedFilePath);
+}
+
 static Logger_Err_T rotatingFileHandlerPublishCallback(Logger_Handler_T handler, Logger_Record_T record) {
     assert(handler);
     assert(record);
@@ -177,12 +266,6 @@ static Logger_Err_T rotatingFileHandlerPublishCallback(Logger_Handler_T handler,
     rotatingFileHandlerContext context = Logger_Handler_getContext(handler);
 
     do {
-        log = Logger_Formatter_formatRecord(formatter, record);
-        if (!log) {
-            err = LOGGER_ERR_OUT_OF_MEMORY;
-            break;
-        }
-
         if (context->bytesWritten >= context->BYTES_BEFORE_ROTATION) { /* rotate */
             Logger_Handler_flush(handler);
             context->rotationCounter++;
@@ -198,7 +281,7 @@ static Logger_Err_T rotatingFileHandlerPublishCallback(Logger_Handler_T handler,
                 break;
             }
 
-            FILE *newFile = fopen(realFilePath, "w");
+            FILE *newFile = fopen(realFilePath, "a");
             invalidate_ptr((void **) &realFilePath, sdsfree);
             if (!newFile) {
                 err = Logger_Err_fromErrno(errno);
@@ -207,15 +290,26 @@ static Logger_Err_T rotatingFileHandlerPublishCallback(Logger_Handler_T handler,
 
             fclose(context->file);
             context->file = newFile;
-            context->bytesWritten = 0;
+            context->bytesWritten = fileSize(newFile);
+            Logger_Formatter_reset(formatter);  /* each file must be readable on its own */
+            if (context->archiver) {
+                rotatingFileHandlerArchive(context);
+            }
         }
 
-        const int bytesWritten = fprintf(context->file, "%s", log);
+        log = Logger_Formatter_formatRecord(formatter, record);
+        if (!log) {
+            err = LOGGER_ERR_OUT_OF_MEMORY;
+            break;
+        }
+
+        const long bytesWritten = writeFormattedRecord(context->file, formatter, log);
         if (bytesWritten < 0) {
             err = LOGGER_ERR_IO;
             break;
         }
         context->bytesWritten += bytesWritten;
+        Logger_Handler_addBytesWritten(handler, (size_t) bytesWritten);
     } while (false);
 
     Logger_Formatter_deleteFormattedRecord(formatter, log);
@@ -234,21 +328,19 @@ static void rotatingFileHandlerCloseCallback(Logger_Handler_T handler) {
     assert(handler);
     rotatingFileHandlerContext context = Logger_Handler_getContext(handler);
     fclose(context->file);
-    free(context);
+    Logger_Alloc_free(context);
 }
 
-Logger_Handler_Result_T Logger_Handler_newRotatingFileHandler(
-        Logger_Level_T level, Logger_Formatter_T formatter, const char *filePath, size_t bytesBeforeRotation
+static Logger_Handler_Result_T newRotatingFileHandler(
+        Logger_Level_T level, Logger_Formatter_T formatter, const char *filePath, size_t bytesBeforeRotation,
+        Logger_Archiver_T archiver
 ) {
-    assert(filePath);
-    assert(LOGGER_LEVEL_DEBUG <= level && level <= LOGGER_LEVEL_FATAL);
-    assert(formatter);
     FILE *file = NULL;
     sds realFilePath = NULL;
     Logger_Handler_T self = NULL;
     Logger_Err_T err = LOGGER_ERR_OK;
     rotatingFileHandlerContext context = NULL;
-    const size_t ROTATION_COUNTER = 0;
+    const size_t ROTATION_COUNTER = rotatingFileHandlerFirstCounter(filePath);
 
     realFilePath = sdsempty();
     if (!realFilePath) {
@@ -262,22 +354,23 @@ Logger_Handler_Result_T Logger_Handler_newRotatingFileHandler(
         goto cleanup;
     }
 
-    file = fopen(realFilePath, "w");
+    file = fopen(realFilePath, "a");
     if (!file) {
         err = Logger_Err_fromErrno(errno);
         goto cleanup;
     }
 
-    context = malloc(sizeof(*context));
+    context = Logger_Alloc_malloc(sizeof(*context));
     if (!context) {
         err = LOGGER_ERR_OUT_OF_MEMORY;
         goto cleanup;
     }
     context->file = file;
     context->filePath = filePath;
-    context->bytesWritten = 0;
+    context->bytesWritten = fileSize(file);
     context->rotationCounter = ROTATION_COUNTER;
     context->BYTES_BEFORE_ROTATION = bytesBeforeRotation;
+    context->archiver = archiver;
 
     self = Logger_Handler_new(rotatingFileHandlerPublishCallback, rotatingFileHandlerFlushCallback, rotatingFileHandlerCloseCallback);
     if (!self) {
@@ -287,6 +380,7 @@ Logger_Handler_Result_T Logger_Handler_newRotatingFileHandler(
     Logger_Handler_setLevel(self, level);
     Logger_Handler_setContext(self, context);
     Logger_Handler_setFormatter(self, formatter);
+    Logger_Formatter_reset(formatter);
 
     exit:
     {
@@ -298,11 +392,31 @@ Logger_Handler_Result_T Logger_Handler_newRotatingFileHandler(
         if (file) {
             fclose(file);
         }
-        free(context);
+        Logger_Alloc_free(context);
         goto exit;
     }
 }
 
+Logger_Handler_Result_T Logger_Handler_newRotatingFileHandler(
+        Logger_Level_T level, Logger_Formatter_T formatter, const char *filePath, size_t bytesBeforeRotation
+) {
+    assert(filePath);
+    assert(LOGGER_LEVEL_DEBUG <= level && level <= LOGGER_LEVEL_FATAL);
+    assert(formatter);
+    return newRotatingFileHandler(level, formatter, filePath, bytesBeforeRotation, NULL);
+}
+
+Logger_Handler_Result_T Logger_Handler_newArchivingRotatingFileHandler(
+        Logger_Level_T level, Logger_Formatter_T formatter, const char *filePath, size_t bytesBeforeRotation,
+        Logger_Archiver_T archiver
+) {
+    assert(filePath);
+    assert(LOGGER_LEVEL_DEBUG <= level && level <= LOGGER_LEVEL_FATAL);
+    assert(formatter);
+    assert(archiver);
+    return newRotatingFileHandler(level, formatter, filePath, bytesBeforeRotation, archiver);
+}
+
 /*
  * Memory File Handler
  */
@@ -331,12 +445,13 @@ static Logger_Err_T memoryFileHandlerPublishCallback(Logger_Handler_T handler, L
             fflush(context->file);
         }
 
-        const int bytesStored = fprintf(context->file, "%s", log);
+        const long bytesStored = writeFormattedRecord(context->file, formatter, log);
         if (bytesStored < 0) {
             err = LOGGER_ERR_IO;
             break;
         }
         context->bytesStored += bytesStored;
+        Logger_Handler_addBytesWritten(handler, (size_t) bytesStored);
     } while (false);
 
     Logger_Formatter_deleteFormattedRecord(formatter, log);
@@ -353,7 +468,7 @@ static void memoryFileHandlerCloseCallback(Logger_Handler_T handler) {
     assert(handler);
     memoryFileHandlerContext context = Logger_Handler_getContext(handler);
     fclose(context->file);
-    free(context);
+    Logger_Alloc_free(context);
 }
 
 /* TODO: use a custom buffer */
@@ -368,13 +483,13 @@ Logger_Handler_Result_T Logger_Handler_newMemoryFileHandler(
     Logger_Err_T err = LOGGER_ERR_OK;
     memoryFileHandlerContext context = NULL;
 
-    file = fopen(filePath, "w");
+    file = fopen(filePath, "a");
     if (!file) {
         err = Logger_Err_fromErrno(errno);
         goto cleanup;
     }
 
-    context = malloc(sizeof(*context));
+    context = Logger_Alloc_malloc(sizeof(*context));
     if (!context) {
         err = LOGGER_ERR_OUT_OF_MEMORY;
         goto cleanup;
@@ -391,6 +506,7 @@ Logger_Handler_Result_T Logger_Handler_newMemoryFileHandler(
     Logger_Handler_setLevel(self, level);
     Logger_Handler_setContext(self, context);
     Logger_Handler_setFormatter(self, formatter);
+    Logger_Formatter_reset(formatter);
 
     exit:
     {
@@ -401,7 +517,569 @@ Logger_Handler_Result_T Logger_Handler_newMemoryFileHandler(
         if (file) {
             fclose(file);
         }
-        free(context);
+        Logger_Alloc_free(context);
         goto exit;
     }
 }
+
+/*
+ * Dedup Handler
+ *
+ * The content of the last record is kept serialized, the record handed to publish does not outlive the call.
+ * When a timeout is set a timer thread publishes the pending repeats of a run once it expires.
+ */
+typedef struct dedupHandlerContext {
+    uint64_t TIMEOUT;
+    Logger_Handler_T handler;
+    pthread_t timer;
+    pthread_mutex_t mutex;
+    pthread_cond_t changed;
+    bool stopping;
+    bool hasLast;
+    uint64_t lastHash;
+    sds lastContent;
+    sds content;
+    Logger_Level_T lastLevel;
+    const Logger_CallSite_T *lastCallSite;
+    sds lastLoggerName;
+    sds lastFile;
+    sds lastFunction;
+    size_t lastLine;
+    size_t repeated;
+    uint64_t runStart;
+} *dedupHandlerContext;
+
+static uint64_t dedupHandlerHash(const void *data, size_t size) {
+    assert(data);
+    const unsigned char *bytes = data;
+    uint64_t hash = UINT64_C(14695981039346656037); /* FNV-1a */
+    for (size_t i = 0; i < size; i++) {
+        hash = (hash ^ bytes[i]) * UINT64_C(1099511628211);
+    }
+    return hash;
+}
+
+/*
+ * Append size bytes of data to content, which is left as is when out of memory.
+ */
+static bool dedupHandlerAppend(sds *content, const void *data, size_t size) {
+    assert(content);
+    assert(data);
+    sds grown = sdscatlen(*content, data, size);
+    if (!grown) {
+        return false;
+    }
+    *content = grown;
+    return true;
+}
+
+/*
+ * Serialize the message, the context and the fields of a record into content, string fields by content and the
+ * others by value. Returns false when out of memory.
+ */
+static bool dedupHandlerSerialize(sds *content, Logger_Record_T record) {
+    assert(content);
+    assert(record);
+    const char *message = Logger_Record_getMessage(record);
+    const Logger_Field_T *fields = Logger_Record_getFields(record);
+    Logger_Mdc_T mdc = Logger_Record_getMdc(record);
+    const size_t mdcSize = mdc ? Logger_Mdc_getSize(mdc) : 0;
+    sdsclear(*content);
+    bool ok = dedupHandlerAppend(content, message, strlen(message) + 1) &&
+              dedupHandlerAppend(content, &mdcSize, sizeof(mdcSize));
+    for (size_t i = 0; ok && i < mdcSize; i++) {
+        const Logger_Mdc_Entry_T *entry = &Logger_Mdc_getEntries(mdc)[i];
+        ok = dedupHandlerAppend(content, entry->key, strlen(entry->key) + 1) &&
+             dedupHandlerAppend(content, entry->value, strlen(entry->value) + 1);
+    }
+    for (size_t i = 0; ok && i < Logger_Record_getFieldsCount(record); i++) {
+        const Logger_Field_T *field = &fields[i];
+        ok = dedupHandlerAppend(content, field->key, strlen(field->key) + 1) &&
+             dedupHandlerAppend(content, &field->type, sizeof(field->type));
+        switch (field->type) {
+            case LOGGER_FIELD_TYPE_INT:
+                ok = ok && dedupHandlerAppend(content, &field->value.asInt, sizeof(field->value.asInt));
+                break;
+            case LOGGER_FIELD_TYPE_UINT:
+                ok = ok && dedupHandlerAppend(content, &field->value.asUint, sizeof(field->value.asUint));
+                break;
+            case LOGGER_FIELD_TYPE_DOUBLE:
+                ok = ok && dedupHandlerAppend(content, &field->value.asDouble, sizeof(field->value.asDouble));
+                break;
+            case LOGGER_FIELD_TYPE_BOOL:
+                ok = ok && dedupHandlerAppend(content, &field->value.asBool, sizeof(field->value.asBool));
+                break;
+            default:
+                /* a NULL string is a lone 0 byte, unlike the empty one */
+                ok = ok && dedupHandlerAppend(content, field->value.asStr ? "\1" : "\0", 1);
+                if (field->value.asStr) {
+                    ok = ok && dedupHandlerAppend(content, field->value.asStr, strlen(field->value.asStr) + 1);
+                }
+                break;
+        }
+    }
+    return ok;
+}
+
+static sds dedupHandlerCopy(sds dst, const char *src) {
+    assert(src);
+    return dst ? sdscpy(dst, src) : sdsnew(src);
+}
+
+/*
+ * Must be called holding context->mutex.
+ */
+static Logger_Err_T dedupHandlerPublishRepeated(dedupHandlerContext context) {
+    assert(context);
+    Logger_Err_T err = LOGGER_ERR_OK;
+    Logger_String_T message = NULL;
+    Logger_Record_T record = NULL;
+
+    if (0 == context->repeated) {
+        return err;
+    }
+    do {
+        message = Logger_String_from("last message repeated %zu times", context->repeated);
+        if (!message) {
+            err = LOGGER_ERR_OUT_OF_MEMORY;
+            break;
+        }
+        record = Logger_Record_new(
+                context->lastLoggerName, context->lastLevel, context->lastFile, context->lastLine,
+                context->lastFunction, time(NULL), message
+        );
+        if (!record) {
+            err = LOGGER_ERR_OUT_OF_MEMORY;
+            break;
+        }
+        err = Logger_Handler_publish(context->handler, record);
+    } while (false);
+
+    context->repeated = 0;
+    if (record) {
+        Logger_Record_delete(&record);
+    }
+    if (message) {
+        Logger_String_delete(&message);
+    }
+    return err;
+}
+
+/*
+ * Publish the pending repeats if the run timed out, must be called holding context->mutex.
+ */
+static Logger_Err_T dedupHandlerPublishExpired(dedupHandlerContext context) {
+    assert(context);
+    Logger_Err_T err = LOGGER_ERR_OK;
+    if (context->TIMEOUT > 0 && context->repeated > 0 &&
+        Logger_Clock_getMonotonicTime() - context->runStart >= context->TIMEOUT) {
+        err = dedupHandlerPublishRepeated(context);
+        context->runStart = Logger_Clock_getMonotonicTime();
+    }
+    return err;
+}
+
+/*
+ * Remember the record whose content was serialized into context->content, must be called holding context->mutex.
+ */
+static Logger_Err_T dedupHandlerRemember(dedupHandlerContext context, Logger_Record_T record, uint64_t hash) {
+    assert(context);
+    assert(record);
+    sds loggerName = dedupHandlerCopy(context->lastLoggerName, Logger_Record_getLoggerName(record));
+    if (loggerName) {
+        context->lastLoggerName = loggerName;
+    }
+    sds file = dedupHandlerCopy(context->lastFile, Logger_Record_getFile(record));
+    if (file) {
+        context->lastFile = file;
+    }
+    sds function = dedupHandlerCopy(context->lastFunction, Logger_Record_getFunction(record));
+    if (function) {
+        context->lastFunction = function;
+    }
+    if (!loggerName || !file || !function) {
+        context->hasLast = false; /* never collapse against a record we could not describe */
+        return LOGGER_ERR_OUT_OF_MEMORY;
+    }
+    sds content = context->lastContent;
+    context->lastContent = context->content;
+    context->content = content;
+    context->hasLast = true;
+    context->lastHash = hash;
+    context->lastLevel = Logger_Record_getLevel(record);
+    context->lastCallSite = Logger_Record_getCallSite(record);
+    context->lastLine = Logger_Record_getLine(record);
+    context->runStart = Logger_Clock_getMonotonicTime();
+    return LOGGER_ERR_OK;
+}
+
+/*
+ * Must be called holding context->mutex, after the record was serialized into context->content.
+ */
+static bool dedupHandlerIsRepeated(dedupHandlerContext context, Logger_Record_T record, uint64_t hash) {
+    assert(context);
+    assert(record);
+    if (!context->hasLast || context->lastHash != hash || context->lastLevel != Logger_Record_getLevel(record) ||
+        sdslen(context->lastContent) != sdslen(context->content) ||
+        0 != memcmp(context->lastContent, context->content, sdslen(context->content))) {
+        return false;
+    }
+    if (context->lastCallSite || Logger_Record_getCallSite(record)) {
+        return context->lastCallSite == Logger_Record_getCallSite(record);
+    }
+    return context->lastLine == Logger_Record_getLine(record) &&
+           0 == strcmp(context->lastFile, Logger_Record_getFile(record)) &&
+           0 == strcmp(context->lastFunction, Logger_Record_getFunction(record));
+}
+
+static void *dedupHandlerTimer(void *arg) {
+    dedupHandlerContext context = arg;
+    pthread_mutex_lock(&context->mutex);
+    while (!context->stopping) {
+        if (0 == context->repeated) {
+            pthread_cond_wait(&context->changed, &context->mutex);
+            continue;
+        }
+        const uint64_t deadline = context->runStart + context->TIMEOUT;
+        if (Logger_Clock_getMonotonicTime() < deadline) {
+            const struct timespec timeout = {
+                    .tv_sec=(time_t) (deadline / UINT64_C(1000000000)),
+                    .tv_nsec=(long) (deadline % UINT64_C(1000000000))
+            };
+            pthread_cond_timedwait(&context->changed, &context->mutex, &timeout);
+            continue;
+        }
+        dedupHandlerPublishExpired(context);
+    }
+    pthread_mutex_unlock(&context->mutex);
+    return NULL;
+}
+
+static Logger_Err_T dedupHandlerPublishCallback(Logger_Handler_T handler, Logger_Record_T record) {
+    assert(handler);
+    assert(record);
+    Logger_Err_T err = LOGGER_ERR_OK;
+    dedupHandlerContext context = Logger_Handler_getContext(handler);
+
+    pthread_mutex_lock(&context->mutex);
+    if (!dedupHandlerSerialize(&context->content, record)) {
+        context->hasLast = false;  /* forward the record as is */
+        err = dedupHandlerPublishRepeated(context);
+        const Logger_Err_T publishErr = Logger_Handler_publish(context->handler, record);
+        pthread_mutex_unlock(&context->mutex);
+        return LOGGER_ERR_OK != err ? err : publishErr;
+    }
+    const uint64_t hash = dedupHandlerHash(context->content, sdslen(context->content));
+    if (dedupHandlerIsRepeated(context, record, hash)) {
+        if (0 == context->repeated++) {
+            pthread_cond_signal(&context->changed);  /* arm the timer */
+        }
+        err = dedupHandlerPublishExpired(context);
+    } else {
+        err = dedupHandlerPublishRepeated(context);
+        const Logger_Err_T publishErr = Logger_Handler_publish(context->handler, record);
+        const Logger_Err_T rememberErr = dedupHandlerRemember(context, record, hash);
+        if (LOGGER_ERR_OK == err) {
+            err = LOGGER_ERR_OK != publishErr ? publishErr : rememberErr;
+        }
+    }
+    pthread_mutex_unlock(&context->mutex);
+    return err;
+}
+
+static void dedupHandlerFlushCallback(Logger_Handler_T handler) {
+    assert(handler);
+    dedupHandlerContext context = Logger_Handler_getContext(handler);
+    pthread_mutex_lock(&context->mutex);
+    dedupHandlerPublishRepeated(context);
+    Logger_Handler_flush(context->handler);
+    pthread_mutex_unlock(&context->mutex);
+}
+
+static void dedupHandlerDeleteContext(dedupHandlerContext context) {
+    pthread_cond_destroy(&context->changed);
+    pthread_mutex_destroy(&context->mutex);
+    sdsfree(context->lastContent);
+    sdsfree(context->content);
+    sdsfree(context->lastLoggerName);
+    sdsfree(context->lastFile);
+    sdsfree(context->lastFunction);
+    Logger_Alloc_free(context);
+}
+
+static void dedupHandlerStop(dedupHandlerContext context) {
+    pthread_mutex_lock(&context->mutex);
+    context->stopping = true;
+    pthread_cond_signal(&context->changed);
+    pthread_mutex_unlock(&context->mutex);
+    pthread_join(context->timer, NULL);
+}
+
+static void dedupHandlerCloseCallback(Logger_Handler_T handler) {
+    assert(handler);
+    dedupHandlerContext context = Logger_Handler_getContext(handler);
+    if (context->TIMEOUT > 0) {
+        dedupHandlerStop(context);
+    }
+    dedupHandlerPublishRepeated(context);
+    Logger_Handler_delete(&context->handler);
+    dedupHandlerDeleteContext(context);
+}
+
+Logger_Handler_Result_T Logger_Handler_newDedupHandler(Logger_Handler_T handler, size_t timeoutMilliseconds) {
+    assert(handler);
+    Logger_Handler_T self = NULL;
+    dedupHandlerContext context = NULL;
+    pthread_condattr_t attributes;
+
+    context = Logger_Alloc_malloc(sizeof(*context));
+    if (!context) {
+        return (Logger_Handler_Result_T) {.err=LOGGER_ERR_OUT_OF_MEMORY, .handler=NULL};
+    }
+    context->TIMEOUT = (uint64_t) timeoutMilliseconds * UINT64_C(1000000);
+    context->handler = handler;
+    context->stopping = false;
+    context->hasLast = false;
+    context->lastHash = 0;
+    context->lastContent = sdsempty();
+    context->content = sdsempty();
+    context->lastLevel = LOGGER_LEVEL_DEBUG;
+    context->lastCallSite = NULL;
+    context->lastLoggerName = NULL;
+    context->lastFile = NULL;
+    context->lastFunction = NULL;
+    context->lastLine = 0;
+    context->repeated = 0;
+    context->runStart = 0;
+    pthread_mutex_init(&context->mutex, NULL);
+    pthread_condattr_init(&attributes);
+    pthread_condattr_setclock(&attributes, CLOCK_MONOTONIC);  /* the timer waits for Logger_Clock deadlines */
+    pthread_cond_init(&context->changed, &attributes);
+    pthread_condattr_destroy(&attributes);
+
+    if (context->lastContent && context->content &&
+        (0 == context->TIMEOUT || 0 == pthread_create(&context->timer, NULL, dedupHandlerTimer, context))) {
+        self = Logger_Handler_new(dedupHandlerPublishCallback, dedupHandlerFlushCallback, dedupHandlerCloseCallback);
+        if (self) {
+            Logger_Handler_setContext(self, context);
+            Logger_Handler_setLevel(self, Logger_Handler_getLevel(handler));
+            if (Logger_Handler_getFormatter(handler)) {
+                Logger_Handler_setFormatter(self, Logger_Handler_getFormatter(handler));
+            }
+            return (Logger_Handler_Result_T) {.err=LOGGER_ERR_OK, .handler=self};
+        }
+        if (context->TIMEOUT > 0) {
+            dedupHandlerStop(context);
+        }
+    }
+    dedupHandlerDeleteContext(context);
+    return (Logger_Handler_Result_T) {.err=LOGGER_ERR_OUT_OF_MEMORY, .handler=NULL};
+}
+
+/*
+ * Compressed File Handler
+ *
+ * Publishing threads fill `filling` under mutex; a full block is swapped with `pending` for the worker, which
+ * compresses it into `output` and writes it without holding mutex. pendingSize is 0 while the worker is idle.
+ */
+typedef struct compressedFileHandlerContext {
+    Logger_Compress_Codec_T CODEC;
+    size_t BLOCK_SIZE;
+    Logger_Handler_T handler;
+    FILE *file;
+    pthread_t worker;
+    pthread_mutex_t mutex;
+    pthread_cond_t changed;
+    unsigned char *filling;
+    size_t fillingSize;
+    unsigned char *pending;
+    size_t pendingSize;
+    unsigned char *output;
+    bool stopping;
+    Logger_Err_T err;
+} *compressedFileHandlerContext;
+
+static void *compressedFileHandlerWorker(void *arg) {
+    compressedFileHandlerContext context = arg;
+    pthread_mutex_lock(&context->mutex);
+    for (;;) {
+        while (0 == context->pendingSize && !context->stopping) {
+            pthread_cond_wait(&context->changed, &context->mutex);
+        }
+        if (0 == context->pendingSize) {
+            break;
+        }
+        const size_t pendingSize = context->pendingSize;
+        pthread_mutex_unlock(&context->mutex);
+
+        Logger_Err_T err = LOGGER_ERR_OK;
+        const size_t size = Logger_Compress_encodeBlock(context->CODEC, context->pending, pendingSize, context->output);
+        if (fwrite(context->output, 1, size, context->file) != size || 0 != fflush(context->file)) {
+            err = LOGGER_ERR_IO;
+        } else {
+            Logger_Handler_addBytesWritten(context->handler, size);
+        }
+
+        pthread_mutex_lock(&context->mutex);
+        if (LOGGER_ERR_OK != err) {
+            context->err = err;
+        }
+        context->pendingSize = 0;
+        pthread_cond_broadcast(&context->changed);
+    }
+    pthread_mutex_unlock(&context->mutex);
+    return NULL;
+}
+
+/*
+ * Hand the filling block to the worker, mutex must be held.
+ */
+static void compressedFileHandlerSubmit(compressedFileHandlerContext context) {
+    while (context->pendingSize > 0) {
+        pthread_cond_wait(&context->changed, &context->mutex);
+    }
+    unsigned char *block = context->pending;
+    context->pending = context->filling;
+    context->pendingSize = context->fillingSize;
+    context->filling = block;
+    context->fillingSize = 0;
+    pthread_cond_broadcast(&context->changed);
+}
+
+static Logger_Err_T compressedFileHandlerPublishCallback(Logger_Handler_T handler, Logger_Record_T record) {
+    assert(handler);
+    assert(record);
+    Logger_Formatter_T formatter = Logger_Handler_getFormatter(handler);
+    compressedFileHandlerContext context = Logger_Handler_getContext(handler);
+    char *log = Logger_Formatter_formatRecord(formatter, record);
+    if (!log) {
+        return LOGGER_ERR_OUT_OF_MEMORY;
+    }
+
+    const char *bytes = log;
+    size_t size = Logger_Formatter_sizeFormattedRecord(formatter, log);
+    pthread_mutex_lock(&context->mutex);
+    if (context->fillingSize > 0 && size > context->BLOCK_SIZE - context->fillingSize) {
+        compressedFileHandlerSubmit(context);  /* records span blocks only when larger than one */
+    }
+    while (size > 0) {
+        const size_t room = context->BLOCK_SIZE - context->fillingSize;
+        const size_t chunk = size < room ? size : room;
+        memcpy(context->filling + context->fillingSize, bytes, chunk);
+        context->fillingSize += chunk;
+        bytes += chunk;
+        size -= chunk;
+        if (context->fillingSize == context->BLOCK_SIZE) {
+            compressedFileHandlerSubmit(context);
+        }
+    }
+    const Logger_Err_T err = context->err;
+    context->err = LOGGER_ERR_OK;
+    pthread_mutex_unlock(&context->mutex);
+
+    Logger_Formatter_deleteFormattedRecord(formatter, log);
+    return err;
+}
+
+static void compressedFileHandlerFlushCallback(Logger_Handler_T handler) {
+    assert(handler);
+    compressedFileHandlerContext context = Logger_Handler_getContext(handler);
+    pthread_mutex_lock(&context->mutex);
+    if (context->fillingSize > 0) {
+        compressedFileHandlerSubmit(context);
+    }
+    while (context->pendingSize > 0) {
+        pthread_cond_wait(&context->changed, &context->mutex);
+    }
+    const Logger_Err_T err = context->err;  /* reported here rather than by the next publish */
+    context->err = LOGGER_ERR_OK;
+    pthread_mutex_unlock(&context->mutex);
+    if (LOGGER_ERR_OK != err) {
+        Logger_Handler_addError(handler, err);
+    }
+}
+
+static void compressedFileHandlerDeleteContext(compressedFileHandlerContext context) {
+    pthread_cond_destroy(&context->changed);
+    pthread_mutex_destroy(&context->mutex);
+    fclose(context->file);
+    Logger_Alloc_free(context->filling);
+    Logger_Alloc_free(context->pending);
+    Logger_Alloc_free(context->output);
+    Logger_Alloc_free(context);
+}
+
+static void compressedFileHandlerStop(compressedFileHandlerContext context) {
+    pthread_mutex_lock(&context->mutex);
+    context->stopping = true;
+    pthread_cond_broadcast(&context->changed);
+    pthread_mutex_unlock(&context->mutex);
+    pthread_join(context->worker, NULL);
+}
+
+static void compressedFileHandlerCloseCallback(Logger_Handler_T handler) {
+    assert(handler);
+    compressedFileHandlerContext context = Logger_Handler_getContext(handler);
+    compressedFileHandlerFlushCallback(handler);
+    compressedFileHandlerStop(context);
+    compressedFileHandlerDeleteContext(context);
+}
+
+Logger_Handler_Result_T Logger_Handler_newCompressedFileHandler(
+        Logger_Level_T level, Logger_Formatter_T formatter, const char *filePath, Logger_Compress_Codec_T codec,
+        size_t blockSize
+) {
+    assert(filePath);
+    assert(LOGGER_LEVEL_DEBUG <= level && level <= LOGGER_LEVEL_FATAL);
+    assert(formatter);
+    assert(LOGGER_COMPRESS_CODEC_LZ == codec || LOGGER_COMPRESS_CODEC_ZLIB == codec);
+    assert(0 < blockSize && blockSize <= LOGGER_COMPRESS_BLOCK_MAX);
+    FILE *file = NULL;
+    Logger_Handler_T self = NULL;
+    compressedFileHandlerContext context = NULL;
+
+    if (LOGGER_COMPRESS_CODEC_ZLIB == codec && !Logger_Compress_hasZlib()) {
+        return (Logger_Handler_Result_T) {.err=LOGGER_ERR_INVALID_CONFIG, .handler=NULL};
+    }
+    file = fopen(filePath, "a");
+    if (!file) {
+        return (Logger_Handler_Result_T) {.err=Logger_Err_fromErrno(errno), .handler=NULL};
+    }
+    context = Logger_Alloc_malloc(sizeof(*context));
+    if (!context) {
+        fclose(file);
+        return (Logger_Handler_Result_T) {.err=LOGGER_ERR_OUT_OF_MEMORY, .handler=NULL};
+    }
+    context->CODEC = codec;
+    context->BLOCK_SIZE = blockSize;
+    context->handler = NULL;
+    context->file = file;
+    context->filling = Logger_Alloc_malloc(blockSize);
+    context->fillingSize = 0;
+    context->pending = Logger_Alloc_malloc(blockSize);
+    context->pendingSize = 0;
+    context->output = Logger_Alloc_malloc(LOGGER_COMPRESS_HEADER_SIZE + blockSize);
+    context->stopping = false;
+    context->err = LOGGER_ERR_OK;
+    pthread_mutex_init(&context->mutex, NULL);
+    pthread_cond_init(&context->changed, NULL);
+
+    if (context->filling && context->pending && context->output &&
+        0 == pthread_create(&context->worker, NULL, compressedFileHandlerWorker, context)) {
+        self = Logger_Handler_new(
+                compressedFileHandlerPublishCallback, compressedFileHandlerFlushCallback,
+                compressedFileHandlerCloseCallback
+        );
+        if (self) {
+            context->handler = self;  /* the worker uses it once a record is published */
+            Logger_Handler_setLevel(self, level);
+            Logger_Handler_setContext(self, context);
+            Logger_Handler_setFormatter(self, formatter);
+            Logger_Formatter_reset(formatter);
+            return (Logger_Handler_Result_T) {.err=LOGGER_ERR_OK, .handler=self};
+        }
+        compressedFileHandlerStop(context);
+    }
+    compressedFileHandlerDeleteContext(context);
+    return (Logger_Handler_Result_T) {.err=LOGGER_ERR_OUT_OF_MEMORY, .handler=NULL};
+}
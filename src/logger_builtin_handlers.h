@@ -11,6 +11,8 @@
 
 #include "logger_stream.h"
 #include "logger_handler.h"
+#include "logger_compress.h"
+#include "logger_archiver.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -40,7 +42,8 @@ extern Logger_Handler_Result_T Logger_Handler_newConsoleHandler(
 );
 
 /**
- * Construct a Logger_Handler_T.
+ * Construct a Logger_Handler_T that appends to filePath, the records already in it are kept.
+ * A binary formatter starts a new scope of ids in it (see logger_binary.h), so the file decodes as a whole.
  *
  * Checked runtime errors:
  *  - @param filePath must not be NULL.
@@ -58,7 +61,10 @@ extern Logger_Handler_Result_T Logger_Handler_newFileHandler(
 );
 
 /**
- * Construct a Logger_Handler_T.
+ * Construct a Logger_Handler_T that appends to filePath.0 and moves on to filePath.1, filePath.2 and so on
+ * once bytesBeforeRotation bytes are in the file, counting those already in it.
+ * After a restart the handler goes on appending to the highest filePath.N found, or starts the one after the
+ * highest filePath.N archived (see Logger_Handler_newArchivingRotatingFileHandler), so no archive is overwritten.
  *
  * Checked runtime errors:
  *  - @param filePath must not be NULL.
@@ -77,7 +83,33 @@ extern Logger_Handler_Result_T Logger_Handler_newRotatingFileHandler(
 );
 
 /**
- * Construct a Logger_Handler_T.
+ * Construct a Logger_Handler_T that behaves like Logger_Handler_newRotatingFileHandler and hands every file it
+ * rotates away from to archiver, which compresses it in the background.
+ * The file being written when the handler is deleted is left as is.
+ * archiver is not owned by the handler and must outlive it.
+ *
+ * Checked runtime errors:
+ *  - @param filePath must not be NULL.
+ *  - @param level must be in range LOGGER_LEVEL_DEBUG - LOGGER_LEVEL_FATAL.
+ *  - @param formatter must not be NULL.
+ *  - @param archiver must not be NULL.
+ *  - In case of errors this function will set Logger_Handler_Result_T.err to the error value.
+ *
+ * @param filePath The path to the file in which the handler will write.
+ * @param level The level for this handler.
+ * @param formatter The formatter for this handler.
+ * @param bytesBeforeRotation The number of bytes to be written before rotating.
+ * @param archiver The archiver compressing the rotated files.
+ * @return A Logger_Handler_Result_T wrapper. If no err occurred handler will be the new instance of a Logger_Handler_T.
+ */
+extern Logger_Handler_Result_T Logger_Handler_newArchivingRotatingFileHandler(
+        Logger_Level_T level, Logger_Formatter_T formatter, const char *filePath, size_t bytesBeforeRotation,
+        Logger_Archiver_T archiver
+);
+
+/**
+ * Construct a Logger_Handler_T that appends to filePath, the records already in it are kept.
+ * A binary formatter starts a new scope of ids in it (see logger_binary.h), so the file decodes as a whole.
  *
  * Checked runtime errors:
  *  - @param filePath must not be NULL.
@@ -95,6 +127,56 @@ extern Logger_Handler_Result_T Logger_Handler_newMemoryFileHandler(
         Logger_Level_T level, Logger_Formatter_T formatter, const char *filePath, size_t bytesBeforeWrite
 );
 
+/**
+ * Construct a Logger_Handler_T that collapses runs of repeated records before forwarding them to handler.
+ * Two records are repeated when they have the same level, call site, message, context and fields.
+ * The first record of a run is forwarded as is, the repetitions are counted and forwarded as a single
+ * "last message repeated N times" record when a different record arrives, when the handler is flushed
+ * or closed, or when timeoutMilliseconds passed since the run started, even if no record arrives after it:
+ * a non-zero timeout starts a timer thread of the handler.
+ * The new handler takes ownership of handler, which is deleted along with it, and shares its level and formatter.
+ *
+ * Checked runtime errors:
+ *  - @param handler must not be NULL.
+ *  - In case of errors this function will set Logger_Handler_Result_T.err to the error value.
+ *
+ * @param handler The handler records are forwarded to.
+ * @param timeoutMilliseconds The maximum time a run of repeated records is held back or 0 for no limit.
+ * @return A Logger_Handler_Result_T wrapper. If no err occurred handler will be the new instance of a Logger_Handler_T.
+ */
+extern Logger_Handler_Result_T Logger_Handler_newDedupHandler(Logger_Handler_T handler, size_t timeoutMilliseconds);
+
+/**
+ * Construct a Logger_Handler_T that appends to filePath in compressed blocks (see logger_compress.h).
+ * Records are buffered until the next one would not fit in blockSize bytes, then the block is handed to a worker
+ * thread of the handler that compresses and writes it while the next one fills up; a record larger than
+ * blockSize spans several blocks. Publishing waits only when a block is full and the worker is still busy with
+ * the previous one. Flushing writes the pending blocks; a crash loses the records published since the last flush
+ * that are not written yet: those of the block being filled and those of the full block handed to the worker.
+ * Write errors of the worker are returned by the next publish or, if the handler is flushed or closed first,
+ * counted in its stats (see Logger_Handler_addError).
+ *
+ * Checked runtime errors:
+ *  - @param filePath must not be NULL.
+ *  - @param level must be in range LOGGER_LEVEL_DEBUG - LOGGER_LEVEL_FATAL.
+ *  - @param formatter must not be NULL.
+ *  - @param codec must be LOGGER_COMPRESS_CODEC_LZ or LOGGER_COMPRESS_CODEC_ZLIB.
+ *  - @param blockSize must be in range 1 - LOGGER_COMPRESS_BLOCK_MAX.
+ *  - In case of errors this function will set Logger_Handler_Result_T.err to the error value,
+ *    `LOGGER_ERR_INVALID_CONFIG` if codec is LOGGER_COMPRESS_CODEC_ZLIB and the library is built without zlib.
+ *
+ * @param filePath The path to the file in which the handler will write.
+ * @param level The level for this handler.
+ * @param formatter The formatter for this handler.
+ * @param codec The codec used to compress the blocks.
+ * @param blockSize The number of bytes of records compressed together.
+ * @return A Logger_Handler_Result_T wrapper. If no err occurred handler will be the new instance of a Logger_Handler_T.
+ */
+extern Logger_Handler_Result_T Logger_Handler_newCompressedFileHandler(
+        Logger_Level_T level, Logger_Formatter_T formatter, const char *filePath, Logger_Compress_Codec_T codec,
+        size_t blockSize
+);
+
 #ifdef __cplusplus
 }
 #endif
@@ -10,6 +10,7 @@
 #include "logger_builtin_formatters.h"
 #include "logger_builtin_handlers.h"
 #include "logger_builtin_loggers.h"
+#include "logger_level_spec.h"
 
 #define NEW_LOGGER_FUNCTION_TEMPLATE(__argName__, __argLevel__, __argFunction__, ...)   \
     Logger_Handler_Result_T result;                                                     \
@@ -17,6 +18,7 @@
     Logger_T self = NULL;                                                               \
     Logger_Formatter_T formatter = NULL;                                                \
                                                                                         \
+    __argLevel__ = Logger_LevelSpec_resolve(__argName__, __argLevel__);                 \
     formatter = Logger_Formatter_newSimpleFormatter();                                  \
     if (!formatter) {                                                                   \
         err = LOGGER_ERR_OUT_OF_MEMORY;                                                 \
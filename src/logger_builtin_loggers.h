@@ -30,7 +30,7 @@ typedef struct Logger_Result_T {
  *  - In case of errors this function will set Logger_Result_T.err to the error value.
  *
  * @param name The logger name.
- * @param level The logger and handler level.
+ * @param level The logger and handler level, unless LOGGER_LEVELS gives one to name (see logger_level_spec.h).
  * @return A Logger_Result_T wrapper. If no err occurred logger will be the new instance of a Logger_T.
  */
 extern Logger_Result_T Logger_newStdoutLogger(const char *name, Logger_Level_T level);
@@ -45,7 +45,7 @@ extern Logger_Result_T Logger_newStdoutLogger(const char *name, Logger_Level_T l
  *  - In case of errors this function will set Logger_Result_T.err to the error value.
  *
  * @param name The logger name.
- * @param level The logger and handler level.
+ * @param level The logger and handler level, unless LOGGER_LEVELS gives one to name (see logger_level_spec.h).
  * @return A Logger_Result_T wrapper. If no err occurred logger will be the new instance of a Logger_T.
  */
 extern Logger_Result_T Logger_newStderrLogger(const char *name, Logger_Level_T level);
@@ -60,7 +60,7 @@ extern Logger_Result_T Logger_newStderrLogger(const char *name, Logger_Level_T l
  *  - In case of errors this function will set Logger_Result_T.err to the error value.
  *
  * @param name The logger name.
- * @param level The logger and handler level.
+ * @param level The logger and handler level, unless LOGGER_LEVELS gives one to name (see logger_level_spec.h).
  * @param filePath The path to the file in which the handler will write.
  * @return A Logger_Result_T wrapper. If no err occurred logger will be the new instance of a Logger_T.
  */
@@ -76,7 +76,7 @@ extern Logger_Result_T Logger_newFileLogger(const char *name, Logger_Level_T lev
  *  - In case of errors this function will set Logger_Result_T.err to the error value.
  *
  * @param name The logger name.
- * @param level The logger and handler level.
+ * @param level The logger and handler level, unless LOGGER_LEVELS gives one to name (see logger_level_spec.h).
  * @param filePath The path to the file in which the handler will write.
  * @param bytesBeforeRotation The number of bytes to be written before rotating.
  * @return A Logger_Result_T wrapper. If no err occurred logger will be the new instance of a Logger_T.
@@ -94,7 +94,7 @@ Logger_newRotatingFileLogger(const char *name, Logger_Level_T level, const char
  *  - In case of errors this function will set Logger_Result_T.err to the error value.
  *
  * @param name The logger name.
- * @param level The logger and handler level.
+ * @param level The logger and handler level, unless LOGGER_LEVELS gives one to name (see logger_level_spec.h).
  * @param filePath The path to the file in which the handler will write.
  * @param bytesBeforeWrite The number of bytes before performing a write.
  * @return A Logger_Result_T wrapper. If no err occurred logger will be the new instance of a Logger_T.
@@ -0,0 +1,272 @@
+/*
+ * C Source File
+ *
+ * Author: daddinuz
+ * email:  daddinuz@gmail.com
+ * Date:   October 19, 2026
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <stdbool.h>
+#include <fnmatch.h>
+#include <pthread.h>
+#include "logger_alloc.h"
+#include "logger_clock.h"
+#include "logger_callsite.h"
+
+#define NANOSECONDS_PER_SECOND  UINT64_C(1000000000)
+
+typedef enum Logger_CallSite_RuleKind_T {
+    RULE_KIND_STATE, RULE_KIND_RATE_LIMIT, RULE_KIND_SAMPLING
+} Logger_CallSite_RuleKind_T;
+
+/*
+ * Rules are kept in order of definition and replayed on call sites registered after them.
+ * A new rule with the same match and kind of an existing one replaces it, so toggling the same
+ * call sites over and over does not grow the list.
+ */
+typedef struct Logger_CallSite_Rule_T {
+    char *fileGlob;
+    char *function;
+    size_t firstLine;
+    size_t lastLine;
+    Logger_CallSite_RuleKind_T kind;
+    Logger_CallSite_State_T state;
+    uint64_t first;
+    uint64_t second;
+    struct Logger_CallSite_Rule_T *next;
+} *Logger_CallSite_Rule_T;
+
+static pthread_mutex_t gMutex = PTHREAD_MUTEX_INITIALIZER;
+static Logger_CallSite_T *gCallSites = NULL;
+static Logger_CallSite_Rule_T gRules = NULL;
+
+static bool sameOptionalString(const char *a, const char *b) {
+    return a == b || (a && b && 0 == strcmp(a, b));
+}
+
+static char *copyOptionalString(const char *str, bool *failed) {
+    assert(failed);
+    char *copy = NULL;
+    if (str) {
+        copy = Logger_Alloc_malloc(strlen(str) + 1);
+        if (copy) {
+            strcpy(copy, str);
+        } else {
+            *failed = true;
+        }
+    }
+    return copy;
+}
+
+static bool ruleMatches(Logger_CallSite_Rule_T rule, const Logger_CallSite_T *callSite) {
+    assert(rule);
+    assert(callSite);
+    return (!rule->fileGlob || 0 == fnmatch(rule->fileGlob, callSite->file, 0)) &&
+           (!rule->function || 0 == strcmp(rule->function, callSite->function)) &&
+           rule->firstLine <= callSite->line && (0 == rule->lastLine || callSite->line <= rule->lastLine);
+}
+
+/*
+ * Must be called holding gMutex.
+ */
+static void ruleApply(Logger_CallSite_Rule_T rule, Logger_CallSite_T *callSite) {
+    assert(rule);
+    assert(callSite);
+    Logger_CallSite_Limits_T *limits = &callSite->limits;
+    switch (rule->kind) {
+        case RULE_KIND_STATE:
+            __atomic_store_n(&callSite->state, (unsigned char) rule->state, __ATOMIC_RELAXED);
+            break;
+        case RULE_KIND_RATE_LIMIT:
+            __atomic_store_n(&limits->emissionInterval, rule->first, __ATOMIC_RELAXED);
+            __atomic_store_n(&limits->burstTolerance, rule->second, __ATOMIC_RELAXED);
+            __atomic_store_n(&limits->theoreticalArrival, 0, __ATOMIC_RELAXED);
+            break;
+        case RULE_KIND_SAMPLING:
+            __atomic_store_n(&limits->sampleEvery, rule->first, __ATOMIC_RELAXED);
+            __atomic_store_n(&limits->sampleCounter, 0, __ATOMIC_RELAXED);
+            break;
+        default:
+            assert(false);
+            break;
+    }
+}
+
+/*
+ * Must be called holding gMutex.
+ */
+static void rulesRecord(const struct Logger_CallSite_Rule_T *template) {
+    assert(template);
+    Logger_CallSite_Rule_T *link = &gRules;
+    for (; *link; link = &(*link)->next) {
+        Logger_CallSite_Rule_T rule = *link;
+        if (rule->kind == template->kind &&
+            rule->firstLine == template->firstLine && rule->lastLine == template->lastLine &&
+            sameOptionalString(rule->fileGlob, template->fileGlob) &&
+            sameOptionalString(rule->function, template->function)) {
+            *link = rule->next; /* move it to the end with the new values */
+            rule->next = NULL;
+            rule->state = template->state;
+            rule->first = template->first;
+            rule->second = template->second;
+            for (; *link; link = &(*link)->next) {}
+            *link = rule;
+            return;
+        }
+    }
+
+    bool failed = false;
+    Logger_CallSite_Rule_T rule = Logger_Alloc_malloc(sizeof(*rule));
+    if (!rule) {
+        return; /* registered call sites are updated anyway, only future ones miss the rule */
+    }
+    *rule = *template;
+    rule->fileGlob = copyOptionalString(template->fileGlob, &failed);
+    rule->function = copyOptionalString(template->function, &failed);
+    if (failed) {
+        Logger_Alloc_free(rule->fileGlob);
+        Logger_Alloc_free(rule->function);
+        Logger_Alloc_free(rule);
+        return;
+    }
+    rule->next = NULL;
+    *link = rule;
+}
+
+static size_t applyRule(struct Logger_CallSite_Rule_T *rule) {
+    assert(rule);
+    size_t matched = 0;
+    pthread_mutex_lock(&gMutex);
+    rulesRecord(rule);
+    for (Logger_CallSite_T *callSite = gCallSites; callSite; callSite = callSite->next) {
+        if (ruleMatches(rule, callSite)) {
+            ruleApply(rule, callSite);
+            matched++;
+        }
+    }
+    pthread_mutex_unlock(&gMutex);
+    return matched;
+}
+
+static size_t setState(
+        const char *fileGlob, const char *function, size_t firstLine, size_t lastLine, Logger_CallSite_State_T state
+) {
+    struct Logger_CallSite_Rule_T rule = {
+            .fileGlob=(char *) fileGlob, .function=(char *) function, .firstLine=firstLine, .lastLine=lastLine,
+            .kind=RULE_KIND_STATE, .state=state, .first=0, .second=0, .next=NULL
+    };
+    return applyRule(&rule);
+}
+
+static Logger_CallSite_State_T registerCallSite(Logger_CallSite_T *self) {
+    assert(self);
+    pthread_mutex_lock(&gMutex);
+    const unsigned char current = __atomic_load_n(&self->state, __ATOMIC_RELAXED);
+    Logger_CallSite_State_T state = (Logger_CallSite_State_T) current;
+    if (LOGGER_CALLSITE_UNREGISTERED == state) {
+        state = LOGGER_CALLSITE_DEFAULT;
+        for (Logger_CallSite_Rule_T rule = gRules; rule; rule = rule->next) {
+            if (ruleMatches(rule, self)) {
+                if (RULE_KIND_STATE == rule->kind) {
+                    state = rule->state;
+                } else {
+                    ruleApply(rule, self);
+                }
+            }
+        }
+        self->next = gCallSites;
+        gCallSites = self;
+        __atomic_store_n(&self->state, (unsigned char) state, __ATOMIC_RELAXED);
+    }
+    pthread_mutex_unlock(&gMutex);
+    return state;
+}
+
+Logger_CallSite_State_T Logger_CallSite_getState(Logger_CallSite_T *self) {
+    assert(self);
+    const unsigned char state = __atomic_load_n(&self->state, __ATOMIC_RELAXED);
+    return LOGGER_CALLSITE_UNREGISTERED != state ? (Logger_CallSite_State_T) state : registerCallSite(self);
+}
+
+bool Logger_CallSite_isEnabled(const Logger_CallSite_T *self) {
+    assert(self);
+    return LOGGER_CALLSITE_ENABLED == __atomic_load_n(&self->state, __ATOMIC_RELAXED);
+}
+
+size_t Logger_CallSite_enable(const char *fileGlob, const char *function, size_t firstLine, size_t lastLine) {
+    return setState(fileGlob, function, firstLine, lastLine, LOGGER_CALLSITE_ENABLED);
+}
+
+size_t Logger_CallSite_disable(const char *fileGlob, const char *function, size_t firstLine, size_t lastLine) {
+    return setState(fileGlob, function, firstLine, lastLine, LOGGER_CALLSITE_DISABLED);
+}
+
+size_t Logger_CallSite_reset(const char *fileGlob, const char *function, size_t firstLine, size_t lastLine) {
+    return setState(fileGlob, function, firstLine, lastLine, LOGGER_CALLSITE_DEFAULT);
+}
+
+bool Logger_CallSite_admit(Logger_CallSite_T *self) {
+    assert(self);
+    Logger_CallSite_Limits_T *limits = &self->limits;
+
+    const uint64_t sampleEvery = __atomic_load_n(&limits->sampleEvery, __ATOMIC_RELAXED);
+    if (sampleEvery > 1 && 0 != __atomic_fetch_add(&limits->sampleCounter, 1, __ATOMIC_RELAXED) % sampleEvery) {
+        __atomic_fetch_add(&limits->suppressed, 1, __ATOMIC_RELAXED);
+        return false;
+    }
+
+    const uint64_t emissionInterval = __atomic_load_n(&limits->emissionInterval, __ATOMIC_RELAXED);
+    if (emissionInterval > 0) {
+        const uint64_t burstTolerance = __atomic_load_n(&limits->burstTolerance, __ATOMIC_RELAXED);
+        const uint64_t now = Logger_Clock_getMonotonicTime();
+        uint64_t arrival = __atomic_load_n(&limits->theoreticalArrival, __ATOMIC_RELAXED);
+        uint64_t next;
+        do {
+            const uint64_t start = arrival > now ? arrival : now;
+            if (start - now > burstTolerance) {
+                __atomic_fetch_add(&limits->suppressed, 1, __ATOMIC_RELAXED);
+                return false;
+            }
+            next = start + emissionInterval;
+        } while (!__atomic_compare_exchange_n(
+                &limits->theoreticalArrival, &arrival, next, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED
+        ));
+    }
+    return true;
+}
+
+size_t Logger_CallSite_takeSuppressed(Logger_CallSite_T *self) {
+    assert(self);
+    if (0 == __atomic_load_n(&self->limits.suppressed, __ATOMIC_RELAXED)) {
+        return 0; /* avoid dirtying the cache line on the common path */
+    }
+    return (size_t) __atomic_exchange_n(&self->limits.suppressed, 0, __ATOMIC_RELAXED);
+}
+
+size_t Logger_CallSite_setRateLimit(
+        const char *fileGlob, const char *function, size_t firstLine, size_t lastLine,
+        size_t recordsPerSecond, size_t burst
+) {
+    const uint64_t emissionInterval = recordsPerSecond > 0 ? NANOSECONDS_PER_SECOND / recordsPerSecond : 0;
+    struct Logger_CallSite_Rule_T rule = {
+            .fileGlob=(char *) fileGlob, .function=(char *) function, .firstLine=firstLine, .lastLine=lastLine,
+            .kind=RULE_KIND_RATE_LIMIT, .state=LOGGER_CALLSITE_DEFAULT,
+            .first=recordsPerSecond > NANOSECONDS_PER_SECOND ? 1 : emissionInterval,
+            .second=burst > 1 ? emissionInterval * (burst - 1) : 0, .next=NULL
+    };
+    return applyRule(&rule);
+}
+
+size_t Logger_CallSite_setSampling(
+        const char *fileGlob, const char *function, size_t firstLine, size_t lastLine, size_t oneEvery
+) {
+    struct Logger_CallSite_Rule_T rule = {
+            .fileGlob=(char *) fileGlob, .function=(char *) function, .firstLine=firstLine, .lastLine=lastLine,
+            .kind=RULE_KIND_SAMPLING, .state=LOGGER_CALLSITE_DEFAULT, .first=oneEvery > 1 ? oneEvery : 0,
+            .second=0, .next=NULL
+    };
+    return applyRule(&rule);
+}
@@ -0,0 +1,188 @@
+/*
+ * C Header File
+ *
+ * Author: daddinuz
+ * email:  daddinuz@gmail.com
+ * Date:   October 19, 2026
+ */
+
+#ifndef LOGGER_LOGGER_CALLSITE_INCLUDED
+#define LOGGER_LOGGER_CALLSITE_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "logger_level.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Logger_CallSite_State_T controls whether the records issued by a call site are logged.
+ *  - LOGGER_CALLSITE_UNREGISTERED: the call site has not been executed yet.
+ *  - LOGGER_CALLSITE_DEFAULT: the records are filtered by logger and handlers levels.
+ *  - LOGGER_CALLSITE_ENABLED: the records are logged regardless of logger and handlers levels.
+ *  - LOGGER_CALLSITE_DISABLED: the records are discarded before formatting the message.
+ */
+typedef enum Logger_CallSite_State_T {
+    LOGGER_CALLSITE_UNREGISTERED = 0,
+    LOGGER_CALLSITE_DEFAULT,
+    LOGGER_CALLSITE_ENABLED,
+    LOGGER_CALLSITE_DISABLED,
+} Logger_CallSite_State_T;
+
+/**
+ * Logger_CallSite_Limits_T holds the sampling and rate limiting state of a call site.
+ * Rate limiting follows the generic cell rate algorithm: a single theoretical arrival time,
+ * updated by CAS, stands for a token bucket refilled every emissionInterval nanoseconds.
+ */
+typedef struct Logger_CallSite_Limits_T {
+    uint64_t sampleEvery;
+    uint64_t sampleCounter;
+    uint64_t emissionInterval;
+    uint64_t burstTolerance;
+    uint64_t theoreticalArrival;
+    uint64_t suppressed;
+} Logger_CallSite_Limits_T;
+
+#define LOGGER_CALLSITE_LIMITS_INITIALIZER  {0, 0, 0, 0, 0, 0}
+
+/**
+ * Logger_CallSite_T describes a logging request in the source code.
+ * The logging macros declare one static instance per call site and pass only its address,
+ * so the address is also a stable identity of the call site for the whole process lifetime.
+ *
+ * The state is read by the logging macros before calling into the library and is updated atomically,
+ * as are the limits, they must be accessed only through the Logger_CallSite_* functions.
+ * Call sites register themselves the first time they are executed, next links the registered call sites together.
+ */
+typedef struct Logger_CallSite_T {
+    const char *file;
+    const char *function;
+    const char *format;
+    size_t line;
+    Logger_Level_T level;
+    unsigned char state;
+    struct Logger_CallSite_T *next;
+    Logger_CallSite_Limits_T limits;
+} Logger_CallSite_T;
+
+/**
+ * Get the state of a call site, registering it on first use.
+ *
+ * Checked runtime errors:
+ *  - @param self must not be NULL.
+ *
+ * @param self The Logger_CallSite_T instance.
+ * @return The state of the call site.
+ */
+extern Logger_CallSite_State_T Logger_CallSite_getState(Logger_CallSite_T *self);
+
+/**
+ * Check if a call site has been forced to be logged regardless of logger and handlers levels.
+ *
+ * Checked runtime errors:
+ *  - @param self must not be NULL.
+ *
+ * @param self The Logger_CallSite_T instance.
+ * @return true if the state of the call site is LOGGER_CALLSITE_ENABLED.
+ */
+extern bool Logger_CallSite_isEnabled(const Logger_CallSite_T *self);
+
+/**
+ * Decide whether a record of this call site passes sampling and rate limiting.
+ * Rejected records are counted as suppressed. This must be called before formatting the message.
+ *
+ * Checked runtime errors:
+ *  - @param self must not be NULL.
+ *
+ * @param self The Logger_CallSite_T instance.
+ * @return true if the record must be logged.
+ */
+extern bool Logger_CallSite_admit(Logger_CallSite_T *self);
+
+/**
+ * Get and clear the number of records suppressed since the last call.
+ *
+ * Checked runtime errors:
+ *  - @param self must not be NULL.
+ *
+ * @param self The Logger_CallSite_T instance.
+ * @return The number of records suppressed by sampling and rate limiting.
+ */
+extern size_t Logger_CallSite_takeSuppressed(Logger_CallSite_T *self);
+
+/**
+ * Force the matching call sites to be logged regardless of logger and handlers levels.
+ * The rule is remembered and applied also to call sites that will be executed for the first time later on.
+ *
+ * @param fileGlob A fnmatch(3) pattern for the file of the call sites or NULL to match any file.
+ * @param function The function name of the call sites or NULL to match any function.
+ * @param firstLine The first line of the range of the call sites.
+ * @param lastLine The last line of the range of the call sites or 0 for no upper bound.
+ * @return The number of call sites already registered that were matched.
+ */
+extern size_t Logger_CallSite_enable(const char *fileGlob, const char *function, size_t firstLine, size_t lastLine);
+
+/**
+ * Discard the records of the matching call sites before their message is formatted.
+ * The rule is remembered and applied also to call sites that will be executed for the first time later on.
+ *
+ * @param fileGlob A fnmatch(3) pattern for the file of the call sites or NULL to match any file.
+ * @param function The function name of the call sites or NULL to match any function.
+ * @param firstLine The first line of the range of the call sites.
+ * @param lastLine The last line of the range of the call sites or 0 for no upper bound.
+ * @return The number of call sites already registered that were matched.
+ */
+extern size_t Logger_CallSite_disable(const char *fileGlob, const char *function, size_t firstLine, size_t lastLine);
+
+/**
+ * Restore level based filtering for the matching call sites.
+ * The rule is remembered and applied also to call sites that will be executed for the first time later on.
+ *
+ * @param fileGlob A fnmatch(3) pattern for the file of the call sites or NULL to match any file.
+ * @param function The function name of the call sites or NULL to match any function.
+ * @param firstLine The first line of the range of the call sites.
+ * @param lastLine The last line of the range of the call sites or 0 for no upper bound.
+ * @return The number of call sites already registered that were matched.
+ */
+extern size_t Logger_CallSite_reset(const char *fileGlob, const char *function, size_t firstLine, size_t lastLine);
+
+/**
+ * Limit the matching call sites to recordsPerSecond records per second, allowing bursts of burst records.
+ * The rule is remembered and applied also to call sites that will be executed for the first time later on.
+ *
+ * @param fileGlob A fnmatch(3) pattern for the file of the call sites or NULL to match any file.
+ * @param function The function name of the call sites or NULL to match any function.
+ * @param firstLine The first line of the range of the call sites.
+ * @param lastLine The last line of the range of the call sites or 0 for no upper bound.
+ * @param recordsPerSecond The sustained rate or 0 to remove the limit.
+ * @param burst The number of records that may be logged back to back, at least 1.
+ * @return The number of call sites already registered that were matched.
+ */
+extern size_t Logger_CallSite_setRateLimit(
+        const char *fileGlob, const char *function, size_t firstLine, size_t lastLine,
+        size_t recordsPerSecond, size_t burst
+);
+
+/**
+ * Log only one record every oneEvery records of the matching call sites.
+ * The rule is remembered and applied also to call sites that will be executed for the first time later on.
+ *
+ * @param fileGlob A fnmatch(3) pattern for the file of the call sites or NULL to match any file.
+ * @param function The function name of the call sites or NULL to match any function.
+ * @param firstLine The first line of the range of the call sites.
+ * @param lastLine The last line of the range of the call sites or 0 for no upper bound.
+ * @param oneEvery The sampling period, 0 or 1 to log every record.
+ * @return The number of call sites already registered that were matched.
+ */
+extern size_t Logger_CallSite_setSampling(
+        const char *fileGlob, const char *function, size_t firstLine, size_t lastLine, size_t oneEvery
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LOGGER_LOGGER_CALLSITE_INCLUDED */
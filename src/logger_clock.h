@@ -0,0 +1,29 @@
+/*
+ * C Header File
+ *
+ * Author: daddinuz
+ * email:  daddinuz@gmail.com
+ * Date:   October 19, 2026
+ */
+
+#ifndef LOGGER_LOGGER_CLOCK_INCLUDED
+#define LOGGER_LOGGER_CLOCK_INCLUDED
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Get the current time of a monotonic clock, suitable to measure intervals.
+ *
+ * @return The time elapsed from an unspecified starting point in nanoseconds.
+ */
+extern uint64_t Logger_Clock_getMonotonicTime(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LOGGER_LOGGER_CLOCK_INCLUDED */
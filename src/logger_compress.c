@@ -0,0 +1,273 @@
+/*
+ * C Source File
+ *
+ * Author: daddinuz
+ * email:  daddinuz@gmail.com
+ * Date:   October 19, 2026
+ */
+
+#include <assert.h>
+#include <string.h>
+#include "logger_compress.h"
+#ifdef LOGGER_ZLIB
+#include <zlib.h>
+#endif
+
+/*
+ * The LZ4 block format: a sequence ends with at least LZ_LAST_LITERALS literals and the last match starts
+ * at least LZ_MATCH_LIMIT bytes before the end of the data.
+ */
+#define LZ_MIN_MATCH 4
+#define LZ_LAST_LITERALS 5
+#define LZ_MATCH_LIMIT 12
+#define LZ_MAX_OFFSET 65535
+#define LZ_HASH_BITS 12
+#define LZ_RUN_MASK 15
+
+static uint32_t read32(const unsigned char *p) {
+    uint32_t value;
+    memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+static uint32_t lzHash(uint32_t sequence) {
+    return (sequence * UINT32_C(2654435761)) >> (32 - LZ_HASH_BITS);
+}
+
+static unsigned char *lzWriteLength(unsigned char *out, size_t length) {
+    for (; length >= 255; length -= 255) {
+        *out++ = 255;
+    }
+    *out++ = (unsigned char) length;
+    return out;
+}
+
+/*
+ * Write a sequence, matchLength is 0 for the last one which has no match.
+ * It returns NULL if the sequence does not fit before end.
+ */
+static unsigned char *lzWriteSequence(
+        unsigned char *out, const unsigned char *end,
+        const unsigned char *literals, size_t literalsLength, size_t matchLength, size_t offset
+) {
+    const size_t needed = 1 + literalsLength / 255 + 1 + literalsLength + 2 + matchLength / 255 + 1;
+    if (needed > (size_t) (end - out)) {
+        return NULL;
+    }
+    unsigned char *token = out++;
+    *token = (unsigned char) ((literalsLength < LZ_RUN_MASK ? literalsLength : LZ_RUN_MASK) << 4);
+    if (literalsLength >= LZ_RUN_MASK) {
+        out = lzWriteLength(out, literalsLength - LZ_RUN_MASK);
+    }
+    memcpy(out, literals, literalsLength);
+    out += literalsLength;
+    if (matchLength > 0) {
+        const size_t code = matchLength - LZ_MIN_MATCH;
+        *out++ = (unsigned char) (offset & 0xff);
+        *out++ = (unsigned char) (offset >> 8);
+        *token |= (unsigned char) (code < LZ_RUN_MASK ? code : LZ_RUN_MASK);
+        if (code >= LZ_RUN_MASK) {
+            out = lzWriteLength(out, code - LZ_RUN_MASK);
+        }
+    }
+    return out;
+}
+
+bool Logger_Compress_hasZlib(void) {
+#ifdef LOGGER_ZLIB
+    return true;
+#else
+    return false;
+#endif
+}
+
+size_t Logger_Compress_lz(const void *src, size_t size, void *dst, size_t capacity) {
+    assert(src);
+    assert(size <= LOGGER_COMPRESS_BLOCK_MAX);
+    assert(dst);
+    uint32_t table[1 << LZ_HASH_BITS] = {0};  /* positions, a stale or zero entry fails the comparison */
+    const unsigned char *const begin = src;
+    const unsigned char *const end = begin + size;
+    const unsigned char *anchor = begin;
+    unsigned char *out = dst;
+    unsigned char *const outEnd = out + capacity;
+
+    if (size > LZ_MATCH_LIMIT) {
+        const unsigned char *const matchLimit = end - LZ_MATCH_LIMIT;
+        const unsigned char *const matchEnd = end - LZ_LAST_LITERALS;
+        const unsigned char *p = begin;
+        while (p < matchLimit) {
+            const uint32_t sequence = read32(p);
+            const uint32_t hash = lzHash(sequence);
+            const unsigned char *candidate = begin + table[hash];
+            table[hash] = (uint32_t) (p - begin);
+            if (candidate >= p || p - candidate > LZ_MAX_OFFSET || read32(candidate) != sequence) {
+                p += 1 + ((size_t) (p - anchor) >> 6);  /* skip faster through data that does not compress */
+                continue;
+            }
+            while (p > anchor && candidate > begin && p[-1] == candidate[-1]) {
+                p--;
+                candidate--;
+            }
+            size_t matchLength = LZ_MIN_MATCH;
+            while (p + matchLength < matchEnd && p[matchLength] == candidate[matchLength]) {
+                matchLength++;
+            }
+            out = lzWriteSequence(
+                    out, outEnd, anchor, (size_t) (p - anchor), matchLength, (size_t) (p - candidate)
+            );
+            if (!out) {
+                return 0;
+            }
+            p += matchLength;
+            anchor = p;
+        }
+    }
+    out = lzWriteSequence(out, outEnd, anchor, (size_t) (end - anchor), 0, 0);
+    return out ? (size_t) (out - (unsigned char *) dst) : 0;
+}
+
+/*
+ * Read the extension bytes of a length, false if src ends before them.
+ */
+static bool lzReadLength(const unsigned char **in, const unsigned char *end, size_t *length) {
+    unsigned char byte;
+    do {
+        if (*in >= end) {
+            return false;
+        }
+        byte = *(*in)++;
+        *length += byte;
+    } while (255 == byte);
+    return true;
+}
+
+bool Logger_Compress_unlz(const void *src, size_t size, void *dst, size_t rawSize) {
+    assert(src);
+    assert(dst);
+    const unsigned char *in = src;
+    const unsigned char *const inEnd = in + size;
+    unsigned char *const begin = dst;
+    unsigned char *out = begin;
+    unsigned char *const outEnd = out + rawSize;
+
+    while (in < inEnd) {
+        const unsigned char token = *in++;
+        size_t literalsLength = token >> 4;
+        if (LZ_RUN_MASK == literalsLength && !lzReadLength(&in, inEnd, &literalsLength)) {
+            return false;
+        }
+        if (literalsLength > (size_t) (inEnd - in) || literalsLength > (size_t) (outEnd - out)) {
+            return false;
+        }
+        memcpy(out, in, literalsLength);
+        in += literalsLength;
+        out += literalsLength;
+        if (in == inEnd) {
+            break;  /* the last sequence */
+        }
+
+        if (inEnd - in < 2) {
+            return false;
+        }
+        const size_t offset = (size_t) in[0] | (size_t) in[1] << 8;
+        in += 2;
+        size_t matchLength = token & LZ_RUN_MASK;
+        if (LZ_RUN_MASK == matchLength && !lzReadLength(&in, inEnd, &matchLength)) {
+            return false;
+        }
+        matchLength += LZ_MIN_MATCH;
+        if (0 == offset || offset > (size_t) (out - begin) || matchLength > (size_t) (outEnd - out)) {
+            return false;
+        }
+        for (const unsigned char *match = out - offset; matchLength > 0; matchLength--) {
+            *out++ = *match++;  /* byte by byte, the match may overlap what it writes */
+        }
+    }
+    return out == outEnd;
+}
+
+static void writeLe32(unsigned char *out, size_t value) {
+    for (size_t i = 0; i < 4; i++) {
+        out[i] = (unsigned char) (value >> (8 * i));
+    }
+}
+
+static size_t readLe32(const unsigned char *in) {
+    size_t value = 0;
+    for (size_t i = 0; i < 4; i++) {
+        value |= (size_t) in[i] << (8 * i);
+    }
+    return value;
+}
+
+size_t Logger_Compress_encodeBlock(Logger_Compress_Codec_T codec, const void *src, size_t size, void *out) {
+    assert(LOGGER_COMPRESS_CODEC_LZ == codec || (LOGGER_COMPRESS_CODEC_ZLIB == codec && Logger_Compress_hasZlib()));
+    assert(src);
+    assert(size <= LOGGER_COMPRESS_BLOCK_MAX);
+    assert(out);
+    unsigned char *header = out;
+    unsigned char *payload = header + LOGGER_COMPRESS_HEADER_SIZE;
+    size_t payloadSize = 0;
+
+    /* the payload must be smaller than the data, else it is stored */
+    if (size > 1 && LOGGER_COMPRESS_CODEC_LZ == codec) {
+        payloadSize = Logger_Compress_lz(src, size, payload, size - 1);
+    }
+#ifdef LOGGER_ZLIB
+    if (size > 1 && LOGGER_COMPRESS_CODEC_ZLIB == codec) {
+        uLongf destinationSize = (uLongf) (size - 1);
+        if (Z_OK == compress2(payload, &destinationSize, src, (uLong) size, Z_BEST_SPEED)) {
+            payloadSize = (size_t) destinationSize;
+        }
+    }
+#endif
+    if (0 == payloadSize) {
+        codec = LOGGER_COMPRESS_CODEC_STORED;
+        payloadSize = size;
+        memcpy(payload, src, size);
+    }
+
+    memcpy(header, LOGGER_COMPRESS_MAGIC, 4);
+    header[4] = (unsigned char) codec;
+    header[5] = header[6] = header[7] = 0;
+    writeLe32(header + 8, size);
+    writeLe32(header + 12, payloadSize);
+    return LOGGER_COMPRESS_HEADER_SIZE + payloadSize;
+}
+
+bool Logger_Compress_readHeader(const void *in, Logger_Compress_Header_T *header) {
+    assert(in);
+    assert(header);
+    const unsigned char *bytes = in;
+    if (0 != memcmp(bytes, LOGGER_COMPRESS_MAGIC, 4) || bytes[4] > LOGGER_COMPRESS_CODEC_ZLIB) {
+        return false;
+    }
+    header->codec = (Logger_Compress_Codec_T) bytes[4];
+    header->rawSize = readLe32(bytes + 8);
+    header->size = readLe32(bytes + 12);
+    return header->rawSize <= LOGGER_COMPRESS_BLOCK_MAX &&
+           (LOGGER_COMPRESS_CODEC_STORED != header->codec || header->size == header->rawSize);
+}
+
+bool Logger_Compress_decodeBlock(const Logger_Compress_Header_T *header, const void *payload, void *out) {
+    assert(header);
+    assert(payload);
+    assert(out);
+    switch (header->codec) {
+        case LOGGER_COMPRESS_CODEC_STORED:
+            memcpy(out, payload, header->rawSize);
+            return true;
+        case LOGGER_COMPRESS_CODEC_LZ:
+            return Logger_Compress_unlz(payload, header->size, out, header->rawSize);
+        case LOGGER_COMPRESS_CODEC_ZLIB: {
+#ifdef LOGGER_ZLIB
+            uLongf rawSize = (uLongf) header->rawSize;
+            return Z_OK == uncompress(out, &rawSize, payload, (uLong) header->size) && rawSize == header->rawSize;
+#else
+            return false;
+#endif
+        }
+    }
+    return false;
+}
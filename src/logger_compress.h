@@ -0,0 +1,146 @@
+/*
+ * C Header File
+ *
+ * Author: daddinuz
+ * email:  daddinuz@gmail.com
+ * Date:   October 19, 2026
+ */
+
+#ifndef LOGGER_LOGGER_COMPRESS_INCLUDED
+#define LOGGER_LOGGER_COMPRESS_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Logger_Compress_Codec_T identifies how the payload of a block is encoded.
+ *
+ * A compressed log is a sequence of independent blocks, each one made of a LOGGER_COMPRESS_HEADER_SIZE bytes
+ * header followed by the payload:
+ *  - the 4 bytes of LOGGER_COMPRESS_MAGIC;
+ *  - one byte, the codec;
+ *  - 3 bytes reserved, zero;
+ *  - the size of the decoded data, 4 little endian bytes;
+ *  - the size of the payload, 4 little endian bytes.
+ *
+ * Blocks do not refer to each other: readers can skip blocks by their size or look for the next magic, and a
+ * writer interrupted mid block loses that block only.
+ *  - LOGGER_COMPRESS_CODEC_STORED: the payload is the data, used when no codec makes it smaller.
+ *  - LOGGER_COMPRESS_CODEC_LZ: the built-in codec, the LZ4 block format (sequences of a token, literals,
+ *    a 2 bytes little endian offset and the match length extension), fast on both ends.
+ *  - LOGGER_COMPRESS_CODEC_ZLIB: a zlib stream, smaller but slower; only when the library is built with zlib,
+ *    see Logger_Compress_hasZlib.
+ */
+typedef enum Logger_Compress_Codec_T {
+    LOGGER_COMPRESS_CODEC_STORED,
+    LOGGER_COMPRESS_CODEC_LZ,
+    LOGGER_COMPRESS_CODEC_ZLIB,
+} Logger_Compress_Codec_T;
+
+#define LOGGER_COMPRESS_MAGIC "LGZB"
+#define LOGGER_COMPRESS_HEADER_SIZE 16
+
+/**
+ * The maximum size of the data of a block.
+ */
+#define LOGGER_COMPRESS_BLOCK_MAX (UINT32_C(1) << 30)
+
+typedef struct Logger_Compress_Header_T {
+    Logger_Compress_Codec_T codec;
+    size_t rawSize;
+    size_t size;
+} Logger_Compress_Header_T;
+
+/**
+ * Tell whether the library was built with zlib.
+ *
+ * @return true if LOGGER_COMPRESS_CODEC_ZLIB can be used, false otherwise.
+ */
+extern bool Logger_Compress_hasZlib(void);
+
+/**
+ * Compress data with the built-in codec.
+ *
+ * Checked runtime errors:
+ *  - @param src must not be NULL.
+ *  - @param size must not be greater than LOGGER_COMPRESS_BLOCK_MAX.
+ *  - @param dst must not be NULL.
+ *
+ * @param src The data to be compressed.
+ * @param size The size of the data.
+ * @param dst The output buffer.
+ * @param capacity The size of the output buffer.
+ * @return The size of the compressed data or 0 if it does not fit in capacity.
+ */
+extern size_t Logger_Compress_lz(const void *src, size_t size, void *dst, size_t capacity);
+
+/**
+ * Decompress data compressed with the built-in codec.
+ *
+ * Checked runtime errors:
+ *  - @param src must not be NULL.
+ *  - @param dst must not be NULL.
+ *
+ * @param src The compressed data.
+ * @param size The size of the compressed data.
+ * @param dst The output buffer.
+ * @param rawSize The size of the decompressed data.
+ * @return true on success, false if src is malformed or does not decompress to rawSize bytes.
+ */
+extern bool Logger_Compress_unlz(const void *src, size_t size, void *dst, size_t rawSize);
+
+/**
+ * Encode data into a block, with codec or stored if codec does not make it smaller.
+ *
+ * Checked runtime errors:
+ *  - @param codec must be LOGGER_COMPRESS_CODEC_LZ or LOGGER_COMPRESS_CODEC_ZLIB, if available.
+ *  - @param src must not be NULL.
+ *  - @param size must not be greater than LOGGER_COMPRESS_BLOCK_MAX.
+ *  - @param out must not be NULL and must have room for LOGGER_COMPRESS_HEADER_SIZE + size bytes.
+ *
+ * @param codec The codec to be used.
+ * @param src The data to be encoded.
+ * @param size The size of the data.
+ * @param out The output buffer.
+ * @return The size of the block, header included.
+ */
+extern size_t Logger_Compress_encodeBlock(Logger_Compress_Codec_T codec, const void *src, size_t size, void *out);
+
+/**
+ * Parse the header of a block.
+ *
+ * Checked runtime errors:
+ *  - @param in must not be NULL and must have room for LOGGER_COMPRESS_HEADER_SIZE bytes.
+ *  - @param header must not be NULL.
+ *
+ * @param in The header bytes.
+ * @param header Where to store the header.
+ * @return true on success, false if in is not a valid header.
+ */
+extern bool Logger_Compress_readHeader(const void *in, Logger_Compress_Header_T *header);
+
+/**
+ * Decode the payload of a block.
+ *
+ * Checked runtime errors:
+ *  - @param header must not be NULL.
+ *  - @param payload must not be NULL and must have room for header->size bytes.
+ *  - @param out must not be NULL and must have room for header->rawSize bytes.
+ *
+ * @param header The header of the block.
+ * @param payload The payload of the block.
+ * @param out The output buffer.
+ * @return true on success, false if the payload is malformed or its codec is not available.
+ */
+extern bool Logger_Compress_decodeBlock(const Logger_Compress_Header_T *header, const void *payload, void *out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LOGGER_LOGGER_COMPRESS_INCLUDED */
@@ -0,0 +1,746 @@
+/*
+ * C Source File
+ *
+ * Author: daddinuz
+ * email:  daddinuz@gmail.com
+ * Date:   October 19, 2026
+ */
+
+#include <stdio.h>
+#include <errno.h>
+#include <stdint.h>
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <unistd.h>
+#include <pthread.h>
+#include "sds/sds.h"
+#include "logger_alloc.h"
+#include "logger_builtin_formatters.h"
+#include "logger_builtin_handlers.h"
+#include "logger_config.h"
+#ifdef __linux__
+#include <poll.h>
+#include <sys/inotify.h>
+#endif
+
+/*
+ * Specs
+ *
+ * A spec is the parsed content of the file. Its handlers are created when the spec is built
+ * and deleted along with it, unless a later spec takes them over.
+ */
+typedef struct configHandler {
+    sds name;
+    sds type;
+    sds stream;
+    sds path;  /* the rotating file handler keeps a pointer to it */
+    sds formatterName;
+    size_t rotate;
+    size_t flush;
+    size_t block;
+    Logger_Compress_Codec_T codec;  /* LOGGER_COMPRESS_CODEC_STORED if missing */
+    size_t dedup;
+    bool hasDedup;
+    Logger_Level_T level;
+    size_t line;
+    sds signature;
+    Logger_Handler_T handler;
+    Logger_Formatter_T formatter;
+} configHandler;
+
+typedef struct configLogger {
+    sds name;
+    sds handlerNames;
+    bool hasLevel;
+    Logger_Level_T level;
+    bool propagate;
+    size_t line;
+    Logger_T logger;
+    size_t *indexes;
+    Logger_Handler_T *handlers;
+    size_t handlersCount;
+} configLogger;
+
+typedef struct configSpec {
+    configHandler *handlers;
+    size_t handlersCount;
+    configLogger *loggers;
+    size_t loggersCount;
+} configSpec;
+
+static void clearSpec(configSpec *spec) {
+    assert(spec);
+    for (size_t i = 0; i < spec->handlersCount; i++) {
+        configHandler *handler = &spec->handlers[i];
+        if (handler->handler) {
+            Logger_Handler_delete(&handler->handler);  /* a dedup handler deletes the one it wraps */
+        }
+        if (handler->formatter) {
+            Logger_Formatter_delete(&handler->formatter);
+        }
+        sdsfree(handler->name);
+        sdsfree(handler->type);
+        sdsfree(handler->stream);
+        sdsfree(handler->path);
+        sdsfree(handler->formatterName);
+        sdsfree(handler->signature);
+    }
+    for (size_t i = 0; i < spec->loggersCount; i++) {
+        sdsfree(spec->loggers[i].name);
+        sdsfree(spec->loggers[i].handlerNames);
+        Logger_Alloc_free(spec->loggers[i].indexes);
+        Logger_Alloc_free(spec->loggers[i].handlers);
+    }
+    Logger_Alloc_free(spec->handlers);
+    Logger_Alloc_free(spec->loggers);
+    *spec = (configSpec) {.handlers=NULL, .handlersCount=0, .loggers=NULL, .loggersCount=0};
+}
+
+static configHandler *findHandler(const configSpec *spec, const char *name) {
+    for (size_t i = 0; i < spec->handlersCount; i++) {
+        if (0 == strcmp(name, spec->handlers[i].name)) {
+            return &spec->handlers[i];
+        }
+    }
+    return NULL;
+}
+
+static configLogger *findLogger(const configSpec *spec, const char *name) {
+    for (size_t i = 0; i < spec->loggersCount; i++) {
+        if (0 == strcmp(name, spec->loggers[i].name)) {
+            return &spec->loggers[i];
+        }
+    }
+    return NULL;
+}
+
+static configHandler *appendHandler(configSpec *spec, const char *name, size_t line) {
+    configHandler *handlers = Logger_Alloc_realloc(spec->handlers, (spec->handlersCount + 1) * sizeof(*handlers));
+    if (!handlers) {
+        return NULL;
+    }
+    spec->handlers = handlers;
+    configHandler *self = &handlers[spec->handlersCount];
+    memset(self, 0, sizeof(*self));
+    self->level = LOGGER_LEVEL_DEBUG;
+    self->line = line;
+    self->name = sdsnew(name);
+    if (!self->name) {
+        return NULL;
+    }
+    spec->handlersCount++;
+    return self;
+}
+
+static configLogger *appendLogger(configSpec *spec, const char *name, size_t line) {
+    configLogger *loggers = Logger_Alloc_realloc(spec->loggers, (spec->loggersCount + 1) * sizeof(*loggers));
+    if (!loggers) {
+        return NULL;
+    }
+    spec->loggers = loggers;
+    configLogger *self = &loggers[spec->loggersCount];
+    memset(self, 0, sizeof(*self));
+    self->propagate = true;
+    self->line = line;
+    self->name = sdsnew(name);
+    if (!self->name) {
+        return NULL;
+    }
+    spec->loggersCount++;
+    return self;
+}
+
+/*
+ * Parser
+ */
+static bool parseSize(const char *value, size_t *out) {
+    char *end = NULL;
+    if ('\0' == *value || '-' == *value) {
+        return false;
+    }
+    errno = 0;
+    const unsigned long long parsed = strtoull(value, &end, 10);
+    if (0 != errno || '\0' != *end || parsed > SIZE_MAX) {
+        return false;
+    }
+    *out = (size_t) parsed;
+    return true;
+}
+
+static bool parseBool(const char *value, bool *out) {
+    if (0 == strcasecmp(value, "true")) {
+        *out = true;
+        return true;
+    }
+    if (0 == strcasecmp(value, "false")) {
+        *out = false;
+        return true;
+    }
+    return false;
+}
+
+/*
+ * Replace *field with a copy of value, return false on OOM.
+ */
+static bool setString(sds *field, const char *value) {
+    sds copy = sdsnew(value);
+    if (!copy) {
+        return false;
+    }
+    sdsfree(*field);
+    *field = copy;
+    return true;
+}
+
+static Logger_Err_T parseHandlerKey(configHandler *handler, const char *key, const char *value) {
+    if (0 == strcmp(key, "type")) {
+        return setString(&handler->type, value) ? LOGGER_ERR_OK : LOGGER_ERR_OUT_OF_MEMORY;
+    }
+    if (0 == strcmp(key, "stream")) {
+        return setString(&handler->stream, value) ? LOGGER_ERR_OK : LOGGER_ERR_OUT_OF_MEMORY;
+    }
+    if (0 == strcmp(key, "path")) {
+        return setString(&handler->path, value) ? LOGGER_ERR_OK : LOGGER_ERR_OUT_OF_MEMORY;
+    }
+    if (0 == strcmp(key, "formatter")) {
+        return setString(&handler->formatterName, value) ? LOGGER_ERR_OK : LOGGER_ERR_OUT_OF_MEMORY;
+    }
+    if (0 == strcmp(key, "level")) {
+        return Logger_Level_fromName(value, &handler->level) ? LOGGER_ERR_OK : LOGGER_ERR_INVALID_CONFIG;
+    }
+    if (0 == strcmp(key, "rotate")) {
+        return parseSize(value, &handler->rotate) && handler->rotate > 0 ? LOGGER_ERR_OK : LOGGER_ERR_INVALID_CONFIG;
+    }
+    if (0 == strcmp(key, "flush")) {
+        return parseSize(value, &handler->flush) ? LOGGER_ERR_OK : LOGGER_ERR_INVALID_CONFIG;
+    }
+    if (0 == strcmp(key, "block")) {
+        return parseSize(value, &handler->block) && 0 < handler->block && handler->block <= LOGGER_COMPRESS_BLOCK_MAX ?
+               LOGGER_ERR_OK : LOGGER_ERR_INVALID_CONFIG;
+    }
+    if (0 == strcmp(key, "codec")) {
+        if (0 == strcmp(value, "lz")) {
+            handler->codec = LOGGER_COMPRESS_CODEC_LZ;
+        } else if (0 == strcmp(value, "zlib")) {
+            handler->codec = LOGGER_COMPRESS_CODEC_ZLIB;
+        } else {
+            return LOGGER_ERR_INVALID_CONFIG;
+        }
+        return LOGGER_ERR_OK;
+    }
+    if (0 == strcmp(key, "dedup")) {
+        handler->hasDedup = true;
+        return parseSize(value, &handler->dedup) ? LOGGER_ERR_OK : LOGGER_ERR_INVALID_CONFIG;
+    }
+    return LOGGER_ERR_INVALID_CONFIG;
+}
+
+static Logger_Err_T parseLoggerKey(configLogger *logger, const char *key, const char *value) {
+    if (0 == strcmp(key, "level")) {
+        logger->hasLevel = true;
+        return Logger_Level_fromName(value, &logger->level) ? LOGGER_ERR_OK : LOGGER_ERR_INVALID_CONFIG;
+    }
+    if (0 == strcmp(key, "handlers")) {
+        return setString(&logger->handlerNames, value) ? LOGGER_ERR_OK : LOGGER_ERR_OUT_OF_MEMORY;
+    }
+    if (0 == strcmp(key, "propagate")) {
+        return parseBool(value, &logger->propagate) ? LOGGER_ERR_OK : LOGGER_ERR_INVALID_CONFIG;
+    }
+    return LOGGER_ERR_INVALID_CONFIG;
+}
+
+/*
+ * Check the handler once its section is over and compute its signature:
+ * the definition that, apart from the level, must not change for the handler to be kept across loads.
+ */
+static Logger_Err_T validateHandler(configHandler *handler) {
+    const char *type = handler->type ? handler->type : "";
+    const char *formatter = handler->formatterName ? handler->formatterName : "simple";
+    const bool isConsole = 0 == strcmp(type, "console");
+    const bool isCompressed = 0 == strcmp(type, "compressed");
+    if (!isConsole && !isCompressed && 0 != strcmp(type, "file") && 0 != strcmp(type, "rotating") &&
+        0 != strcmp(type, "memory")) {
+        return LOGGER_ERR_INVALID_CONFIG;
+    }
+    if (isConsole ? handler->path != NULL : handler->path == NULL) {
+        return LOGGER_ERR_INVALID_CONFIG;
+    }
+    if (handler->stream &&
+        (!isConsole || (0 != strcmp(handler->stream, "stdout") && 0 != strcmp(handler->stream, "stderr")))) {
+        return LOGGER_ERR_INVALID_CONFIG;
+    }
+    if ((handler->rotate > 0) != (0 == strcmp(type, "rotating"))) {
+        return LOGGER_ERR_INVALID_CONFIG;
+    }
+    if (handler->flush > 0 && 0 != strcmp(type, "memory")) {
+        return LOGGER_ERR_INVALID_CONFIG;
+    }
+    if ((handler->block > 0 || LOGGER_COMPRESS_CODEC_STORED != handler->codec) && !isCompressed) {
+        return LOGGER_ERR_INVALID_CONFIG;
+    }
+    if (0 != strcmp(formatter, "simple") && 0 != strcmp(formatter, "json") &&
+        0 != strcmp(formatter, "logfmt") && 0 != strcmp(formatter, "binary")) {
+        return LOGGER_ERR_INVALID_CONFIG;
+    }
+    handler->signature = sdscatprintf(
+            sdsempty(), "%s\n%s\n%s\n%s\n%zu\n%zu\n%zu\n%d\n%d\n%zu", type,
+            handler->stream ? handler->stream : "stdout", handler->path ? handler->path : "", formatter,
+            handler->rotate, handler->flush, handler->block, (int) handler->codec, handler->hasDedup, handler->dedup
+    );
+    return handler->signature ? LOGGER_ERR_OK : LOGGER_ERR_OUT_OF_MEMORY;
+}
+
+/*
+ * Parse content into spec, on errors *line is the offending line.
+ */
+static Logger_Err_T parseSpec(const char *content, size_t length, configSpec *spec, size_t *line) {
+    Logger_Err_T err = LOGGER_ERR_OK;
+    configHandler *handler = NULL;
+    configLogger *logger = NULL;
+    int count = 0;
+    sds *lines = sdssplitlen(content, (int) length, "\n", 1, &count);
+    if (!lines) {
+        return LOGGER_ERR_OUT_OF_MEMORY;
+    }
+
+    for (int i = 0; LOGGER_ERR_OK == err && i < count; i++) {
+        sds text = sdstrim(lines[i], " \t\r");
+        *line = (size_t) i + 1;
+        if ('\0' == text[0] || '#' == text[0] || ';' == text[0]) {
+            continue;
+        }
+        if ('[' == text[0]) {
+            if (handler) {
+                err = validateHandler(handler);
+                if (LOGGER_ERR_OK != err) {
+                    *line = handler->line;
+                    break;
+                }
+            }
+            handler = NULL;
+            logger = NULL;
+            if (']' != text[sdslen(text) - 1]) {
+                err = LOGGER_ERR_INVALID_CONFIG;
+                break;
+            }
+            sdsrange(text, 1, -2);
+            text = sdstrim(text, " \t");
+            if (0 == strcmp(text, "logger")) {
+                sdsclear(text);
+            } else if (0 == strncmp(text, "logger ", 7) || 0 == strncmp(text, "logger\t", 7)) {
+                sdsrange(text, 7, -1);
+                text = sdstrim(text, " \t");
+            } else if (0 == strncmp(text, "handler ", 8) || 0 == strncmp(text, "handler\t", 8)) {
+                sdsrange(text, 8, -1);
+                text = sdstrim(text, " \t");
+                if ('\0' == text[0] || findHandler(spec, text)) {
+                    err = LOGGER_ERR_INVALID_CONFIG;
+                } else {
+                    handler = appendHandler(spec, text, *line);
+                    err = handler ? LOGGER_ERR_OK : LOGGER_ERR_OUT_OF_MEMORY;
+                }
+                continue;
+            } else {
+                err = LOGGER_ERR_INVALID_CONFIG;
+                continue;
+            }
+            if (findLogger(spec, text)) {
+                err = LOGGER_ERR_INVALID_CONFIG;
+            } else {
+                logger = appendLogger(spec, text, *line);
+                err = logger ? LOGGER_ERR_OK : LOGGER_ERR_OUT_OF_MEMORY;
+            }
+            continue;
+        }
+
+        char *separator = strchr(text, '=');
+        if (!separator || (!handler && !logger)) {
+            err = LOGGER_ERR_INVALID_CONFIG;
+            break;
+        }
+        sds key = sdstrim(sdsnewlen(text, (size_t) (separator - text)), " \t");
+        sds value = sdstrim(sdsnew(separator + 1), " \t");
+        if (!key || !value) {
+            err = LOGGER_ERR_OUT_OF_MEMORY;
+        } else {
+            err = handler ? parseHandlerKey(handler, key, value) : parseLoggerKey(logger, key, value);
+        }
+        sdsfree(key);
+        sdsfree(value);
+    }
+    if (LOGGER_ERR_OK == err && handler) {
+        err = validateHandler(handler);
+        *line = handler->line;
+    }
+    sdsfreesplitres(lines, count);
+    return err;
+}
+
+/*
+ * Building and applying
+ */
+static Logger_Err_T createHandler(configHandler *self) {
+    const char *formatterName = self->formatterName ? self->formatterName : "simple";
+    Logger_Handler_Result_T result = {.err=LOGGER_ERR_OK, .handler=NULL};
+
+    if (0 == strcmp(formatterName, "json")) {
+        self->formatter = Logger_Formatter_newJsonFormatter();
+    } else if (0 == strcmp(formatterName, "logfmt")) {
+        self->formatter = Logger_Formatter_newLogfmtFormatter();
+    } else if (0 == strcmp(formatterName, "binary")) {
+        self->formatter = Logger_Formatter_newBinaryFormatter();
+    } else {
+        self->formatter = Logger_Formatter_newSimpleFormatter();
+    }
+    if (!self->formatter) {
+        return LOGGER_ERR_OUT_OF_MEMORY;
+    }
+
+    if (0 == strcmp(self->type, "console")) {
+        const bool isStderr = self->stream && 0 == strcmp(self->stream, "stderr");
+        result = Logger_Handler_newConsoleHandler(
+                self->level, self->formatter, isStderr ? LOGGER_OSTREAM_STDERR : LOGGER_OSTREAM_STDOUT
+        );
+    } else if (0 == strcmp(self->type, "file")) {
+        result = Logger_Handler_newFileHandler(self->level, self->formatter, self->path);
+    } else if (0 == strcmp(self->type, "rotating")) {
+        result = Logger_Handler_newRotatingFileHandler(self->level, self->formatter, self->path, self->rotate);
+    } else if (0 == strcmp(self->type, "compressed")) {
+        result = Logger_Handler_newCompressedFileHandler(
+                self->level, self->formatter, self->path,
+                LOGGER_COMPRESS_CODEC_STORED == self->codec ? LOGGER_COMPRESS_CODEC_LZ : self->codec,
+                self->block > 0 ? self->block : 65536
+        );
+    } else {
+        result = Logger_Handler_newMemoryFileHandler(self->level, self->formatter, self->path, self->flush);
+    }
+    if (LOGGER_ERR_OK == result.err && self->hasDedup) {
+        Logger_Handler_Result_T dedup = Logger_Handler_newDedupHandler(result.handler, self->dedup);
+        if (LOGGER_ERR_OK != dedup.err) {
+            Logger_Handler_delete(&result.handler);
+        }
+        result = dedup;
+    }
+    if (LOGGER_ERR_OK != result.err) {
+        Logger_Formatter_delete(&self->formatter);
+        return result.err;
+    }
+    self->handler = result.handler;
+    return LOGGER_ERR_OK;
+}
+
+/*
+ * Resolve the loggers of spec and create its handlers, taking over from previous the ones that did not change.
+ * On errors nothing is taken from previous.
+ */
+static Logger_Err_T buildSpec(configSpec *spec, configSpec *previous, size_t *line) {
+    for (size_t i = 0; i < spec->loggersCount; i++) {
+        configLogger *logger = &spec->loggers[i];
+        int count = 0;
+        *line = logger->line;
+        logger->logger = Logger_get(logger->name);
+        if (!logger->logger) {
+            return LOGGER_ERR_OUT_OF_MEMORY;
+        }
+        if (!logger->handlerNames) {
+            continue;
+        }
+        sds *names = sdssplitlen(logger->handlerNames, (int) sdslen(logger->handlerNames), ",", 1, &count);
+        logger->indexes = count > 0 ? Logger_Alloc_malloc((size_t) count * sizeof(logger->indexes[0])) : NULL;
+        logger->handlers = count > 0 ? Logger_Alloc_malloc((size_t) count * sizeof(logger->handlers[0])) : NULL;
+        if (!names || (count > 0 && (!logger->indexes || !logger->handlers))) {
+            sdsfreesplitres(names, count);
+            return LOGGER_ERR_OUT_OF_MEMORY;
+        }
+        for (int j = 0; j < count; j++) {
+            configHandler *handler = findHandler(spec, sdstrim(names[j], " \t"));
+            if (!handler) {
+                sdsfreesplitres(names, count);
+                return LOGGER_ERR_INVALID_CONFIG;
+            }
+            logger->indexes[logger->handlersCount++] = (size_t) (handler - spec->handlers);
+        }
+        sdsfreesplitres(names, count);
+    }
+
+    for (size_t i = 0; i < spec->handlersCount; i++) {
+        configHandler *handler = &spec->handlers[i];
+        const configHandler *old = findHandler(previous, handler->name);
+        *line = handler->line;
+        if (!old || !old->handler || 0 != strcmp(old->signature, handler->signature)) {
+            const Logger_Err_T err = createHandler(handler);
+            if (LOGGER_ERR_OK != err) {
+                return err;
+            }
+        }
+    }
+    *line = 0;
+
+    for (size_t i = 0; i < spec->handlersCount; i++) {
+        configHandler *handler = &spec->handlers[i];
+        configHandler *old = findHandler(previous, handler->name);
+        if (!handler->handler) {
+            sds path = handler->path;
+            handler->handler = old->handler;
+            handler->formatter = old->formatter;
+            handler->path = old->path;
+            old->handler = NULL;
+            old->formatter = NULL;
+            old->path = path;
+            Logger_Handler_setLevel(handler->handler, handler->level);
+        }
+    }
+    for (size_t i = 0; i < spec->loggersCount; i++) {
+        configLogger *logger = &spec->loggers[i];
+        for (size_t j = 0; j < logger->handlersCount; j++) {
+            logger->handlers[j] = spec->handlers[logger->indexes[j]].handler;
+        }
+    }
+    return LOGGER_ERR_OK;
+}
+
+/*
+ * Reconfigure the loggers of spec and strip those of previous it does not mention.
+ * Once this returns the handlers left in previous are no longer in use.
+ */
+static Logger_Err_T applySpec(const configSpec *spec, const configSpec *previous) {
+    Logger_Err_T err = LOGGER_ERR_OK;
+    for (size_t i = 0; i < spec->loggersCount; i++) {
+        const configLogger *logger = &spec->loggers[i];
+        const configLogger *old = previous ? findLogger(previous, logger->name) : NULL;
+        const Logger_Level_T level = logger->hasLevel ? logger->level : Logger_getLevel(logger->logger);
+        const Logger_Err_T loggerErr = Logger_replaceHandlers(
+                logger->logger, level, old ? old->handlers : NULL, old ? old->handlersCount : 0,
+                logger->handlers, logger->handlersCount
+        );
+        if (!logger->hasLevel) {
+            Logger_resetLevel(logger->logger);
+        }
+        Logger_setPropagate(logger->logger, logger->propagate);
+        err = LOGGER_ERR_OK == err ? loggerErr : err;
+    }
+    for (size_t i = 0; previous && i < previous->loggersCount; i++) {
+        const configLogger *logger = &previous->loggers[i];
+        if (!findLogger(spec, logger->name)) {
+            const Logger_Err_T loggerErr = Logger_replaceHandlers(
+                    logger->logger, Logger_getLevel(logger->logger), logger->handlers, logger->handlersCount, NULL, 0
+            );
+            Logger_resetLevel(logger->logger);
+            Logger_setPropagate(logger->logger, true);
+            err = LOGGER_ERR_OK == err ? loggerErr : err;
+        }
+    }
+    return err;
+}
+
+static Logger_Err_T readFile(const char *filePath, sds *content) {
+    char chunk[4096];
+    size_t read;
+    FILE *file = fopen(filePath, "r");
+    if (!file) {
+        return Logger_Err_fromErrno(errno);
+    }
+    *content = sdsempty();
+    while (*content && (read = fread(chunk, 1, sizeof(chunk), file)) > 0) {
+        *content = sdscatlen(*content, chunk, read);
+    }
+    const Logger_Err_T err = !*content ? LOGGER_ERR_OUT_OF_MEMORY : ferror(file) ? LOGGER_ERR_IO : LOGGER_ERR_OK;
+    fclose(file);
+    return err;
+}
+
+/*
+ * Logger_Config_T
+ */
+struct Logger_Config_T {
+    sds filePath;
+    pthread_mutex_t mutex;
+    configSpec spec;
+    size_t loads;
+    size_t errorLine;
+    bool watching;
+#ifdef __linux__
+    pthread_t watcher;
+    int inotifyFd;
+    int stopPipe[2];
+#endif
+};
+
+Logger_Config_Result_T Logger_Config_load(const char *filePath) {
+    assert(filePath);
+    Logger_Config_T self = Logger_Alloc_malloc(sizeof(*self));
+    if (!self) {
+        return (Logger_Config_Result_T) {.err=LOGGER_ERR_OUT_OF_MEMORY, .config=NULL, .line=0};
+    }
+    self->filePath = sdsnew(filePath);
+    if (!self->filePath || 0 != pthread_mutex_init(&self->mutex, NULL)) {
+        sdsfree(self->filePath);
+        Logger_Alloc_free(self);
+        return (Logger_Config_Result_T) {.err=LOGGER_ERR_OUT_OF_MEMORY, .config=NULL, .line=0};
+    }
+    self->spec = (configSpec) {.handlers=NULL, .handlersCount=0, .loggers=NULL, .loggersCount=0};
+    self->loads = 0;
+    self->errorLine = 0;
+    self->watching = false;
+
+    const Logger_Err_T err = Logger_Config_reload(self);
+    if (LOGGER_ERR_OK != err) {
+        const size_t line = self->errorLine;
+        Logger_Config_delete(&self);
+        return (Logger_Config_Result_T) {.err=err, .config=NULL, .line=line};
+    }
+    return (Logger_Config_Result_T) {.err=LOGGER_ERR_OK, .config=self, .line=0};
+}
+
+void Logger_Config_delete(Logger_Config_T *ref) {
+    assert(ref);
+    assert(*ref);
+    Logger_Config_T self = *ref;
+#ifdef __linux__
+    if (self->watching) {
+        const ssize_t written = write(self->stopPipe[1], "", 1);
+        (void) written;
+        pthread_join(self->watcher, NULL);
+        close(self->inotifyFd);
+        close(self->stopPipe[0]);
+        close(self->stopPipe[1]);
+    }
+#endif
+    for (size_t i = 0; i < self->spec.loggersCount; i++) {
+        const configLogger *logger = &self->spec.loggers[i];
+        if (logger->logger) {
+            Logger_replaceHandlers(
+                    logger->logger, Logger_getLevel(logger->logger), logger->handlers, logger->handlersCount, NULL, 0
+            );
+        }
+    }
+    clearSpec(&self->spec);
+    pthread_mutex_destroy(&self->mutex);
+    sdsfree(self->filePath);
+    Logger_Alloc_free(self);
+    *ref = NULL;
+}
+
+Logger_Err_T Logger_Config_reload(Logger_Config_T self) {
+    assert(self);
+    configSpec spec = {.handlers=NULL, .handlersCount=0, .loggers=NULL, .loggersCount=0};
+    size_t line = 0;
+    sds content = NULL;
+
+    pthread_mutex_lock(&self->mutex);
+    Logger_Err_T err = readFile(self->filePath, &content);
+    if (LOGGER_ERR_OK == err) {
+        err = parseSpec(content, sdslen(content), &spec, &line);
+    }
+    if (LOGGER_ERR_OK == err) {
+        err = buildSpec(&spec, &self->spec, &line);
+    }
+    if (LOGGER_ERR_OK == err) {
+        configSpec previous = self->spec;
+        err = applySpec(&spec, &previous);
+        self->spec = spec;
+        clearSpec(&previous);
+        self->loads++;
+    } else {
+        clearSpec(&spec);
+    }
+    self->errorLine = LOGGER_ERR_INVALID_CONFIG == err ? line : 0;
+    pthread_mutex_unlock(&self->mutex);
+    sdsfree(content);
+    return err;
+}
+
+#ifdef __linux__
+static void *watcherMain(void *arg) {
+    Logger_Config_T self = arg;
+    const char *slash = strrchr(self->filePath, '/');
+    const char *fileName = slash ? slash + 1 : self->filePath;
+    union {
+        struct inotify_event event;
+        char bytes[4096];
+    } buffer;
+    struct pollfd fds[2] = {
+            {.fd=self->inotifyFd, .events=POLLIN, .revents=0},
+            {.fd=self->stopPipe[0], .events=POLLIN, .revents=0}
+    };
+
+    while (true) {
+        if (poll(fds, 2, -1) < 0) {
+            if (EINTR == errno) {
+                continue;
+            }
+            break;
+        }
+        if (fds[1].revents) {
+            break;
+        }
+        const ssize_t size = read(self->inotifyFd, buffer.bytes, sizeof(buffer.bytes));
+        bool changed = false;
+        for (ssize_t offset = 0; size > 0 && offset < size;) {
+            struct inotify_event event;
+            memcpy(&event, buffer.bytes + offset, sizeof(event));
+            const char *name = buffer.bytes + offset + sizeof(event);
+            changed = changed || (event.len > 0 && 0 == strcmp(name, fileName));
+            offset += (ssize_t) (sizeof(event) + event.len);
+        }
+        if (changed) {
+            Logger_Config_reload(self);  /* a broken file leaves the current configuration in place */
+        }
+    }
+    return NULL;
+}
+#endif
+
+Logger_Err_T Logger_Config_watch(Logger_Config_T self) {
+    assert(self);
+#ifdef __linux__
+    Logger_Err_T err = LOGGER_ERR_OK;
+    pthread_mutex_lock(&self->mutex);
+    if (!self->watching) {
+        /* editors often replace the file, so its directory is watched */
+        const char *slash = strrchr(self->filePath, '/');
+        sds directory = slash ? sdsnewlen(self->filePath, (size_t) (slash - self->filePath) + 1) : sdsnew(".");
+        self->inotifyFd = directory ? inotify_init1(IN_CLOEXEC) : -1;
+        if (!directory) {
+            err = LOGGER_ERR_OUT_OF_MEMORY;
+        } else if (self->inotifyFd < 0 ||
+                   inotify_add_watch(self->inotifyFd, directory, IN_CLOSE_WRITE | IN_MOVED_TO) < 0) {
+            err = Logger_Err_fromErrno(errno);
+        } else if (0 != pipe(self->stopPipe)) {
+            err = Logger_Err_fromErrno(errno);
+        } else if (0 != pthread_create(&self->watcher, NULL, watcherMain, self)) {
+            err = LOGGER_ERR_UNKNOWN;
+            close(self->stopPipe[0]);
+            close(self->stopPipe[1]);
+        } else {
+            self->watching = true;
+        }
+        if (LOGGER_ERR_OK != err && self->inotifyFd >= 0) {
+            close(self->inotifyFd);
+        }
+        sdsfree(directory);
+    }
+    pthread_mutex_unlock(&self->mutex);
+    return err;
+#else
+    return LOGGER_ERR_UNKNOWN;
+#endif
+}
+
+size_t Logger_Config_getLoads(Logger_Config_T self) {
+    assert(self);
+    pthread_mutex_lock(&self->mutex);
+    const size_t loads = self->loads;
+    pthread_mutex_unlock(&self->mutex);
+    return loads;
+}
+
+size_t Logger_Config_getErrorLine(Logger_Config_T self) {
+    assert(self);
+    pthread_mutex_lock(&self->mutex);
+    const size_t errorLine = self->errorLine;
+    pthread_mutex_unlock(&self->mutex);
+    return errorLine;
+}
@@ -0,0 +1,149 @@
+/*
+ * C Header File
+ *
+ * Author: daddinuz
+ * email:  daddinuz@gmail.com
+ * Date:   October 19, 2026
+ */
+
+#ifndef LOGGER_LOGGER_CONFIG_INCLUDED
+#define LOGGER_LOGGER_CONFIG_INCLUDED
+
+#include <stddef.h>
+#include "logger.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Logger_Config_T sets up registered loggers (see Logger_get) and their handlers from an INI file:
+ *
+ *  # handlers are declared once and may be shared by many loggers
+ *  [handler console]
+ *  type = console              # console, file, rotating, memory or compressed
+ *  stream = stderr             # console: stdout (the default) or stderr
+ *  formatter = logfmt          # simple (the default), json, logfmt or binary
+ *  level = DEBUG               # the default
+ *
+ *  [handler audit]
+ *  type = rotating
+ *  path = /var/log/audit.log   # file, rotating, memory and compressed
+ *  rotate = 1048576            # rotating: bytes written before rotating
+ *  dedup = 1000                # optional: collapse repeated records, see Logger_Handler_newDedupHandler
+ *
+ *  [handler trace]
+ *  type = memory
+ *  path = /tmp/trace.log
+ *  flush = 65536               # memory: bytes buffered before writing
+ *
+ *  [handler archive]
+ *  type = compressed
+ *  path = /var/log/app.log.lgz
+ *  codec = zlib                # compressed: lz (the default) or zlib, see logger_compress.h
+ *  block = 262144              # compressed: bytes compressed together, 65536 by default
+ *
+ *  [logger]                    # the root logger
+ *  level = INFO
+ *  handlers = console
+ *
+ *  [logger db.pool]
+ *  level = DEBUG               # inherited from the parent if missing
+ *  handlers = audit, trace     # comma separated
+ *  propagate = false           # true (the default) or false
+ *
+ * Lines starting with '#' or ';' are comments. Each logger section is applied with Logger_replaceHandlers,
+ * so threads logging meanwhile are never blocked and handlers added to the logger by the application are kept.
+ * When the file is loaded again, handlers whose definition did not change except for their level are kept
+ * (their file is not reopened), the others are replaced, and the loggers no longer in the file lose the handlers
+ * the configuration gave them. File handlers append to their file, so a replaced handler and the one replacing
+ * it may write to the same file while the loggers switch over; so do restarts, which neither overwrite archived
+ * rotated files nor break the decoding of binary files.
+ */
+#ifdef __cplusplus
+typedef struct Logger_Config_C *Logger_Config_T;
+#else
+typedef struct Logger_Config_T *Logger_Config_T;
+#endif
+
+typedef struct Logger_Config_Result_T {
+    Logger_Err_T err;
+    Logger_Config_T config;
+    size_t line;
+} Logger_Config_Result_T;
+
+/**
+ * Construct a Logger_Config_T by loading and applying a configuration file.
+ *
+ * Checked runtime errors:
+ *  - @param filePath must not be NULL.
+ *  - In case of errors this function will set Logger_Config_Result_T.err to the error value,
+ *    for `LOGGER_ERR_INVALID_CONFIG` Logger_Config_Result_T.line is the offending line.
+ *
+ * @param filePath The path to the configuration file, it is copied.
+ * @return A Logger_Config_Result_T wrapper. If no err occurred config will be the new instance of a Logger_Config_T.
+ */
+extern Logger_Config_Result_T Logger_Config_load(const char *filePath);
+
+/**
+ * Destruct a Logger_Config_T, stopping its watcher.
+ * The handlers it created are removed from the loggers and deleted along with their formatters.
+ *
+ * Checked runtime errors:
+ *  - @param ref must be a valid reference to a Logger_Config_T instance.
+ *
+ * @param ref The reference to the Logger_Config_T instance.
+ */
+extern void Logger_Config_delete(Logger_Config_T *ref);
+
+/**
+ * Load and apply the configuration file again.
+ * If the file is invalid or a handler can not be created the current configuration is left in place.
+ *
+ * Checked runtime errors:
+ *  - @param self must not be NULL.
+ *
+ * @param self The Logger_Config_T instance.
+ * @return `LOGGER_ERR_OK` or the error code, see Logger_Config_getErrorLine for `LOGGER_ERR_INVALID_CONFIG`.
+ */
+extern Logger_Err_T Logger_Config_reload(Logger_Config_T self);
+
+/**
+ * Start a thread that reloads the configuration whenever its file is written or replaced (inotify).
+ * It has no effect if the watcher is already running.
+ *
+ * Checked runtime errors:
+ *  - @param self must not be NULL.
+ *
+ * @param self The Logger_Config_T instance.
+ * @return `LOGGER_ERR_OK` or the error code, `LOGGER_ERR_UNKNOWN` where inotify is not available.
+ */
+extern Logger_Err_T Logger_Config_watch(Logger_Config_T self);
+
+/**
+ * Get the number of times the configuration has been applied, the first load included.
+ *
+ * Checked runtime errors:
+ *  - @param self must not be NULL.
+ *
+ * @param self The Logger_Config_T instance.
+ * @return The number of successful loads.
+ */
+extern size_t Logger_Config_getLoads(Logger_Config_T self);
+
+/**
+ * Get the line of the last `LOGGER_ERR_INVALID_CONFIG` error.
+ *
+ * Checked runtime errors:
+ *  - @param self must not be NULL.
+ *
+ * @param self The Logger_Config_T instance.
+ * @return The line number, starting from 1, or 0 if the last load succeeded.
+ */
+extern size_t Logger_Config_getErrorLine(Logger_Config_T self);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LOGGER_LOGGER_CONFIG_INCLUDED */
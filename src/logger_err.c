@@ -20,6 +20,7 @@ static const char *LOGGER_ERR_FILE_TOO_LARGE_STR = "File too large.";
 static const char *LOGGER_ERR_FILENAME_TOO_LONG_STR = "Filename too long.";
 static const char *LOGGER_ERR_TOO_MANY_OPEN_FILE_STR = "Too many files open in system.";
 static const char *LOGGER_ERR_OUT_OF_MEMORY_STR = "Out of memory";
+static const char *LOGGER_ERR_INVALID_CONFIG_STR = "Invalid configuration.";
 static const char *LOGGER_ERR_UNKNOWN_STR = "Unknown error.";
 
 const char *Logger_Err_gerString(Logger_Err_T err) {
@@ -44,6 +45,8 @@ const char *Logger_Err_gerString(Logger_Err_T err) {
             return LOGGER_ERR_TOO_MANY_OPEN_FILE_STR;
         case LOGGER_ERR_OUT_OF_MEMORY:
             return LOGGER_ERR_OUT_OF_MEMORY_STR;
+        case LOGGER_ERR_INVALID_CONFIG:
+            return LOGGER_ERR_INVALID_CONFIG_STR;
         case LOGGER_ERR_UNKNOWN:
             return LOGGER_ERR_UNKNOWN_STR;
         default:
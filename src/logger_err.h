@@ -26,6 +26,7 @@ typedef enum Logger_Err_T {
     LOGGER_ERR_FILENAME_TOO_LONG,
     LOGGER_ERR_TOO_MANY_OPEN_FILE,
     LOGGER_ERR_OUT_OF_MEMORY,
+    LOGGER_ERR_INVALID_CONFIG,
     LOGGER_ERR_UNKNOWN,
 } Logger_Err_T;
 
@@ -33,7 +34,7 @@ typedef enum Logger_Err_T {
  * Get the string representation of a Logger_Err_T.
  *
  * Checked runtime errors:
- *  - @param err must be in range LOGGER_ERR_OK - LOGGER_ERR_OUT_OF_MEMORY.
+ *  - @param err must be in range LOGGER_ERR_OK - LOGGER_ERR_UNKNOWN.
  *
  * @param err The error value.
  * @return The string representation of the Logger_Err_T.
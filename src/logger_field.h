@@ -0,0 +1,59 @@
+/*
+ * C Header File
+ *
+ * Author: daddinuz
+ * email:  daddinuz@gmail.com
+ * Date:   October 19, 2026
+ */
+
+#ifndef LOGGER_LOGGER_FIELD_INCLUDED
+#define LOGGER_LOGGER_FIELD_INCLUDED
+
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Logger_Field_Type_T identifies the type of the value of a Logger_Field_T.
+ */
+typedef enum Logger_Field_Type_T {
+    LOGGER_FIELD_TYPE_INT = 0,
+    LOGGER_FIELD_TYPE_UINT,
+    LOGGER_FIELD_TYPE_DOUBLE,
+    LOGGER_FIELD_TYPE_BOOL,
+    LOGGER_FIELD_TYPE_STR,
+} Logger_Field_Type_T;
+
+/**
+ * Logger_Field_T is a typed key-value pair attached to a record, serialized by the formatters as is
+ * instead of being expanded into the message.
+ *
+ * Fields do not own key and string values: like the message, they must outlive the logging request.
+ * A NULL string value is written as null by the JSON formatter and as "(null)" by the others.
+ * Build them with the LOGGER_INT, LOGGER_UINT, LOGGER_DOUBLE, LOGGER_BOOL and LOGGER_STR macros.
+ */
+typedef struct Logger_Field_T {
+    const char *key;
+    Logger_Field_Type_T type;
+    union {
+        long long asInt;
+        unsigned long long asUint;
+        double asDouble;
+        bool asBool;
+        const char *asStr;
+    } value;
+} Logger_Field_T;
+
+#define LOGGER_INT(xKey, xValue)     ((Logger_Field_T) {(xKey), LOGGER_FIELD_TYPE_INT, {.asInt=(xValue)}})
+#define LOGGER_UINT(xKey, xValue)    ((Logger_Field_T) {(xKey), LOGGER_FIELD_TYPE_UINT, {.asUint=(xValue)}})
+#define LOGGER_DOUBLE(xKey, xValue)  ((Logger_Field_T) {(xKey), LOGGER_FIELD_TYPE_DOUBLE, {.asDouble=(xValue)}})
+#define LOGGER_BOOL(xKey, xValue)    ((Logger_Field_T) {(xKey), LOGGER_FIELD_TYPE_BOOL, {.asBool=(xValue)}})
+#define LOGGER_STR(xKey, xValue)     ((Logger_Field_T) {(xKey), LOGGER_FIELD_TYPE_STR, {.asStr=(xValue)}})
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LOGGER_LOGGER_FIELD_INCLUDED */
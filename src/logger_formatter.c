@@ -7,21 +7,50 @@
  */
 
 #include <stdlib.h>
+#include <string.h>
 #include <assert.h>
+#include "logger_alloc.h"
 #include "logger_formatter.h"
 
+/*
+ * Handlers may share a formatter, references counts its owners (see Logger_Formatter_retain).
+ * Exactly one of the plain and the contextual pairs of callbacks is set.
+ */
 struct Logger_Formatter_T {
+    size_t references;
+    void *context;
     Logger_Formatter_formatRecordCallback_T *formatRecordCallback;
     Logger_Formatter_deleteFormattedRecordCallback_T *deleteFormattedRecordCallback;
+    Logger_Formatter_contextualFormatRecordCallback_T *contextualFormatRecordCallback;
+    Logger_Formatter_contextualDeleteFormattedRecordCallback_T *contextualDeleteFormattedRecordCallback;
+    Logger_Formatter_sizeFormattedRecordCallback_T *sizeFormattedRecordCallback;
+    Logger_Formatter_closeCallback_T *closeCallback;
+    Logger_Formatter_resetCallback_T *resetCallback;
 };
 
+static Logger_Formatter_T newFormatter(void) {
+    Logger_Formatter_T self = Logger_Alloc_malloc(sizeof(*self));
+    if (self) {
+        self->references = 1;
+        self->context = NULL;
+        self->formatRecordCallback = NULL;
+        self->deleteFormattedRecordCallback = NULL;
+        self->contextualFormatRecordCallback = NULL;
+        self->contextualDeleteFormattedRecordCallback = NULL;
+        self->sizeFormattedRecordCallback = NULL;
+        self->closeCallback = NULL;
+        self->resetCallback = NULL;
+    }
+    return self;
+}
+
 Logger_Formatter_T Logger_Formatter_new(
         Logger_Formatter_formatRecordCallback_T formatRecordCallback,
         Logger_Formatter_deleteFormattedRecordCallback_T deleteFormattedRecordCallback
 ) {
     assert(formatRecordCallback);
     assert(deleteFormattedRecordCallback);
-    Logger_Formatter_T self = malloc(sizeof(*self));
+    Logger_Formatter_T self = newFormatter();
     if (self) {
         self->formatRecordCallback = formatRecordCallback;
         self->deleteFormattedRecordCallback = deleteFormattedRecordCallback;
@@ -29,21 +58,103 @@ Logger_Formatter_T Logger_Formatter_new(
     return self;
 }
 
+Logger_Formatter_T Logger_Formatter_newContextual(
+        Logger_Formatter_contextualFormatRecordCallback_T formatRecordCallback,
+        Logger_Formatter_contextualDeleteFormattedRecordCallback_T deleteFormattedRecordCallback
+) {
+    assert(formatRecordCallback);
+    assert(deleteFormattedRecordCallback);
+    Logger_Formatter_T self = newFormatter();
+    if (self) {
+        self->contextualFormatRecordCallback = formatRecordCallback;
+        self->contextualDeleteFormattedRecordCallback = deleteFormattedRecordCallback;
+    }
+    return self;
+}
+
 void Logger_Formatter_delete(Logger_Formatter_T *ref) {
     assert(ref);
     assert(*ref);
     Logger_Formatter_T self = *ref;
-    free(self);
+    if (self->closeCallback) {
+        self->closeCallback(self);
+    }
+    Logger_Alloc_free(self);
+    *ref = NULL;
+}
+
+Logger_Formatter_T Logger_Formatter_retain(Logger_Formatter_T self) {
+    assert(self);
+    __atomic_fetch_add(&self->references, 1, __ATOMIC_RELAXED);
+    return self;
+}
+
+void Logger_Formatter_release(Logger_Formatter_T *ref) {
+    assert(ref);
+    assert(*ref);
+    Logger_Formatter_T self = *ref;
+    if (1 == __atomic_fetch_sub(&self->references, 1, __ATOMIC_ACQ_REL)) {
+        Logger_Formatter_delete(ref);
+    }
     *ref = NULL;
 }
 
 char *Logger_Formatter_formatRecord(Logger_Formatter_T self, Logger_Record_T record) {
     assert(self);
     assert(record);
-    return self->formatRecordCallback(record);
+    return self->contextualFormatRecordCallback ?
+           self->contextualFormatRecordCallback(self, record) : self->formatRecordCallback(record);
 }
 
 void Logger_Formatter_deleteFormattedRecord(Logger_Formatter_T self, char *formattedRecord) {
     assert(self);
-    self->deleteFormattedRecordCallback(formattedRecord);
+    if (self->contextualDeleteFormattedRecordCallback) {
+        self->contextualDeleteFormattedRecordCallback(self, formattedRecord);
+    } else {
+        self->deleteFormattedRecordCallback(formattedRecord);
+    }
+}
+
+size_t Logger_Formatter_sizeFormattedRecord(Logger_Formatter_T self, const char *formattedRecord) {
+    assert(self);
+    assert(formattedRecord);
+    return self->sizeFormattedRecordCallback ?
+           self->sizeFormattedRecordCallback(self, formattedRecord) : strlen(formattedRecord);
+}
+
+void Logger_Formatter_reset(Logger_Formatter_T self) {
+    assert(self);
+    if (self->resetCallback) {
+        self->resetCallback(self);
+    }
+}
+
+void *Logger_Formatter_getContext(Logger_Formatter_T self) {
+    assert(self);
+    return self->context;
+}
+
+void Logger_Formatter_setContext(Logger_Formatter_T self, void *context) {
+    assert(self);
+    self->context = context;
+}
+
+void Logger_Formatter_setSizeFormattedRecordCallback(
+        Logger_Formatter_T self, Logger_Formatter_sizeFormattedRecordCallback_T sizeFormattedRecordCallback
+) {
+    assert(self);
+    assert(sizeFormattedRecordCallback);
+    self->sizeFormattedRecordCallback = sizeFormattedRecordCallback;
+}
+
+void Logger_Formatter_setCloseCallback(Logger_Formatter_T self, Logger_Formatter_closeCallback_T closeCallback) {
+    assert(self);
+    assert(closeCallback);
+    self->closeCallback = closeCallback;
+}
+
+void Logger_Formatter_setResetCallback(Logger_Formatter_T self, Logger_Formatter_resetCallback_T resetCallback) {
+    assert(self);
+    assert(resetCallback);
+    self->resetCallback = resetCallback;
 }
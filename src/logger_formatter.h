@@ -9,6 +9,7 @@
 #ifndef LOGGER_LOGGER_FORMATTER_INCLUDED
 #define LOGGER_LOGGER_FORMATTER_INCLUDED
 
+#include <stddef.h>
 #include "logger_record.h"
 
 #ifdef __cplusplus
@@ -20,7 +21,11 @@ extern "C" {
  * Typically each Logger_Handler_T will have a Formatter associated with it.
  * The Formatter takes a Logger_Record_T and converts it to a string.
  */
+#ifdef __cplusplus
+typedef struct Logger_Formatter_C *Logger_Formatter_T;
+#else
 typedef struct Logger_Formatter_T *Logger_Formatter_T;
+#endif
 
 /**
  * The functions with this signature are used to customize the way in which a Logger_Record_T is formatted.
@@ -40,6 +45,55 @@ typedef char *Logger_Formatter_formatRecordCallback_T(Logger_Record_T record);
  */
 typedef void Logger_Formatter_deleteFormattedRecordCallback_T(char *formattedRecord);
 
+/**
+ * Like Logger_Formatter_formatRecordCallback_T for formatters that keep state in their context
+ * (see Logger_Formatter_getContext).
+ *
+ * Note for implementation:
+ *  - Those functions must assert that formatter is not NULL.
+ *  - Those functions must assert that record is not NULL.
+ *  - Those functions must return NULL in case of OOM.
+ */
+typedef char *Logger_Formatter_contextualFormatRecordCallback_T(Logger_Formatter_T formatter, Logger_Record_T record);
+
+/**
+ * Like Logger_Formatter_deleteFormattedRecordCallback_T for formatters that keep state in their context.
+ *
+ * Note for implementation:
+ *  - Those functions must assert that formatter is not NULL.
+ *  - Those functions must consider the case in which formattedRecord is NULL.
+ */
+typedef void Logger_Formatter_contextualDeleteFormattedRecordCallback_T(
+        Logger_Formatter_T formatter, char *formattedRecord
+);
+
+/**
+ * The functions with this signature are used to get the size in bytes of a formatted record.
+ * Formatters producing binary output, that may contain NUL bytes, must provide one.
+ *
+ * Note for implementation:
+ *  - Those functions must assert that formatter is not NULL.
+ *  - Those functions must assert that formattedRecord is not NULL.
+ */
+typedef size_t Logger_Formatter_sizeFormattedRecordCallback_T(Logger_Formatter_T formatter, const char *formattedRecord);
+
+/**
+ * The functions with this signature are used to destruct the context associated to the formatter.
+ *
+ * Note for implementation:
+ *  - Those functions must assert that formatter is not NULL.
+ */
+typedef void Logger_Formatter_closeCallback_T(Logger_Formatter_T formatter);
+
+/**
+ * The functions with this signature are used to forget what the formatter already wrote, e.g. the definitions
+ * a stateful formatter writes once and refers to afterwards, so that the next records can be read on their own.
+ *
+ * Note for implementation:
+ *  - Those functions must assert that formatter is not NULL.
+ */
+typedef void Logger_Formatter_resetCallback_T(Logger_Formatter_T formatter);
+
 /**
  * Construct a Logger_Formatter_T.
  *
@@ -57,6 +111,23 @@ extern Logger_Formatter_T Logger_Formatter_new(
         Logger_Formatter_deleteFormattedRecordCallback_T deleteFormattedRecordCallback
 );
 
+/**
+ * Construct a Logger_Formatter_T whose callbacks are given the formatter, and through it its context.
+ *
+ * Checked runtime errors:
+ *  - @param formatRecordCallback must not be NULL.
+ *  - @param deleteFormattedRecordCallback must not be NULL.
+ *  - In case of OOM this function will return NULL.
+ *
+ * @param formatRecordCallback Formatter function that will be called to format a Logger_Record_T.
+ * @param deleteFormattedRecordCallback Destructor function that will be called by Logger_Formatter_deleteMessage.
+ * @return A new instance of Logger_Formatter_T.
+ */
+extern Logger_Formatter_T Logger_Formatter_newContextual(
+        Logger_Formatter_contextualFormatRecordCallback_T formatRecordCallback,
+        Logger_Formatter_contextualDeleteFormattedRecordCallback_T deleteFormattedRecordCallback
+);
+
 /**
  * Destruct a Logger_Formatter_T.
  *
@@ -67,6 +138,29 @@ extern Logger_Formatter_T Logger_Formatter_new(
  */
 extern void Logger_Formatter_delete(Logger_Formatter_T *ref);
 
+/**
+ * Take a reference to a formatter, e.g. for each handler using it.
+ * A new formatter holds one reference.
+ *
+ * Checked runtime errors:
+ *  - @param self must not be NULL.
+ *
+ * @param self The Logger_Formatter_T instance.
+ * @return The same instance.
+ */
+extern Logger_Formatter_T Logger_Formatter_retain(Logger_Formatter_T self);
+
+/**
+ * Drop a reference to a formatter, destructing it along with the last one.
+ * Logger_Formatter_delete destructs the formatter regardless of the references left.
+ *
+ * Checked runtime errors:
+ *  - @param ref must be a valid reference to a Logger_Formatter_T instance.
+ *
+ * @param ref The reference to the Logger_Formatter_T instance.
+ */
+extern void Logger_Formatter_release(Logger_Formatter_T *ref);
+
 /**
  * Format the record as specified by the associated formatter callback.
  *
@@ -92,6 +186,91 @@ extern char *Logger_Formatter_formatRecord(Logger_Formatter_T self, Logger_Recor
  */
 extern void Logger_Formatter_deleteFormattedRecord(Logger_Formatter_T self, char *formattedRecord);
 
+/**
+ * Get the size in bytes of the formatted record.
+ * If no size callback has been set the formatted record is considered a NUL terminated string.
+ *
+ * Checked runtime errors:
+ *  - @param self must not be NULL.
+ *  - @param formattedRecord must not be NULL.
+ *
+ * @param self The Logger_Formatter_T instance.
+ * @param formattedRecord The formatted record returned by Logger_Formatter_formatRecord.
+ * @return The size in bytes of the formatted record.
+ */
+extern size_t Logger_Formatter_sizeFormattedRecord(Logger_Formatter_T self, const char *formattedRecord);
+
+/**
+ * Make the formatter forget what it already wrote, handlers call this whenever they start writing a new file.
+ * Does nothing if no reset callback has been set.
+ *
+ * Checked runtime errors:
+ *  - @param self must not be NULL.
+ *
+ * @param self The Logger_Formatter_T instance.
+ */
+extern void Logger_Formatter_reset(Logger_Formatter_T self);
+
+/**
+ * Get the context associated to the formatter.
+ *
+ * Checked runtime errors:
+ *  - @param self must not be NULL.
+ *
+ * @param self The Logger_Formatter_T instance.
+ * @return The context associated to the formatter.
+ */
+extern void *Logger_Formatter_getContext(Logger_Formatter_T self);
+
+/**
+ * Set the context associated to the formatter.
+ *
+ * Checked runtime errors:
+ *  - @param self must not be NULL.
+ *
+ * @param self The Logger_Formatter_T instance.
+ * @param context The new context for the formatter.
+ */
+extern void Logger_Formatter_setContext(Logger_Formatter_T self, void *context);
+
+/**
+ * Set the callback used to get the size in bytes of a formatted record.
+ *
+ * Checked runtime errors:
+ *  - @param self must not be NULL.
+ *  - @param sizeFormattedRecordCallback must not be NULL.
+ *
+ * @param self The Logger_Formatter_T instance.
+ * @param sizeFormattedRecordCallback The callback used by Logger_Formatter_sizeFormattedRecord.
+ */
+extern void Logger_Formatter_setSizeFormattedRecordCallback(
+        Logger_Formatter_T self, Logger_Formatter_sizeFormattedRecordCallback_T sizeFormattedRecordCallback
+);
+
+/**
+ * Set the callback used to destruct the context when the formatter is deleted.
+ *
+ * Checked runtime errors:
+ *  - @param self must not be NULL.
+ *  - @param closeCallback must not be NULL.
+ *
+ * @param self The Logger_Formatter_T instance.
+ * @param closeCallback The callback called by Logger_Formatter_delete.
+ */
+extern void Logger_Formatter_setCloseCallback(Logger_Formatter_T self, Logger_Formatter_closeCallback_T closeCallback);
+
+/**
+ * Set the callback called by Logger_Formatter_reset.
+ *
+ * Checked runtime errors:
+ *  - @param self must not be NULL.
+ *  - @param resetCallback must not be NULL.
+ *
+ * @param self The Logger_Formatter_T instance.
+ * @param resetCallback The callback called by Logger_Formatter_reset.
+ */
+extern void Logger_Formatter_setResetCallback(Logger_Formatter_T self, Logger_Formatter_resetCallback_T resetCallback);
+
 #ifdef __cplusplus
 }
 #endif
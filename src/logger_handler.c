@@ -8,17 +8,45 @@
 
 #include <stdlib.h>
 #include <assert.h>
+#include "logger_alloc.h"
+#include "logger_clock.h"
 #include "logger_handler.h"
+#ifdef LOGGER_HISTOGRAM
+#include "logger_histogram.h"
+#endif
 
+#define NANOSECONDS_PER_MILLISECOND UINT64_C(1000000)
+
+#if LOGGER_HANDLER_BACKOFF_MIN > LOGGER_HANDLER_BACKOFF_MAX || LOGGER_HANDLER_BACKOFF_MAX > UINT32_MAX
+#error "LOGGER_HANDLER_BACKOFF_MIN must not be greater than LOGGER_HANDLER_BACKOFF_MAX, which must fit in 32 bits"
+#endif
+
+/*
+ * Handlers may be shared by loggers used from many threads, so the level, the backoff bounds and the error
+ * bookkeeping are updated with relaxed atomics.
+ * backoff packs the minimum and maximum delay, in milliseconds, so they are always read as a pair.
+ * references counts the owners of the handler (see Logger_Handler_retain).
+ */
 struct Logger_Handler_T {
+    size_t references;
     void *context;
     Logger_Level_T level;
     Logger_Formatter_T formatter;
+    uint64_t backoff;
+    uint64_t retryAt;
+    Logger_Handler_Stats_T stats;
+    bool publishTiming;
+    size_t consecutiveErrors;
+    int lastErr;
     Logger_Handler_PublishCallback_T *publishCallback;
     Logger_Handler_FlushCallback_T *flushCallback;
     Logger_Handler_CloseCallback_T *closeCallback;
 };
 
+static uint64_t packBackoff(size_t minMilliseconds, size_t maxMilliseconds) {
+    return (uint64_t) minMilliseconds << 32 | (uint64_t) maxMilliseconds;
+}
+
 Logger_Handler_T Logger_Handler_new(
         Logger_Handler_PublishCallback_T publishCallback,
         Logger_Handler_FlushCallback_T flushCallback,
@@ -27,11 +55,20 @@ Logger_Handler_T Logger_Handler_new(
     assert(publishCallback);
     assert(flushCallback);
     assert(closeCallback);
-    Logger_Handler_T self = malloc(sizeof(*self));
+    Logger_Handler_T self = Logger_Alloc_malloc(sizeof(*self));
     if (self) {
+        self->references = 1;
         self->context = NULL;
         self->level = LOGGER_LEVEL_DEBUG;
         self->formatter = NULL;
+        self->backoff = packBackoff(LOGGER_HANDLER_BACKOFF_MIN, LOGGER_HANDLER_BACKOFF_MAX);
+        self->retryAt = 0;
+        self->stats = (Logger_Handler_Stats_T) {
+                .published=0, .bytesWritten=0, .filtered=0, .errors=0, .drops=0, .flushes=0, .publishTime=0
+        };
+        self->publishTiming = false;
+        self->consecutiveErrors = 0;
+        self->lastErr = LOGGER_ERR_OK;
         self->publishCallback = publishCallback;
         self->flushCallback = flushCallback;
         self->closeCallback = closeCallback;
@@ -45,18 +82,81 @@ void Logger_Handler_delete(Logger_Handler_T *ref) {
     Logger_Handler_T self = *ref;
     self->flushCallback(self);
     self->closeCallback(self);
-    free(self);
+    Logger_Alloc_free(self);
     *ref = NULL;
 }
 
+Logger_Handler_T Logger_Handler_retain(Logger_Handler_T self) {
+    assert(self);
+    __atomic_fetch_add(&self->references, 1, __ATOMIC_RELAXED);
+    return self;
+}
+
+void Logger_Handler_release(Logger_Handler_T *ref) {
+    assert(ref);
+    assert(*ref);
+    Logger_Handler_T self = *ref;
+    if (1 == __atomic_fetch_sub(&self->references, 1, __ATOMIC_ACQ_REL)) {
+        Logger_Handler_delete(ref);
+    }
+    *ref = NULL;
+}
+
+static uint64_t backoffDelay(uint64_t backoffMin, uint64_t backoffMax, size_t consecutiveErrors) {
+    assert(consecutiveErrors > 0);
+    const size_t shift = consecutiveErrors - 1;
+    if (shift >= 63 || backoffMin > (backoffMax >> shift)) {
+        return backoffMax;
+    }
+    return backoffMin << shift;
+}
+
 Logger_Err_T Logger_Handler_publish(Logger_Handler_T self, Logger_Record_T record) {
     assert(self);
     assert(record);
-    return self->publishCallback(self, record);
+    const uint64_t retryAt = __atomic_load_n(&self->retryAt, __ATOMIC_RELAXED);
+    if (retryAt > 0 && Logger_Clock_getMonotonicTime() < retryAt) {
+        const int lastErr = __atomic_load_n(&self->lastErr, __ATOMIC_RELAXED);
+        __atomic_fetch_add(&self->stats.drops, 1, __ATOMIC_RELAXED);
+        return (Logger_Err_T) lastErr;
+    }
+
+#ifdef LOGGER_HISTOGRAM
+    const uint64_t startTicks = Logger_Histogram_getTicks();
+#endif
+    const bool publishTiming = __atomic_load_n(&self->publishTiming, __ATOMIC_RELAXED);
+    const uint64_t start = publishTiming ? Logger_Clock_getMonotonicTime() : 0;
+    const Logger_Err_T err = self->publishCallback(self, record);
+    if (publishTiming) {
+        __atomic_fetch_add(&self->stats.publishTime, Logger_Clock_getMonotonicTime() - start, __ATOMIC_RELAXED);
+    }
+#ifdef LOGGER_HISTOGRAM
+    _Logger_Histogram_addIoTicks(Logger_Histogram_getTicks() - startTicks);
+#endif
+    if (LOGGER_ERR_OK == err) {
+        __atomic_fetch_add(&self->stats.published, 1, __ATOMIC_RELAXED);
+        if (__atomic_load_n(&self->consecutiveErrors, __ATOMIC_RELAXED) > 0) {
+            __atomic_store_n(&self->consecutiveErrors, 0, __ATOMIC_RELAXED);
+            __atomic_store_n(&self->retryAt, 0, __ATOMIC_RELAXED);
+        }
+    } else {
+        const size_t consecutiveErrors = __atomic_add_fetch(&self->consecutiveErrors, 1, __ATOMIC_RELAXED);
+        __atomic_fetch_add(&self->stats.errors, 1, __ATOMIC_RELAXED);
+        __atomic_store_n(&self->lastErr, (int) err, __ATOMIC_RELAXED);
+        const uint64_t backoff = __atomic_load_n(&self->backoff, __ATOMIC_RELAXED);
+        if (backoff >> 32) {
+            const uint64_t backoffMin = (backoff >> 32) * NANOSECONDS_PER_MILLISECOND;
+            const uint64_t backoffMax = (backoff & UINT32_MAX) * NANOSECONDS_PER_MILLISECOND;
+            const uint64_t delay = backoffDelay(backoffMin, backoffMax, consecutiveErrors);
+            __atomic_store_n(&self->retryAt, Logger_Clock_getMonotonicTime() + delay, __ATOMIC_RELAXED);
+        }
+    }
+    return err;
 }
 
 void Logger_Handler_flush(Logger_Handler_T self) {
     assert(self);
+    __atomic_fetch_add(&self->stats.flushes, 1, __ATOMIC_RELAXED);
     self->flushCallback(self);
 }
 
@@ -68,7 +168,9 @@ void Logger_Handler_close(Logger_Handler_T self) {
 bool Logger_Handler_isLoggable(Logger_Handler_T self, Logger_Record_T record) {
     assert(self);
     assert(record);
-    return Logger_Record_getLevel(record) >= Logger_Handler_getLevel(self);
+    const Logger_CallSite_T *callSite = Logger_Record_getCallSite(record);
+    return (callSite && Logger_CallSite_isEnabled(callSite)) ||
+           Logger_Record_getLevel(record) >= Logger_Handler_getLevel(self);
 }
 
 void *Logger_Handler_getContext(Logger_Handler_T self) {
@@ -78,12 +180,48 @@ void *Logger_Handler_getContext(Logger_Handler_T self) {
 
 Logger_Level_T Logger_Handler_getLevel(Logger_Handler_T self) {
     assert(self);
-    return self->level;
+    return __atomic_load_n(&self->level, __ATOMIC_RELAXED);
+}
+
+Logger_Handler_Stats_T Logger_Handler_getStats(Logger_Handler_T self) {
+    assert(self);
+    return (Logger_Handler_Stats_T) {
+            .published=__atomic_load_n(&self->stats.published, __ATOMIC_RELAXED),
+            .bytesWritten=__atomic_load_n(&self->stats.bytesWritten, __ATOMIC_RELAXED),
+            .filtered=__atomic_load_n(&self->stats.filtered, __ATOMIC_RELAXED),
+            .errors=__atomic_load_n(&self->stats.errors, __ATOMIC_RELAXED),
+            .drops=__atomic_load_n(&self->stats.drops, __ATOMIC_RELAXED),
+            .flushes=__atomic_load_n(&self->stats.flushes, __ATOMIC_RELAXED),
+            .publishTime=__atomic_load_n(&self->stats.publishTime, __ATOMIC_RELAXED)
+    };
+}
+
+void Logger_Handler_addBytesWritten(Logger_Handler_T self, size_t bytes) {
+    assert(self);
+    __atomic_fetch_add(&self->stats.bytesWritten, (uint64_t) bytes, __ATOMIC_RELAXED);
+}
+
+void Logger_Handler_addError(Logger_Handler_T self, Logger_Err_T err) {
+    assert(self);
+    assert(LOGGER_ERR_OK != err);
+    __atomic_fetch_add(&self->stats.errors, 1, __ATOMIC_RELAXED);
+    __atomic_store_n(&self->lastErr, (int) err, __ATOMIC_RELAXED);
+}
+
+void Logger_Handler_addFiltered(Logger_Handler_T self) {
+    assert(self);
+    __atomic_fetch_add(&self->stats.filtered, 1, __ATOMIC_RELAXED);
+}
+
+bool Logger_Handler_isBackingOff(Logger_Handler_T self) {
+    assert(self);
+    const uint64_t retryAt = __atomic_load_n(&self->retryAt, __ATOMIC_RELAXED);
+    return retryAt > 0 && Logger_Clock_getMonotonicTime() < retryAt;
 }
 
 Logger_Formatter_T Logger_Handler_getFormatter(Logger_Handler_T self) {
     assert(self);
-    return self->formatter;
+    return __atomic_load_n(&self->formatter, __ATOMIC_ACQUIRE);
 }
 
 void Logger_Handler_setContext(Logger_Handler_T self, void *context) {
@@ -94,11 +232,24 @@ void Logger_Handler_setContext(Logger_Handler_T self, void *context) {
 void Logger_Handler_setLevel(Logger_Handler_T self, Logger_Level_T level) {
     assert(self);
     assert(LOGGER_LEVEL_DEBUG <= level && level <= LOGGER_LEVEL_FATAL);
-    self->level = level;
+    __atomic_store_n(&self->level, level, __ATOMIC_RELAXED);
 }
 
 void Logger_Handler_setFormatter(Logger_Handler_T self, Logger_Formatter_T formatter) {
     assert(self);
     assert(formatter);
-    self->formatter = formatter;
+    __atomic_store_n(&self->formatter, formatter, __ATOMIC_RELEASE);
+}
+
+void Logger_Handler_setBackoff(Logger_Handler_T self, size_t minMilliseconds, size_t maxMilliseconds) {
+    assert(self);
+    assert(minMilliseconds <= maxMilliseconds);
+    assert(maxMilliseconds <= UINT32_MAX);
+    __atomic_store_n(&self->backoff, packBackoff(minMilliseconds, maxMilliseconds), __ATOMIC_RELAXED);
+    __atomic_store_n(&self->retryAt, 0, __ATOMIC_RELAXED);
+}
+
+void Logger_Handler_setPublishTiming(Logger_Handler_T self, bool publishTiming) {
+    assert(self);
+    __atomic_store_n(&self->publishTiming, publishTiming, __ATOMIC_RELAXED);
 }
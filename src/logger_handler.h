@@ -9,6 +9,7 @@
 #ifndef LOGGER_LOGGER_HANDLER_INCLUDED
 #define LOGGER_LOGGER_HANDLER_INCLUDED
 
+#include <stdint.h>
 #include <stdbool.h>
 #include "logger_err.h"
 #include "logger_record.h"
@@ -22,7 +23,11 @@ extern "C" {
  * A Logger_Handler_T takes Logger_Record_T from a Logger_T and exports them.
  * It might for example, write them to a console or write them to a file.
  */
+#ifdef __cplusplus
+typedef struct Logger_Handler_C *Logger_Handler_T;
+#else
 typedef struct Logger_Handler_T *Logger_Handler_T;
+#endif
 
 /**
  * The functions with this signature are used to publish the formatted record.
@@ -50,6 +55,27 @@ typedef void Logger_Handler_FlushCallback_T(Logger_Handler_T handler);
  */
 typedef void Logger_Handler_CloseCallback_T(Logger_Handler_T handler);
 
+/**
+ * Logger_Handler_Stats_T holds the counters of a handler:
+ *  - published: records successfully handed to the publish callback.
+ *  - bytesWritten: bytes reported by the handler through Logger_Handler_addBytesWritten.
+ *  - filtered: records a logger did not hand to the handler because of its level (see Logger_Handler_addFiltered).
+ *  - errors: failed publish callbacks and errors reported through Logger_Handler_addError.
+ *  - drops: records not handed to the publish callback because the handler was backing off.
+ *  - flushes: calls to Logger_Handler_flush.
+ *  - publishTime: nanoseconds spent in the publish callback, measured only if enabled with
+ *    Logger_Handler_setPublishTiming.
+ */
+typedef struct Logger_Handler_Stats_T {
+    uint64_t published;
+    uint64_t bytesWritten;
+    uint64_t filtered;
+    uint64_t errors;
+    uint64_t drops;
+    uint64_t flushes;
+    uint64_t publishTime;
+} Logger_Handler_Stats_T;
+
 /**
  * Construct a Logger_Handler_T.
  *
@@ -80,8 +106,47 @@ extern Logger_Handler_T Logger_Handler_new(
  */
 extern void Logger_Handler_delete(Logger_Handler_T *ref);
 
+/**
+ * Take a reference to a handler, e.g. for each logger using it.
+ * A new handler holds one reference.
+ *
+ * Checked runtime errors:
+ *  - @param self must not be NULL.
+ *
+ * @param self The Logger_Handler_T instance.
+ * @return The same instance.
+ */
+extern Logger_Handler_T Logger_Handler_retain(Logger_Handler_T self);
+
+/**
+ * Drop a reference to a handler, destructing it along with the last one; its formatter is left untouched.
+ * Logger_Handler_delete destructs the handler regardless of the references left.
+ *
+ * Checked runtime errors:
+ *  - @param ref must be a valid reference to a Logger_Handler_T instance.
+ *
+ * @param ref The reference to the Logger_Handler_T instance.
+ */
+extern void Logger_Handler_release(Logger_Handler_T *ref);
+
+/**
+ * The default backoff bounds, in milliseconds, applied to handlers whose publish fails.
+ * Backing off is opt-in: with a minimum of 0 handlers never back off unless Logger_Handler_setBackoff
+ * is called, building with a non-zero LOGGER_HANDLER_BACKOFF_MIN turns it on for every handler.
+ */
+#ifndef LOGGER_HANDLER_BACKOFF_MIN
+#define LOGGER_HANDLER_BACKOFF_MIN  0
+#endif
+#ifndef LOGGER_HANDLER_BACKOFF_MAX
+#define LOGGER_HANDLER_BACKOFF_MAX  30000
+#endif
+
 /**
  * Publish the formatted record.
+ * When the publish callback fails a handler with a backoff (see Logger_Handler_setBackoff) backs off: records
+ * are not handed to the callback for a delay that doubles on every consecutive failure, such records
+ * are counted as drops and publish returns the error that started the backoff.
+ * The first successful publish ends the backoff.
  *
  * Checked runtime errors:
  *  - @param self must not be NULL.
@@ -89,6 +154,7 @@ extern void Logger_Handler_delete(Logger_Handler_T *ref);
  *
  * @param self The Logger_Handler_T instance.
  * @param record A Logger_Record_T instance.
+ * @return The `LOGGER_ERR_OK` or the error code.
  */
 extern Logger_Err_T Logger_Handler_publish(Logger_Handler_T self, Logger_Record_T record);
 
@@ -114,6 +180,7 @@ extern void Logger_Handler_close(Logger_Handler_T self);
 
 /**
  * Check if this handler would actually log a given Logger_Record_T.
+ * Records issued by call sites forced with Logger_CallSite_enable are always loggable.
  *
  * Checked runtime errors:
  *  - @param self must not be NULL.
@@ -147,6 +214,64 @@ extern void *Logger_Handler_getContext(Logger_Handler_T self);
  */
 extern Logger_Level_T Logger_Handler_getLevel(Logger_Handler_T self);
 
+/**
+ * Get a snapshot of the counters of the handler.
+ * Counters are updated with relaxed atomics, so the fields of a snapshot taken while the handler
+ * is in use may be mutually inconsistent by a few records.
+ *
+ * Checked runtime errors:
+ *  - @param self must not be NULL.
+ *
+ * @param self The Logger_Handler_T instance.
+ * @return The counters of the handler.
+ */
+extern Logger_Handler_Stats_T Logger_Handler_getStats(Logger_Handler_T self);
+
+/**
+ * Account bytes written by the handler to its sink, publish callbacks are expected to call this.
+ *
+ * Checked runtime errors:
+ *  - @param self must not be NULL.
+ *
+ * @param self The Logger_Handler_T instance.
+ * @param bytes The number of bytes written.
+ */
+extern void Logger_Handler_addBytesWritten(Logger_Handler_T self, size_t bytes);
+
+/**
+ * Account an error the handler ran into outside of a publish callback, e.g. a background write that failed.
+ * Flush and close callbacks can not return errors, they are expected to call this instead.
+ *
+ * Checked runtime errors:
+ *  - @param self must not be NULL.
+ *  - @param err must not be LOGGER_ERR_OK.
+ *
+ * @param self The Logger_Handler_T instance.
+ * @param err The error.
+ */
+extern void Logger_Handler_addError(Logger_Handler_T self, Logger_Err_T err);
+
+/**
+ * Account a record rejected by Logger_Handler_isLoggable, loggers dispatching records call this.
+ *
+ * Checked runtime errors:
+ *  - @param self must not be NULL.
+ *
+ * @param self The Logger_Handler_T instance.
+ */
+extern void Logger_Handler_addFiltered(Logger_Handler_T self);
+
+/**
+ * Check if the handler is backing off after a failure.
+ *
+ * Checked runtime errors:
+ *  - @param self must not be NULL.
+ *
+ * @param self The Logger_Handler_T instance.
+ * @return True if records are currently not handed to the publish callback.
+ */
+extern bool Logger_Handler_isBackingOff(Logger_Handler_T self);
+
 /**
  * Get the formatter associated to the handler.
  *
@@ -171,7 +296,7 @@ extern Logger_Formatter_T Logger_Handler_getFormatter(Logger_Handler_T self);
 extern void Logger_Handler_setContext(Logger_Handler_T self, void *context);
 
 /**
- * Set the Logger_Level_T for the current handler.
+ * Set the Logger_Level_T for the current handler, it is safe to call while other threads are logging.
  *
  * Checked runtime errors:
  *  - @param self must not be NULL.
@@ -184,6 +309,8 @@ extern void Logger_Handler_setLevel(Logger_Handler_T self, Logger_Level_T level)
 
 /**
  * Set the formatter for the current handler.
+ * Other threads may still be formatting records with the previous formatter, to replace it on a live logger
+ * swap in a new handler with Logger_reconfigure instead.
  *
  * Checked runtime errors:
  *  - @param self must not be NULL.
@@ -194,6 +321,35 @@ extern void Logger_Handler_setLevel(Logger_Handler_T self, Logger_Level_T level)
  */
 extern void Logger_Handler_setFormatter(Logger_Handler_T self, Logger_Formatter_T formatter);
 
+/**
+ * Set the bounds of the delay applied after consecutive publish failures.
+ * Unlike most loggers, handlers do not back off by default: LOGGER_HANDLER_BACKOFF_MIN is 0, so a failing
+ * handler is retried on every record until this is called or the library is built with a non-zero minimum.
+ * It is safe to call while other threads are logging, publishes see either the old or the new pair of bounds.
+ *
+ * Checked runtime errors:
+ *  - @param self must not be NULL.
+ *  - @param minMilliseconds must not be greater than maxMilliseconds.
+ *  - @param maxMilliseconds must not be greater than UINT32_MAX.
+ *
+ * @param self The Logger_Handler_T instance.
+ * @param minMilliseconds The delay after the first failure or 0 to never back off.
+ * @param maxMilliseconds The upper bound of the delay.
+ */
+extern void Logger_Handler_setBackoff(Logger_Handler_T self, size_t minMilliseconds, size_t maxMilliseconds);
+
+/**
+ * Enable or disable the measure of the time spent in the publish callback (see Logger_Handler_Stats_T),
+ * it takes two clock reads per publish and is disabled by default.
+ *
+ * Checked runtime errors:
+ *  - @param self must not be NULL.
+ *
+ * @param self The Logger_Handler_T instance.
+ * @param publishTiming True to measure the publish time.
+ */
+extern void Logger_Handler_setPublishTiming(Logger_Handler_T self, bool publishTiming);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,169 @@
+/*
+ * C Source File
+ *
+ * Author: daddinuz
+ * email:  daddinuz@gmail.com
+ * Date:   October 19, 2026
+ */
+
+#include <stdlib.h>
+#include <assert.h>
+#include <stdbool.h>
+#include <pthread.h>
+#include "logger_clock.h"
+#include "logger_histogram.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define HISTOGRAM_USE_TSC 1
+#endif
+
+#define SUB_BUCKET_COUNT    (UINT64_C(1) << LOGGER_HISTOGRAM_SUB_BUCKET_BITS)
+#define BUCKET_COUNT        ((65 - LOGGER_HISTOGRAM_SUB_BUCKET_BITS) << LOGGER_HISTOGRAM_SUB_BUCKET_BITS)
+#define CALIBRATION_TIME    UINT64_C(10000000)
+
+static uint64_t gBuckets[LOGGER_HISTOGRAM_PHASES_COUNT][BUCKET_COUNT];
+static uint64_t gCounts[LOGGER_HISTOGRAM_PHASES_COUNT];
+static pthread_once_t gOnce = PTHREAD_ONCE_INIT;
+static uint64_t gStartTicks = 0;
+static uint64_t gStartTime = 0;
+static pthread_once_t gCalibrationOnce = PTHREAD_ONCE_INIT;
+static double gNanosecondsPerTick = 1.0;
+static __thread uint64_t gIoTicks = 0;
+
+static void dumpAtExit(void) {
+    Logger_Histogram_dump(stderr);
+}
+
+static void initialize(void) {
+    gStartTicks = Logger_Histogram_getTicks();
+    gStartTime = Logger_Clock_getMonotonicTime();
+    if (getenv("LOGGER_HISTOGRAM_DUMP")) {
+        atexit(dumpAtExit);
+    }
+}
+
+/*
+ * The time stamp counter rate is measured once against the monotonic clock, over at least CALIBRATION_TIME
+ * from the first use of the histograms: reading them right after being started costs a short busy wait.
+ */
+static void calibrate(void) {
+#ifdef HISTOGRAM_USE_TSC
+    pthread_once(&gOnce, initialize);
+    uint64_t time = Logger_Clock_getMonotonicTime();
+    while (time - gStartTime < CALIBRATION_TIME) {
+        time = Logger_Clock_getMonotonicTime();
+    }
+    const uint64_t ticks = Logger_Histogram_getTicks();
+    gNanosecondsPerTick = ticks > gStartTicks ? (double) (time - gStartTime) / (double) (ticks - gStartTicks) : 1.0;
+#endif
+}
+
+static double nanosecondsPerTick(void) {
+    pthread_once(&gCalibrationOnce, calibrate);
+    return gNanosecondsPerTick;
+}
+
+static size_t bucketIndex(uint64_t value) {
+    if (value < SUB_BUCKET_COUNT) {
+        return (size_t) value;
+    }
+    const unsigned exponent = 63 - (unsigned) __builtin_clzll(value);
+    const unsigned shift = exponent - LOGGER_HISTOGRAM_SUB_BUCKET_BITS;
+    return (size_t) ((shift + 1) * SUB_BUCKET_COUNT + ((value >> shift) - SUB_BUCKET_COUNT));
+}
+
+/*
+ * The highest value that falls in the bucket.
+ */
+static uint64_t bucketValue(size_t index) {
+    if (index < SUB_BUCKET_COUNT) {
+        return index;
+    }
+    const unsigned shift = (unsigned) (index / SUB_BUCKET_COUNT) - 1;
+    const uint64_t subBucket = index % SUB_BUCKET_COUNT + SUB_BUCKET_COUNT;
+    return ((subBucket + 1) << shift) - 1;
+}
+
+uint64_t Logger_Histogram_getTicks(void) {
+#ifdef HISTOGRAM_USE_TSC
+    return __rdtsc();
+#else
+    return Logger_Clock_getMonotonicTime();
+#endif
+}
+
+void Logger_Histogram_record(Logger_Histogram_Phase_T phase, uint64_t ticks) {
+    assert(LOGGER_HISTOGRAM_PHASE_FORMAT <= phase && phase < LOGGER_HISTOGRAM_PHASES_COUNT);
+    pthread_once(&gOnce, initialize);
+    __atomic_fetch_add(&gBuckets[phase][bucketIndex(ticks)], 1, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&gCounts[phase], 1, __ATOMIC_RELAXED);
+}
+
+uint64_t Logger_Histogram_getCount(Logger_Histogram_Phase_T phase) {
+    assert(LOGGER_HISTOGRAM_PHASE_FORMAT <= phase && phase < LOGGER_HISTOGRAM_PHASES_COUNT);
+    return __atomic_load_n(&gCounts[phase], __ATOMIC_RELAXED);
+}
+
+uint64_t Logger_Histogram_getPercentile(Logger_Histogram_Phase_T phase, double percentile) {
+    assert(LOGGER_HISTOGRAM_PHASE_FORMAT <= phase && phase < LOGGER_HISTOGRAM_PHASES_COUNT);
+    assert(0.0 <= percentile && percentile <= 100.0);
+    const uint64_t count = Logger_Histogram_getCount(phase);
+    if (0 == count) {
+        return 0;
+    }
+
+    /* shave the rounding error of percentiles such as 99.9 that have no exact binary representation */
+    const double rank = percentile / 100.0 * (double) count * (1.0 - 1e-12);
+    uint64_t target = (uint64_t) rank;
+    target += (double) target < rank || 0 == target ? 1 : 0;
+    uint64_t seen = 0;
+    size_t index = 0;
+    for (; index < BUCKET_COUNT - 1; index++) {
+        seen += __atomic_load_n(&gBuckets[phase][index], __ATOMIC_RELAXED);
+        if (seen >= target) {
+            break;
+        }
+    }
+    const uint64_t ticks = bucketValue(index);
+    return (uint64_t) ((double) ticks * nanosecondsPerTick());
+}
+
+void Logger_Histogram_reset(void) {
+    for (size_t phase = 0; phase < LOGGER_HISTOGRAM_PHASES_COUNT; phase++) {
+        __atomic_store_n(&gCounts[phase], 0, __ATOMIC_RELAXED);
+        for (size_t index = 0; index < BUCKET_COUNT; index++) {
+            __atomic_store_n(&gBuckets[phase][index], 0, __ATOMIC_RELAXED);
+        }
+    }
+}
+
+void Logger_Histogram_dump(FILE *stream) {
+    assert(stream);
+    static const char *NAMES[LOGGER_HISTOGRAM_PHASES_COUNT] = {"format", "dispatch", "io", "total"};
+    static const double PERCENTILES[] = {50.0, 90.0, 99.0, 99.9, 99.99, 100.0};
+
+    fprintf(stream, "%-10s %12s", "phase", "count");
+    for (size_t i = 0; i < sizeof(PERCENTILES) / sizeof(PERCENTILES[0]); i++) {
+        fprintf(stream, " %9gp", PERCENTILES[i]);
+    }
+    fprintf(stream, "  (ns)\n");
+    for (size_t phase = 0; phase < LOGGER_HISTOGRAM_PHASES_COUNT; phase++) {
+        fprintf(stream, "%-10s %12llu", NAMES[phase], (unsigned long long) gCounts[phase]);
+        for (size_t i = 0; i < sizeof(PERCENTILES) / sizeof(PERCENTILES[0]); i++) {
+            const uint64_t value = Logger_Histogram_getPercentile((Logger_Histogram_Phase_T) phase, PERCENTILES[i]);
+            fprintf(stream, " %10llu", (unsigned long long) value);
+        }
+        fprintf(stream, "\n");
+    }
+}
+
+void _Logger_Histogram_addIoTicks(uint64_t ticks) {
+    gIoTicks += ticks;
+}
+
+uint64_t _Logger_Histogram_takeIoTicks(void) {
+    const uint64_t ticks = gIoTicks;
+    gIoTicks = 0;
+    return ticks;
+}
@@ -0,0 +1,116 @@
+/*
+ * C Header File
+ *
+ * Author: daddinuz
+ * email:  daddinuz@gmail.com
+ * Date:   October 19, 2026
+ */
+
+#ifndef LOGGER_LOGGER_HISTOGRAM_INCLUDED
+#define LOGGER_LOGGER_HISTOGRAM_INCLUDED
+
+#include <stdio.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Latency histograms of the logging path.
+ *
+ * When the library is built with LOGGER_HISTOGRAM defined (cmake -DLOGGER_HISTOGRAM=ON) _Logger_log
+ * records the time spent in each phase of every logging request; otherwise the histograms stay empty.
+ * Times are taken with the time stamp counter where available and converted to nanoseconds when read.
+ * Values are kept in log-linear buckets: 2^LOGGER_HISTOGRAM_SUB_BUCKET_BITS buckets for every power of two,
+ * so reported values are within 1 / 2^LOGGER_HISTOGRAM_SUB_BUCKET_BITS of the recorded ones.
+ * If the LOGGER_HISTOGRAM_DUMP environment variable is set the histograms are dumped to stderr at exit.
+ */
+#ifndef LOGGER_HISTOGRAM_SUB_BUCKET_BITS
+#define LOGGER_HISTOGRAM_SUB_BUCKET_BITS 5
+#endif
+
+/**
+ * Logger_Histogram_Phase_T identifies the phases of a logging request:
+ *  - LOGGER_HISTOGRAM_PHASE_FORMAT: building the message and the record.
+ *  - LOGGER_HISTOGRAM_PHASE_DISPATCH: filtering and handing the record to the handlers.
+ *  - LOGGER_HISTOGRAM_PHASE_IO: inside the handlers publish callbacks (record formatting and writing).
+ *  - LOGGER_HISTOGRAM_PHASE_TOTAL: the whole request.
+ */
+typedef enum Logger_Histogram_Phase_T {
+    LOGGER_HISTOGRAM_PHASE_FORMAT = 0,
+    LOGGER_HISTOGRAM_PHASE_DISPATCH,
+    LOGGER_HISTOGRAM_PHASE_IO,
+    LOGGER_HISTOGRAM_PHASE_TOTAL,
+    LOGGER_HISTOGRAM_PHASES_COUNT,
+} Logger_Histogram_Phase_T;
+
+/**
+ * Read the clock used by the histograms.
+ *
+ * @return The current time in ticks of an unspecified unit.
+ */
+extern uint64_t Logger_Histogram_getTicks(void);
+
+/**
+ * Record a duration.
+ *
+ * Checked runtime errors:
+ *  - @param phase must be in range LOGGER_HISTOGRAM_PHASE_FORMAT - LOGGER_HISTOGRAM_PHASE_TOTAL.
+ *
+ * @param phase The phase the duration belongs to.
+ * @param ticks The duration measured as a difference of Logger_Histogram_getTicks values.
+ */
+extern void Logger_Histogram_record(Logger_Histogram_Phase_T phase, uint64_t ticks);
+
+/**
+ * Get the number of durations recorded.
+ *
+ * Checked runtime errors:
+ *  - @param phase must be in range LOGGER_HISTOGRAM_PHASE_FORMAT - LOGGER_HISTOGRAM_PHASE_TOTAL.
+ *
+ * @param phase The phase.
+ * @return The number of recorded durations.
+ */
+extern uint64_t Logger_Histogram_getCount(Logger_Histogram_Phase_T phase);
+
+/**
+ * Get the value below which the given percentage of the recorded durations fall.
+ *
+ * Checked runtime errors:
+ *  - @param phase must be in range LOGGER_HISTOGRAM_PHASE_FORMAT - LOGGER_HISTOGRAM_PHASE_TOTAL.
+ *  - @param percentile must be in range 0 - 100.
+ *
+ * @param phase The phase.
+ * @param percentile The percentile, e.g. 99.9.
+ * @return The duration in nanoseconds or 0 if nothing was recorded.
+ */
+extern uint64_t Logger_Histogram_getPercentile(Logger_Histogram_Phase_T phase, double percentile);
+
+/**
+ * Discard all the recorded durations.
+ */
+extern void Logger_Histogram_reset(void);
+
+/**
+ * Write count and percentiles of every phase in a human readable form.
+ *
+ * Checked runtime errors:
+ *  - @param stream must not be NULL.
+ *
+ * @param stream The stream to write to.
+ */
+extern void Logger_Histogram_dump(FILE *stream);
+
+/*
+ * Used by the handlers to account the time spent in publish callbacks by the current thread,
+ * taken back by _Logger_log to split the I/O phase from the dispatch one.
+ */
+extern void _Logger_Histogram_addIoTicks(uint64_t ticks);
+extern uint64_t _Logger_Histogram_takeIoTicks(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LOGGER_LOGGER_HISTOGRAM_INCLUDED */
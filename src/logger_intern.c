@@ -0,0 +1,101 @@
+/*
+ * C Source File
+ *
+ * Author: daddinuz
+ * email:  daddinuz@gmail.com
+ * Date:   October 19, 2026
+ */
+
+#include <assert.h>
+#include <string.h>
+#include <stdbool.h>
+#include "logger_alloc.h"
+#include "logger_intern.h"
+
+/*
+ * Open addressing table with linear probing, kept at most half full.
+ * A slot is claimed by CAS on its key, a copy of the string made beforehand; the id is published afterwards,
+ * so a reader that finds the key before its id waits for the (few instructions away) publication.
+ * Slots and their copies are never freed.
+ */
+#define LOGGER_INTERN_SLOTS (2 * LOGGER_INTERN_CAPACITY)
+#define LOGGER_INTERN_PENDING 0
+
+static const char *gKeys[LOGGER_INTERN_SLOTS];
+static uint32_t gIds[LOGGER_INTERN_SLOTS]; /* id + 1, LOGGER_INTERN_PENDING while being assigned */
+static const char *gStrings[LOGGER_INTERN_CAPACITY];
+static uint32_t gSize = 0;
+
+static size_t hash(const char *str, size_t length) {
+    uint64_t h = UINT64_C(14695981039346656037); /* FNV-1a */
+    for (size_t i = 0; i < length; i++) {
+        h = (h ^ (unsigned char) str[i]) * UINT64_C(1099511628211);
+    }
+    h ^= h >> 33;
+    return (size_t) h & (LOGGER_INTERN_SLOTS - 1);
+}
+
+static uint32_t waitForId(size_t slot) {
+    uint32_t id;
+    while (LOGGER_INTERN_PENDING == (id = __atomic_load_n(&gIds[slot], __ATOMIC_ACQUIRE))) {
+        /* the owner of the slot is assigning the id */
+    }
+    return LOGGER_INTERN_NO_ID == id ? LOGGER_INTERN_NO_ID : id - 1;
+}
+
+static uint32_t found(size_t slot, char *copy) {
+    Logger_Alloc_free(copy);
+    return waitForId(slot);
+}
+
+uint32_t Logger_Intern_getId(const char *str) {
+    assert(str);
+    const size_t length = strlen(str);
+    char *copy = NULL;
+    size_t slot = hash(str, length);
+    for (size_t probes = 0; probes < LOGGER_INTERN_SLOTS; probes++, slot = (slot + 1) & (LOGGER_INTERN_SLOTS - 1)) {
+        const char *key = __atomic_load_n(&gKeys[slot], __ATOMIC_ACQUIRE);
+        if (key && 0 == strcmp(key, str)) {
+            return found(slot, copy);
+        }
+        if (key) {
+            continue;
+        }
+        if (__atomic_load_n(&gSize, __ATOMIC_RELAXED) >= LOGGER_INTERN_CAPACITY) {
+            break;
+        }
+        if (!copy) {
+            copy = Logger_Alloc_malloc(length + 1);
+            if (!copy) {
+                return LOGGER_INTERN_NO_ID;
+            }
+            memcpy(copy, str, length + 1);
+        }
+        if (!__atomic_compare_exchange_n(&gKeys[slot], &key, copy, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+            if (0 == strcmp(key, str)) {
+                return found(slot, copy);
+            }
+            continue;
+        }
+        const uint32_t id = __atomic_fetch_add(&gSize, 1, __ATOMIC_RELAXED);
+        if (id >= LOGGER_INTERN_CAPACITY) {
+            /* lost the race for the last id: the slot stays claimed but maps to nothing */
+            __atomic_store_n(&gIds[slot], LOGGER_INTERN_NO_ID, __ATOMIC_RELEASE);
+            return LOGGER_INTERN_NO_ID;
+        }
+        __atomic_store_n(&gStrings[id], copy, __ATOMIC_RELEASE);
+        __atomic_store_n(&gIds[slot], id + 1, __ATOMIC_RELEASE);
+        return id;
+    }
+    Logger_Alloc_free(copy);
+    return LOGGER_INTERN_NO_ID;
+}
+
+const char *Logger_Intern_getString(uint32_t id) {
+    return id < LOGGER_INTERN_CAPACITY ? __atomic_load_n(&gStrings[id], __ATOMIC_ACQUIRE) : NULL;
+}
+
+size_t Logger_Intern_getSize(void) {
+    const uint32_t size = __atomic_load_n(&gSize, __ATOMIC_RELAXED);
+    return size < LOGGER_INTERN_CAPACITY ? size : LOGGER_INTERN_CAPACITY;
+}
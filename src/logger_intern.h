@@ -0,0 +1,65 @@
+/*
+ * C Header File
+ *
+ * Author: daddinuz
+ * email:  daddinuz@gmail.com
+ * Date:   October 19, 2026
+ */
+
+#ifndef LOGGER_LOGGER_INTERN_INCLUDED
+#define LOGGER_LOGGER_INTERN_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * The maximum number of strings that can be interned, it can be overridden at compile time.
+ */
+#ifndef LOGGER_INTERN_CAPACITY
+#define LOGGER_INTERN_CAPACITY 16384
+#endif
+
+/**
+ * The id returned when the interning table is full.
+ */
+#define LOGGER_INTERN_NO_ID UINT32_MAX
+
+/**
+ * Get the id of a string, assigning the next free one on first sight.
+ * Strings are keyed by content and copied on first sight, so a string freed after the call and one allocated
+ * at its address later never share an id unless they are equal.
+ * Ids are dense and start from 0, lookups of strings already interned never lock nor allocate.
+ *
+ * Checked runtime errors:
+ *  - @param str must not be NULL.
+ *  - If the table is full or out of memory this function will return LOGGER_INTERN_NO_ID.
+ *
+ * @param str The string to be interned.
+ * @return The id of the string or LOGGER_INTERN_NO_ID.
+ */
+extern uint32_t Logger_Intern_getId(const char *str);
+
+/**
+ * Get the string associated to an id.
+ *
+ * @param id The id returned by Logger_Intern_getId.
+ * @return The copy of the string associated to the id or NULL if no string has that id.
+ */
+extern const char *Logger_Intern_getString(uint32_t id);
+
+/**
+ * Get the number of strings interned so far.
+ *
+ * @return The number of strings interned.
+ */
+extern size_t Logger_Intern_getSize(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LOGGER_LOGGER_INTERN_INCLUDED */
@@ -7,6 +7,7 @@
  */
 
 #include <assert.h>
+#include <strings.h>
 #include <stdbool.h>
 #include "logger_level.h"
 
@@ -35,3 +36,15 @@ const char *Logger_Level_getName(Logger_Level_T level) {
             assert(false);
     };
 }
+
+bool Logger_Level_fromName(const char *name, Logger_Level_T *level) {
+    assert(name);
+    assert(level);
+    for (Logger_Level_T candidate = LOGGER_LEVEL_DEBUG; candidate <= LOGGER_LEVEL_FATAL; candidate++) {
+        if (0 == strcasecmp(name, Logger_Level_getName(candidate))) {
+            *level = candidate;
+            return true;
+        }
+    }
+    return false;
+}
@@ -9,6 +9,8 @@
 #ifndef LOGGER_LOGGER_LEVEL_INCLUDED
 #define LOGGER_LOGGER_LEVEL_INCLUDED
 
+#include <stdbool.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -38,6 +40,19 @@ typedef enum Logger_Level_T {
  */
 extern const char *Logger_Level_getName(Logger_Level_T level);
 
+/**
+ * Get the Logger_Level_T from its string representation, ignoring case.
+ *
+ * Checked runtime errors:
+ *  - @param name must not be NULL.
+ *  - @param level must not be NULL.
+ *
+ * @param name The string representation of the level.
+ * @param level Where to store the level.
+ * @return true if name is the representation of a level, false otherwise and level is left untouched.
+ */
+extern bool Logger_Level_fromName(const char *name, Logger_Level_T *level);
+
 #ifdef __cplusplus
 }
 #endif
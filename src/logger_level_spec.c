@@ -0,0 +1,256 @@
+/*
+ * C Source File
+ *
+ * Author: daddinuz
+ * email:  daddinuz@gmail.com
+ * Date:   October 19, 2026
+ */
+
+#include <assert.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include "logger_alloc.h"
+#include "logger_level_spec.h"
+
+/*
+ * Node 0 is the root of the trie, the empty prefix, so 0 also marks a missing child or sibling.
+ * Levels are stored as signed chars, LEVEL_NONE if the node ends no pattern of that kind.
+ */
+#define NODE_NONE 0
+#define LEVEL_NONE (-1)
+
+typedef struct node {
+    uint32_t child;
+    uint32_t sibling;
+    unsigned char byte;
+    signed char exact;
+    signed char prefix;
+} node;
+
+struct Logger_LevelSpec_T {
+    node *nodes;
+    size_t size;
+    size_t capacity;
+};
+
+static bool isBlank(char c) {
+    return ' ' == c || '\t' == c;
+}
+
+/*
+ * Trim [*begin, *end) in place.
+ */
+static void trim(const char **begin, const char **end) {
+    while (*begin < *end && isBlank(**begin)) {
+        (*begin)++;
+    }
+    while (*end > *begin && isBlank(*(*end - 1))) {
+        (*end)--;
+    }
+}
+
+static uint32_t findChild(const struct Logger_LevelSpec_T *self, uint32_t parent, unsigned char byte) {
+    for (uint32_t child = self->nodes[parent].child; NODE_NONE != child; child = self->nodes[child].sibling) {
+        if (self->nodes[child].byte == byte) {
+            return child;
+        }
+    }
+    return NODE_NONE;
+}
+
+static uint32_t appendChild(Logger_LevelSpec_T self, uint32_t parent, unsigned char byte) {
+    if (self->size >= UINT32_MAX) {
+        return NODE_NONE;
+    }
+    if (self->size == self->capacity) {
+        const size_t capacity = self->capacity * 2;
+        node *nodes = Logger_Alloc_realloc(self->nodes, capacity * sizeof(nodes[0]));
+        if (!nodes) {
+            return NODE_NONE;
+        }
+        self->nodes = nodes;
+        self->capacity = capacity;
+    }
+    const uint32_t index = (uint32_t) self->size++;
+    self->nodes[index] = (node) {
+            .child=NODE_NONE, .sibling=self->nodes[parent].child, .byte=byte, .exact=LEVEL_NONE, .prefix=LEVEL_NONE
+    };
+    self->nodes[parent].child = index;
+    return index;
+}
+
+/*
+ * Parse one `pattern=LEVEL` entry and insert it.
+ */
+static Logger_Err_T insertEntry(Logger_LevelSpec_T self, const char *begin, const char *end) {
+    const char *separator = memchr(begin, '=', (size_t) (end - begin));
+    if (!separator) {
+        return LOGGER_ERR_INVALID_CONFIG;
+    }
+
+    char levelName[16];
+    const char *levelBegin = separator + 1;
+    const char *levelEnd = end;
+    Logger_Level_T level;
+    trim(&levelBegin, &levelEnd);
+    if ((size_t) (levelEnd - levelBegin) >= sizeof(levelName)) {
+        return LOGGER_ERR_INVALID_CONFIG;
+    }
+    memcpy(levelName, levelBegin, (size_t) (levelEnd - levelBegin));
+    levelName[levelEnd - levelBegin] = '\0';
+    if (!Logger_Level_fromName(levelName, &level)) {
+        return LOGGER_ERR_INVALID_CONFIG;
+    }
+
+    const char *patternBegin = begin;
+    const char *patternEnd = separator;
+    trim(&patternBegin, &patternEnd);
+    const bool isPrefix = patternEnd > patternBegin && '*' == *(patternEnd - 1);
+    if (isPrefix) {
+        patternEnd--;
+    }
+    uint32_t current = 0;
+    for (const char *p = patternBegin; p < patternEnd; p++) {
+        if ('*' == *p) {
+            return LOGGER_ERR_INVALID_CONFIG;
+        }
+        uint32_t next = findChild(self, current, (unsigned char) *p);
+        if (NODE_NONE == next) {
+            next = appendChild(self, current, (unsigned char) *p);
+            if (NODE_NONE == next) {
+                return LOGGER_ERR_OUT_OF_MEMORY;
+            }
+        }
+        current = next;
+    }
+    if (isPrefix) {
+        self->nodes[current].prefix = (signed char) level;
+    } else {
+        self->nodes[current].exact = (signed char) level;
+    }
+    return LOGGER_ERR_OK;
+}
+
+Logger_LevelSpec_Result_T Logger_LevelSpec_new(const char *text) {
+    assert(text);
+    Logger_LevelSpec_T self = Logger_Alloc_malloc(sizeof(*self));
+    if (!self) {
+        return (Logger_LevelSpec_Result_T) {.err=LOGGER_ERR_OUT_OF_MEMORY, .spec=NULL};
+    }
+    self->capacity = 16;
+    self->size = 1;
+    self->nodes = Logger_Alloc_malloc(self->capacity * sizeof(self->nodes[0]));
+    if (!self->nodes) {
+        Logger_Alloc_free(self);
+        return (Logger_LevelSpec_Result_T) {.err=LOGGER_ERR_OUT_OF_MEMORY, .spec=NULL};
+    }
+    self->nodes[0] = (node) {.child=NODE_NONE, .sibling=NODE_NONE, .byte=0, .exact=LEVEL_NONE, .prefix=LEVEL_NONE};
+
+    Logger_Err_T err = LOGGER_ERR_OK;
+    for (const char *begin = text; LOGGER_ERR_OK == err && '\0' != *begin;) {
+        const char *end = strchr(begin, ',');
+        end = end ? end : begin + strlen(begin);
+        const char *entryBegin = begin;
+        const char *entryEnd = end;
+        trim(&entryBegin, &entryEnd);
+        if (entryBegin < entryEnd) {  /* empty entries are allowed, e.g. a trailing comma */
+            err = insertEntry(self, entryBegin, entryEnd);
+        }
+        begin = '\0' == *end ? end : end + 1;
+    }
+    if (LOGGER_ERR_OK != err) {
+        Logger_LevelSpec_delete(&self);
+        return (Logger_LevelSpec_Result_T) {.err=err, .spec=NULL};
+    }
+    return (Logger_LevelSpec_Result_T) {.err=LOGGER_ERR_OK, .spec=self};
+}
+
+void Logger_LevelSpec_delete(Logger_LevelSpec_T *ref) {
+    assert(ref);
+    assert(*ref);
+    Logger_LevelSpec_T self = *ref;
+    Logger_Alloc_free(self->nodes);
+    Logger_Alloc_free(self);
+    *ref = NULL;
+}
+
+/*
+ * Find the level of name, return LEVEL_NONE if no pattern matches it.
+ * *length is set to the length of the matching prefix pattern, SIZE_MAX for an exact match.
+ */
+static signed char find(Logger_LevelSpec_T self, const char *name, size_t *length) {
+    uint32_t current = 0;
+    signed char found = self->nodes[0].prefix;
+    const char *p = name;
+    *length = 0;
+    for (uint32_t next; '\0' != *p && NODE_NONE != (next = findChild(self, current, (unsigned char) *p)); p++) {
+        current = next;
+        if (LEVEL_NONE != self->nodes[current].prefix) {
+            found = self->nodes[current].prefix;
+            *length = (size_t) (p - name) + 1;
+        }
+    }
+    if ('\0' == *p && LEVEL_NONE != self->nodes[current].exact) {
+        found = self->nodes[current].exact;
+        *length = SIZE_MAX;
+    }
+    return found;
+}
+
+bool Logger_LevelSpec_match(Logger_LevelSpec_T self, const char *name, Logger_Level_T *level) {
+    assert(self);
+    assert(name);
+    assert(level);
+    size_t length;
+    const signed char found = find(self, name, &length);
+    if (LEVEL_NONE == found) {
+        return false;
+    }
+    *level = (Logger_Level_T) found;
+    return true;
+}
+
+bool Logger_LevelSpec_matchBeyond(
+        Logger_LevelSpec_T self, const char *name, size_t prefixLength, Logger_Level_T *level
+) {
+    assert(self);
+    assert(name);
+    assert(level);
+    size_t length;
+    const signed char found = find(self, name, &length);
+    if (LEVEL_NONE == found || length <= prefixLength) {
+        return false;
+    }
+    *level = (Logger_Level_T) found;
+    return true;
+}
+
+/*
+ * Environment
+ */
+static pthread_once_t gEnvironmentOnce = PTHREAD_ONCE_INIT;
+static Logger_LevelSpec_T gEnvironment = NULL;
+
+static void parseEnvironment(void) {
+    const char *text = getenv(LOGGER_LEVEL_SPEC_VARIABLE);
+    if (text) {
+        gEnvironment = Logger_LevelSpec_new(text).spec;
+    }
+}
+
+Logger_LevelSpec_T Logger_LevelSpec_getEnvironment(void) {
+    pthread_once(&gEnvironmentOnce, parseEnvironment);
+    return gEnvironment;
+}
+
+Logger_Level_T Logger_LevelSpec_resolve(const char *name, Logger_Level_T level) {
+    assert(name);
+    assert(LOGGER_LEVEL_DEBUG <= level && level <= LOGGER_LEVEL_FATAL);
+    Logger_LevelSpec_T spec = Logger_LevelSpec_getEnvironment();
+    if (spec) {
+        Logger_LevelSpec_match(spec, name, &level);
+    }
+    return level;
+}
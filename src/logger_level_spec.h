@@ -0,0 +1,131 @@
+/*
+ * C Header File
+ *
+ * Author: daddinuz
+ * email:  daddinuz@gmail.com
+ * Date:   October 19, 2026
+ */
+
+#ifndef LOGGER_LOGGER_LEVEL_SPEC_INCLUDED
+#define LOGGER_LOGGER_LEVEL_SPEC_INCLUDED
+
+#include <stdbool.h>
+#include "logger_err.h"
+#include "logger_level.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * The environment variable read by Logger_LevelSpec_resolve.
+ */
+#define LOGGER_LEVEL_SPEC_VARIABLE "LOGGER_LEVELS"
+
+/**
+ * Logger_LevelSpec_T maps logger names to levels, e.g. "db=DEBUG, net.*=WARNING, *=INFO".
+ * Entries are comma separated `pattern=LEVEL` pairs, levels are matched ignoring case.
+ * A pattern ending with '*' matches every name starting with what precedes it, any other pattern
+ * matches that name only. An exact match wins over the patterns ending with '*', among which the
+ * longest one wins; when a pattern is repeated its last entry wins.
+ * Patterns are kept in a prefix trie stored in a single array, so a lookup costs one walk over the name.
+ */
+#ifdef __cplusplus
+typedef struct Logger_LevelSpec_C *Logger_LevelSpec_T;
+#else
+typedef struct Logger_LevelSpec_T *Logger_LevelSpec_T;
+#endif
+
+typedef struct Logger_LevelSpec_Result_T {
+    Logger_Err_T err;
+    Logger_LevelSpec_T spec;
+} Logger_LevelSpec_Result_T;
+
+/**
+ * Construct a Logger_LevelSpec_T parsing its textual representation.
+ *
+ * Checked runtime errors:
+ *  - @param text must not be NULL.
+ *  - In case of errors this function will set Logger_LevelSpec_Result_T.err to the error value,
+ *    `LOGGER_ERR_INVALID_CONFIG` if text is malformed.
+ *
+ * @param text The textual representation, it is not retained.
+ * @return A Logger_LevelSpec_Result_T wrapper. If no err occurred spec will be the new instance of a Logger_LevelSpec_T.
+ */
+extern Logger_LevelSpec_Result_T Logger_LevelSpec_new(const char *text);
+
+/**
+ * Destruct a Logger_LevelSpec_T.
+ *
+ * Checked runtime errors:
+ *  - @param ref must be a valid reference to a Logger_LevelSpec_T instance.
+ *
+ * @param ref The reference to the Logger_LevelSpec_T instance.
+ */
+extern void Logger_LevelSpec_delete(Logger_LevelSpec_T *ref);
+
+/**
+ * Find the level of a logger name.
+ *
+ * Checked runtime errors:
+ *  - @param self must not be NULL.
+ *  - @param name must not be NULL.
+ *  - @param level must not be NULL.
+ *
+ * @param self The Logger_LevelSpec_T instance.
+ * @param name The logger name.
+ * @param level Where to store the level.
+ * @return true if a pattern matches name, false otherwise and level is left untouched.
+ */
+extern bool Logger_LevelSpec_match(Logger_LevelSpec_T self, const char *name, Logger_Level_T *level);
+
+/**
+ * Find the level of a logger name, only if the pattern matching it does not match its first prefixLength
+ * bytes as well: an exact match or a pattern ending with '*' longer than prefixLength.
+ * Registered loggers use it to take a level of their own only when their parent is not matched by the same
+ * pattern, so that "db=DEBUG, *=INFO" leaves "db.pool" inheriting from "db".
+ *
+ * Checked runtime errors:
+ *  - @param self must not be NULL.
+ *  - @param name must not be NULL.
+ *  - @param level must not be NULL.
+ *
+ * @param self The Logger_LevelSpec_T instance.
+ * @param name The logger name.
+ * @param prefixLength The length of the prefix of name, e.g. the name of the parent logger.
+ * @param level Where to store the level.
+ * @return true if a pattern more specific than the prefix matches name, false otherwise and level is left untouched.
+ */
+extern bool Logger_LevelSpec_matchBeyond(
+        Logger_LevelSpec_T self, const char *name, size_t prefixLength, Logger_Level_T *level
+);
+
+/**
+ * Get the Logger_LevelSpec_T parsed from LOGGER_LEVEL_SPEC_VARIABLE.
+ * The variable is parsed once, the first time this function is called (at the latest when the first logger
+ * is created); if it is malformed it is ignored altogether. The instance lives as long as the process.
+ *
+ * @return The Logger_LevelSpec_T instance or NULL if the variable is missing, malformed or on OOM.
+ */
+extern Logger_LevelSpec_T Logger_LevelSpec_getEnvironment(void);
+
+/**
+ * Get the level a logger is created with: the one LOGGER_LEVEL_SPEC_VARIABLE gives to name, or level if none.
+ * Logger_new, Logger_get and the constructors of logger_builtin_loggers.h go through the environment
+ * spec, logging calls never do.
+ *
+ * Checked runtime errors:
+ *  - @param name must not be NULL.
+ *  - @param level must be in range LOGGER_LEVEL_DEBUG - LOGGER_LEVEL_FATAL.
+ *
+ * @param name The logger name.
+ * @param level The level to be used when the variable does not match name.
+ * @return The resolved level.
+ */
+extern Logger_Level_T Logger_LevelSpec_resolve(const char *name, Logger_Level_T level);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LOGGER_LOGGER_LEVEL_SPEC_INCLUDED */
@@ -0,0 +1,142 @@
+/*
+ * C Source File
+ *
+ * Author: daddinuz
+ * email:  daddinuz@gmail.com
+ * Date:   October 19, 2026
+ */
+
+#include <string.h>
+#include <assert.h>
+#include <pthread.h>
+#include "logger_alloc.h"
+#include "logger_mdc.h"
+
+/*
+ * A snapshot holds the entries of its parent followed by the new one, so readers never walk the chain;
+ * the strings of the new entry live in the same allocation, right after the entries, while the others
+ * belong to the ancestors the snapshot keeps alive through parent.
+ */
+struct Logger_Mdc_T {
+    size_t references;
+    Logger_Mdc_T parent;
+    size_t size;
+    Logger_Mdc_Entry_T entries[];
+};
+
+static pthread_key_t gMdcKey;
+static pthread_once_t gMdcOnce = PTHREAD_ONCE_INIT;
+static __thread Logger_Mdc_T gCurrent = NULL;
+
+static void mdcDestructor(void *current) {
+    Logger_Mdc_T snapshot = current;
+    Logger_Mdc_release(&snapshot);
+    gCurrent = NULL;  /* records logged by a later TLS destructor on this thread carry no context */
+}
+
+static void mdcInitialize(void) {
+    pthread_key_create(&gMdcKey, mdcDestructor);
+}
+
+/*
+ * Take ownership of snapshot as the context of the calling thread.
+ */
+static void setCurrent(Logger_Mdc_T snapshot) {
+    Logger_Mdc_T previous = gCurrent;
+    pthread_once(&gMdcOnce, mdcInitialize);
+    gCurrent = snapshot;
+    pthread_setspecific(gMdcKey, snapshot);
+    if (previous) {
+        Logger_Mdc_release(&previous);
+    }
+}
+
+Logger_Err_T Logger_Mdc_push(const char *key, const char *value) {
+    assert(key);
+    assert(value);
+    Logger_Mdc_T parent = gCurrent;
+    const size_t parentSize = parent ? parent->size : 0;
+    size_t index = parentSize;
+    for (size_t i = 0; i < parentSize; i++) {
+        if (0 == strcmp(key, parent->entries[i].key)) {
+            index = i;
+            break;
+        }
+    }
+
+    const size_t size = index < parentSize ? parentSize : parentSize + 1;
+    const size_t keySize = strlen(key) + 1, valueSize = strlen(value) + 1;
+    Logger_Mdc_T self = Logger_Alloc_malloc(sizeof(*self) + size * sizeof(self->entries[0]) + keySize + valueSize);
+    if (!self) {
+        return LOGGER_ERR_OUT_OF_MEMORY;
+    }
+    char *strings = (char *) (self->entries + size);
+    memcpy(strings, key, keySize);
+    memcpy(strings + keySize, value, valueSize);
+    if (parentSize > 0) {
+        memcpy(self->entries, parent->entries, parentSize * sizeof(self->entries[0]));
+    }
+    self->entries[index].key = strings;
+    self->entries[index].value = strings + keySize;
+    self->references = 1;
+    self->parent = parent ? Logger_Mdc_retain(parent) : NULL;
+    self->size = size;
+    setCurrent(self);
+    return LOGGER_ERR_OK;
+}
+
+void Logger_Mdc_pop(void) {
+    assert(gCurrent);
+    setCurrent(gCurrent->parent ? Logger_Mdc_retain(gCurrent->parent) : NULL);
+}
+
+void Logger_Mdc_clear(void) {
+    setCurrent(NULL);
+}
+
+Logger_Mdc_T Logger_Mdc_current(void) {
+    return gCurrent;
+}
+
+void Logger_Mdc_set(Logger_Mdc_T snapshot) {
+    setCurrent(snapshot ? Logger_Mdc_retain(snapshot) : NULL);
+}
+
+Logger_Mdc_T Logger_Mdc_retain(Logger_Mdc_T self) {
+    assert(self);
+    __atomic_fetch_add(&self->references, 1, __ATOMIC_RELAXED);
+    return self;
+}
+
+void Logger_Mdc_release(Logger_Mdc_T *ref) {
+    assert(ref);
+    assert(*ref);
+    Logger_Mdc_T self = *ref;
+    *ref = NULL;
+    while (self && 1 == __atomic_fetch_sub(&self->references, 1, __ATOMIC_ACQ_REL)) {
+        Logger_Mdc_T parent = self->parent;
+        Logger_Alloc_free(self);
+        self = parent;  /* the reference the snapshot held on its parent, without recursion */
+    }
+}
+
+size_t Logger_Mdc_getSize(Logger_Mdc_T self) {
+    assert(self);
+    return self->size;
+}
+
+const Logger_Mdc_Entry_T *Logger_Mdc_getEntries(Logger_Mdc_T self) {
+    assert(self);
+    return self->entries;
+}
+
+const char *Logger_Mdc_get(Logger_Mdc_T self, const char *key) {
+    assert(self);
+    assert(key);
+    for (size_t i = 0; i < self->size; i++) {
+        if (0 == strcmp(key, self->entries[i].key)) {
+            return self->entries[i].value;
+        }
+    }
+    return NULL;
+}
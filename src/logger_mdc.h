@@ -0,0 +1,143 @@
+/*
+ * C Header File
+ *
+ * Author: daddinuz
+ * email:  daddinuz@gmail.com
+ * Date:   October 19, 2026
+ */
+
+#ifndef LOGGER_LOGGER_MDC_INCLUDED
+#define LOGGER_LOGGER_MDC_INCLUDED
+
+#include <stddef.h>
+#include "logger_err.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Logger_Mdc_T is an immutable, reference counted snapshot of the mapped diagnostic context of a thread:
+ * the key/value pairs (request id, tenant, trace id...) pushed around a unit of work.
+ *
+ * Every thread has its own current snapshot: pushing builds a new snapshot on top of it, popping goes back
+ * to the previous one. _Logger_log attaches the current snapshot to each record by copying a single pointer,
+ * handlers that keep it after publishing the record must retain it.
+ * Entries are kept in push order; pushing a key already present replaces its value in the new snapshot.
+ */
+#ifdef __cplusplus
+typedef struct Logger_Mdc_C *Logger_Mdc_T;
+#else
+typedef struct Logger_Mdc_T *Logger_Mdc_T;
+#endif
+
+/**
+ * Logger_Mdc_Entry_T is a key/value pair of a Logger_Mdc_T.
+ */
+typedef struct Logger_Mdc_Entry_T {
+    const char *key;
+    const char *value;
+} Logger_Mdc_Entry_T;
+
+/**
+ * Push a key/value pair on the context of the calling thread, both strings are copied.
+ *
+ * Checked runtime errors:
+ *  - @param key must not be NULL.
+ *  - @param value must not be NULL.
+ *
+ * @param key The key.
+ * @param value The value.
+ * @return `LOGGER_ERR_OK` or `LOGGER_ERR_OUT_OF_MEMORY`, in which case the context is left unchanged.
+ */
+extern Logger_Err_T Logger_Mdc_push(const char *key, const char *value);
+
+/**
+ * Go back to the context the calling thread had before the last push.
+ *
+ * Checked runtime errors:
+ *  - The context of the calling thread must not be empty.
+ */
+extern void Logger_Mdc_pop(void);
+
+/**
+ * Empty the context of the calling thread.
+ */
+extern void Logger_Mdc_clear(void);
+
+/**
+ * Get the current snapshot of the context of the calling thread.
+ *
+ * @return The snapshot, owned by the thread, or NULL if the context is empty.
+ */
+extern Logger_Mdc_T Logger_Mdc_current(void);
+
+/**
+ * Replace the context of the calling thread with a snapshot, usually taken by another thread
+ * to hand over the context along with a unit of work.
+ *
+ * @param snapshot The snapshot, it is retained; NULL empties the context.
+ */
+extern void Logger_Mdc_set(Logger_Mdc_T snapshot);
+
+/**
+ * Take a reference to a snapshot.
+ *
+ * Checked runtime errors:
+ *  - @param self must not be NULL.
+ *
+ * @param self The Logger_Mdc_T instance.
+ * @return The same instance.
+ */
+extern Logger_Mdc_T Logger_Mdc_retain(Logger_Mdc_T self);
+
+/**
+ * Drop a reference to a snapshot, destructing it along with the last one.
+ *
+ * Checked runtime errors:
+ *  - @param ref must be a valid reference to a Logger_Mdc_T instance.
+ *
+ * @param ref The reference to the Logger_Mdc_T instance.
+ */
+extern void Logger_Mdc_release(Logger_Mdc_T *ref);
+
+/**
+ * Get the number of entries of a snapshot.
+ *
+ * Checked runtime errors:
+ *  - @param self must not be NULL.
+ *
+ * @param self The Logger_Mdc_T instance.
+ * @return The number of entries.
+ */
+extern size_t Logger_Mdc_getSize(Logger_Mdc_T self);
+
+/**
+ * Get the entries of a snapshot.
+ *
+ * Checked runtime errors:
+ *  - @param self must not be NULL.
+ *
+ * @param self The Logger_Mdc_T instance.
+ * @return The entries in push order, valid as long as the snapshot is.
+ */
+extern const Logger_Mdc_Entry_T *Logger_Mdc_getEntries(Logger_Mdc_T self);
+
+/**
+ * Get the value of a key in a snapshot.
+ *
+ * Checked runtime errors:
+ *  - @param self must not be NULL.
+ *  - @param key must not be NULL.
+ *
+ * @param self The Logger_Mdc_T instance.
+ * @param key The key.
+ * @return The value or NULL if the key is missing.
+ */
+extern const char *Logger_Mdc_get(Logger_Mdc_T self, const char *key);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LOGGER_LOGGER_MDC_INCLUDED */
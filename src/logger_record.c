@@ -8,6 +8,8 @@
 
 #include <stdlib.h>
 #include <assert.h>
+#include "logger_alloc.h"
+#include "logger_arena.h"
 #include "logger_record.h"
 
 struct Logger_Record_T {
@@ -15,38 +17,69 @@ struct Logger_Record_T {
     const char *loggerName;
     const char *function;
     const char *file;
+    const Logger_CallSite_T *callSite;
+    const Logger_Field_T *fields;
+    size_t fieldsCount;
+    Logger_Mdc_T mdc;
     size_t line;
+    size_t suppressed;
     time_t timestamp;
     Logger_Level_T level;
 };
 
-Logger_Record_T Logger_Record_new(
-        const char *loggerName, Logger_Level_T level, const char *file, size_t line, const char *function,
-        time_t timestamp, Logger_String_T message
+static Logger_Record_T initialize(
+        Logger_Record_T self, const char *loggerName, Logger_Level_T level, const char *file, size_t line,
+        const char *function, time_t timestamp, Logger_String_T message
 ) {
     assert(message);
     assert(loggerName);
     assert(function);
     assert(file);
     assert(LOGGER_LEVEL_DEBUG <= level && level <= LOGGER_LEVEL_FATAL);
-    Logger_Record_T self = malloc(sizeof(*self));
     if (self) {
         self->message = message;
         self->loggerName = loggerName;
         self->function = function;
         self->file = file;
+        self->callSite = NULL;
+        self->fields = NULL;
+        self->fieldsCount = 0;
+        self->mdc = NULL;
         self->line = line;
+        self->suppressed = 0;
         self->timestamp = timestamp;
         self->level = level;
     }
     return self;
 }
 
+Logger_Record_T Logger_Record_new(
+        const char *loggerName, Logger_Level_T level, const char *file, size_t line, const char *function,
+        time_t timestamp, Logger_String_T message
+) {
+    assert(message);
+    return initialize(
+            Logger_Alloc_malloc(sizeof(struct Logger_Record_T)), loggerName, level, file, line, function, timestamp,
+            message
+    );
+}
+
+Logger_Record_T _Logger_Record_newTemporary(
+        const char *loggerName, Logger_Level_T level, const char *file, size_t line, const char *function,
+        time_t timestamp, Logger_String_T message
+) {
+    assert(message);
+    return initialize(
+            Logger_Arena_allocate(sizeof(struct Logger_Record_T)), loggerName, level, file, line, function, timestamp,
+            message
+    );
+}
+
 void Logger_Record_delete(Logger_Record_T *ref) {
     assert(ref);
     assert(*ref);
     Logger_Record_T self = *ref;
-    free(self);
+    Logger_Alloc_free(self);
     *ref = NULL;
 }
 
@@ -85,6 +118,31 @@ Logger_Level_T Logger_Record_getLevel(Logger_Record_T self) {
     return self->level;
 }
 
+const Logger_CallSite_T *Logger_Record_getCallSite(Logger_Record_T self) {
+    assert(self);
+    return self->callSite;
+}
+
+size_t Logger_Record_getSuppressed(Logger_Record_T self) {
+    assert(self);
+    return self->suppressed;
+}
+
+const Logger_Field_T *Logger_Record_getFields(Logger_Record_T self) {
+    assert(self);
+    return self->fields;
+}
+
+size_t Logger_Record_getFieldsCount(Logger_Record_T self) {
+    assert(self);
+    return self->fieldsCount;
+}
+
+Logger_Mdc_T Logger_Record_getMdc(Logger_Record_T self) {
+    assert(self);
+    return self->mdc;
+}
+
 void Logger_Record_setMessage(Logger_Record_T self, Logger_String_T message) {
     assert(self);
     assert(message);
@@ -124,3 +182,25 @@ void Logger_Record_setLevel(Logger_Record_T self, Logger_Level_T level) {
     assert(LOGGER_LEVEL_DEBUG <= level && level <= LOGGER_LEVEL_FATAL);
     self->level = level;
 }
+
+void Logger_Record_setCallSite(Logger_Record_T self, const Logger_CallSite_T *callSite) {
+    assert(self);
+    self->callSite = callSite;
+}
+
+void Logger_Record_setSuppressed(Logger_Record_T self, size_t suppressed) {
+    assert(self);
+    self->suppressed = suppressed;
+}
+
+void Logger_Record_setFields(Logger_Record_T self, const Logger_Field_T *fields, size_t fieldsCount) {
+    assert(self);
+    assert(fields || 0 == fieldsCount);
+    self->fields = fieldsCount > 0 ? fields : NULL;
+    self->fieldsCount = fieldsCount;
+}
+
+void Logger_Record_setMdc(Logger_Record_T self, Logger_Mdc_T mdc) {
+    assert(self);
+    self->mdc = mdc;
+}
@@ -13,7 +13,10 @@
 #include <stddef.h>
 #include <stdarg.h>
 #include "logger_level.h"
+#include "logger_field.h"
+#include "logger_mdc.h"
 #include "logger_string.h"
+#include "logger_callsite.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -25,7 +28,11 @@ extern "C" {
  * When a Logger_Record_T is passed into the logging framework it logically belongs
  * to the framework and should no longer be used or updated by the client application.
  */
+#ifdef __cplusplus
+typedef struct Logger_Record_C *Logger_Record_T;
+#else
 typedef struct Logger_Record_T *Logger_Record_T;
+#endif
 
 /**
  * Construct a Logger_Record_T.
@@ -51,6 +58,15 @@ extern Logger_Record_T Logger_Record_new(
         time_t timestamp, Logger_String_T message
 );
 
+/*
+ * Used by _Logger_log to build its record in the arena of the calling thread (see logger_arena.h):
+ * the record goes away when the arena is released and must not be deleted.
+ */
+extern Logger_Record_T _Logger_Record_newTemporary(
+        const char *loggerName, Logger_Level_T level, const char *file, size_t line, const char *function,
+        time_t timestamp, Logger_String_T message
+);
+
 /**
  * Destruct a Logger_Record_T.
  *
@@ -138,6 +154,61 @@ extern time_t Logger_Record_getTimestamp(Logger_Record_T self);
  */
 extern Logger_Level_T Logger_Record_getLevel(Logger_Record_T self);
 
+/**
+ * Get the descriptor of the call site that issued the logging request.
+ *
+ * Checked runtime errors:
+ *  - @param self must not be NULL.
+ *
+ * @param self The Logger_Record_T instance.
+ * @return The call site descriptor or NULL if the record was not issued by the logging macros.
+ */
+extern const Logger_CallSite_T *Logger_Record_getCallSite(Logger_Record_T self);
+
+/**
+ * Get the number of records of the same call site suppressed by sampling or rate limiting before this one.
+ *
+ * Checked runtime errors:
+ *  - @param self must not be NULL.
+ *
+ * @param self The Logger_Record_T instance.
+ * @return The number of suppressed records.
+ */
+extern size_t Logger_Record_getSuppressed(Logger_Record_T self);
+
+/**
+ * Get the structured fields attached to the record.
+ *
+ * Checked runtime errors:
+ *  - @param self must not be NULL.
+ *
+ * @param self The Logger_Record_T instance.
+ * @return The array of fields, NULL if the record has none.
+ */
+extern const Logger_Field_T *Logger_Record_getFields(Logger_Record_T self);
+
+/**
+ * Get the number of structured fields attached to the record.
+ *
+ * Checked runtime errors:
+ *  - @param self must not be NULL.
+ *
+ * @param self The Logger_Record_T instance.
+ * @return The number of fields.
+ */
+extern size_t Logger_Record_getFieldsCount(Logger_Record_T self);
+
+/**
+ * Get the diagnostic context snapshot attached to the record.
+ *
+ * Checked runtime errors:
+ *  - @param self must not be NULL.
+ *
+ * @param self The Logger_Record_T instance.
+ * @return The snapshot, NULL if the record has none.
+ */
+extern Logger_Mdc_T Logger_Record_getMdc(Logger_Record_T self);
+
 /**
  * Set the raw log message, before localization or formatting.
  *
@@ -220,6 +291,52 @@ extern void Logger_Record_setTimestamp(Logger_Record_T self, time_t timestamp);
  */
 extern void Logger_Record_setLevel(Logger_Record_T self, Logger_Level_T level);
 
+/**
+ * Set the descriptor of the call site that issued the logging request.
+ *
+ * Checked runtime errors:
+ *  - @param self must not be NULL.
+ *
+ * @param self The Logger_Record_T instance.
+ * @param callSite The call site descriptor, it may be NULL.
+ */
+extern void Logger_Record_setCallSite(Logger_Record_T self, const Logger_CallSite_T *callSite);
+
+/**
+ * Set the number of records of the same call site suppressed by sampling or rate limiting before this one.
+ *
+ * Checked runtime errors:
+ *  - @param self must not be NULL.
+ *
+ * @param self The Logger_Record_T instance.
+ * @param suppressed The number of suppressed records.
+ */
+extern void Logger_Record_setSuppressed(Logger_Record_T self, size_t suppressed);
+
+/**
+ * Attach structured fields to the record, the array is not copied.
+ *
+ * Checked runtime errors:
+ *  - @param self must not be NULL.
+ *  - @param fields must not be NULL unless fieldsCount is 0.
+ *
+ * @param self The Logger_Record_T instance.
+ * @param fields The array of fields.
+ * @param fieldsCount The number of fields.
+ */
+extern void Logger_Record_setFields(Logger_Record_T self, const Logger_Field_T *fields, size_t fieldsCount);
+
+/**
+ * Attach a diagnostic context snapshot to the record, no reference is taken.
+ *
+ * Checked runtime errors:
+ *  - @param self must not be NULL.
+ *
+ * @param self The Logger_Record_T instance.
+ * @param mdc The snapshot or NULL.
+ */
+extern void Logger_Record_setMdc(Logger_Record_T self, Logger_Mdc_T mdc);
+
 #ifdef __cplusplus
 }
 #endif
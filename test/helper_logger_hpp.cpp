@@ -0,0 +1,92 @@
+/*
+ * C++ Source File
+ *
+ * Author: daddinuz
+ * email:  daddinuz@gmail.com
+ * Date:   October 19, 2026
+ */
+
+#include <cfloat>
+#include <climits>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include "logger.hpp"
+#include "helper_logger_hpp.h"
+
+/*
+ * Log through logger.hpp and print the expected message with snprintf.
+ */
+#define HELPER_CASE(xFmt, ...)                                                                          \
+    do {                                                                                                \
+        logger::info(self, LOGGER_FORMAT(xFmt), __VA_ARGS__);                                           \
+        if (count < capacity) {                                                                         \
+            snprintf(expected[count], HELPER_MESSAGE_SIZE, xFmt, __VA_ARGS__);                          \
+        }                                                                                               \
+        count++;                                                                                        \
+    } while (false)
+
+size_t Helper_logCases(Logger_T self, char expected[][HELPER_MESSAGE_SIZE], size_t capacity) {
+    size_t count = 0;
+    const char *nothing = nullptr;
+    const std::string text(300, 'x');
+
+    logger::info(self, LOGGER_FORMAT("plain text, 100%% literal"));
+    snprintf(expected[count++], HELPER_MESSAGE_SIZE, "plain text, 100%% literal");
+    HELPER_CASE("%d|%i|%u", -42, 7, 42u);
+    HELPER_CASE("%hhd %hd %hhu %hu", 300, 70000, 300, -1);
+    HELPER_CASE("%ld %lu %lld %llu", LONG_MIN, ULONG_MAX, LLONG_MIN, ULLONG_MAX);
+    HELPER_CASE("%zu %zd %td %jd", sizeof(count), static_cast<std::ptrdiff_t>(-3), PTRDIFF_MIN, INTMAX_MIN);
+    HELPER_CASE("%x %X %o %x", 0xdeadbeefu, 0xabcu, 8u, -1);
+    HELPER_CASE("%c%c %d %d", 'o', 'k', true, static_cast<short>(-5));
+    HELPER_CASE("%f %e %g", 3.14159, 1e-10, 100000.0);
+    HELPER_CASE("%F %E %G %g", static_cast<double>(INFINITY), 12345.678, 1e-5, 123456789.0);
+    HELPER_CASE("%f %g %f", 1.5f, -0.0, DBL_MAX);
+    logger::info(self, LOGGER_FORMAT("%s|%s|%s"), "abc", nothing, "");
+    if (count < capacity) {
+        snprintf(expected[count], HELPER_MESSAGE_SIZE, "abc|(null)|");  /* a null %s is undefined for snprintf */
+    }
+    count++;
+    HELPER_CASE("100%% %s%%", "sure");
+    HELPER_CASE("[%5d|%-3s|%.2f|%p|%a|%Lf]", 42, "a", 2.5, static_cast<void *>(&count), 1.0, 1.5L);
+
+    logger::info(self, LOGGER_FORMAT("%s|%zu"), text, text.size());
+    if (count < capacity) {
+        snprintf(expected[count], HELPER_MESSAGE_SIZE, "%s|%zu", text.c_str(), text.size());
+    }
+    count++;
+    return count;
+}
+
+void Helper_logDebug(Logger_T self) {
+    logger::debug(self, LOGGER_FORMAT("%s"), "filtered by the logger level");
+}
+
+void Helper_logFromCallSite(Logger_T self) {
+    logger::log<LOGGER_LEVEL_INFO>(self, LOGGER_FORMAT("%d"), 1);
+}
+
+Logger_Err_T Helper_logThroughHandles(const char *filePath) {
+    try {
+        /* the handler keeps the formatter alive */
+        logger::Handler shared = [filePath] {
+            logger::Formatter formatter = logger::Formatter::logfmt();
+            return logger::Handler::file(LOGGER_LEVEL_DEBUG, formatter, filePath);
+        }();
+        logger::Logger first("first", LOGGER_LEVEL_INFO);
+        logger::Logger second("second", LOGGER_LEVEL_INFO);
+        first.addHandler(shared);
+        second.addHandler(std::move(shared));
+
+        logger::info(first, LOGGER_FORMAT("%s"), "from the first logger");
+        {
+            logger::Logger moved(std::move(second));
+            logger::info(moved, LOGGER_FORMAT("%s"), "from the second logger");
+        }
+        logger::info(first, LOGGER_FORMAT("%s"), "the handler outlives the second logger");
+    } catch (const logger::Error &e) {
+        return e.err();
+    }
+    return LOGGER_ERR_OK;
+}
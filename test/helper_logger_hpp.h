@@ -0,0 +1,47 @@
+/*
+ * C Header File
+ *
+ * Author: daddinuz
+ * email:  daddinuz@gmail.com
+ * Date:   October 19, 2026
+ */
+
+#ifndef LOGGER_HELPER_LOGGER_HPP_INCLUDED
+#define LOGGER_HELPER_LOGGER_HPP_INCLUDED
+
+#include <stddef.h>
+#include "logger.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define HELPER_MESSAGE_SIZE 512
+
+/*
+ * Log a series of messages at LOGGER_LEVEL_INFO through logger.hpp and store what each one is expected to be.
+ * It returns the number of messages logged, expected holds at most capacity of them.
+ */
+extern size_t Helper_logCases(Logger_T self, char expected[][HELPER_MESSAGE_SIZE], size_t capacity);
+
+/*
+ * Log a message at LOGGER_LEVEL_DEBUG through logger.hpp.
+ */
+extern void Helper_logDebug(Logger_T self);
+
+/*
+ * Log a message at LOGGER_LEVEL_INFO through logger.hpp, the call site belongs to this function.
+ */
+extern void Helper_logFromCallSite(Logger_T self);
+
+/*
+ * Log three messages through two loggers sharing a file handler at filePath, built with the handles of logger.hpp.
+ * It returns the error thrown building them, if any.
+ */
+extern Logger_Err_T Helper_logThroughHandles(const char *filePath);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LOGGER_HELPER_LOGGER_HPP_INCLUDED */
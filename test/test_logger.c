@@ -6,6 +6,9 @@
  * Date:   August 08, 2017
  */
 
+#include <time.h>
+#include <string.h>
+#include <pthread.h>
 #include "traits/traits.h"
 #include "traits-unit/traits-unit.h"
 #include "logger_builtin_formatters.h"
@@ -24,6 +27,32 @@ typedef struct Context_T {
     Logger_T sut;
 } *Context_T;
 
+/*
+ * Define globals
+ */
+static size_t gPublishCalls = 0;
+static size_t gFailingPublishCalls = 0;
+static const Logger_CallSite_T *gCallSites[4];
+static Logger_Field_T gLastFields[4];
+static size_t gLastFieldsCount = 0;
+static char gLastMessage[64] = "";
+static Logger_Mdc_T gLastMdc = NULL;
+static size_t gConcurrentPublishCalls = 0;
+static bool gStopLogging = false;
+static size_t gFormatterCloseCalls = 0;
+static bool gWriterStarted = false;
+
+/*
+ * Declare callbacks
+ */
+static Logger_Err_T publishCallback(Logger_Handler_T handler, Logger_Record_T record);
+static Logger_Err_T failingPublishCallback(Logger_Handler_T handler, Logger_Record_T record);
+static Logger_Err_T concurrentPublishCallback(Logger_Handler_T handler, Logger_Record_T record);
+static Logger_Err_T configuringPublishCallback(Logger_Handler_T handler, Logger_Record_T record);
+static void flushCallback(Logger_Handler_T handler);
+static void closeCallback(Logger_Handler_T handler);
+static void formatterCloseCallback(Logger_Formatter_T formatter);
+
 /*
  * Declare setups
  */
@@ -46,6 +75,17 @@ FeatureDeclare(NewAndDelete);
 FeatureDeclare(Getters);
 FeatureDeclare(Setters);
 FeatureDeclare(ManageHandlers);
+FeatureDeclare(LogFromCallSite);
+FeatureDeclare(LogFields);
+FeatureDeclare(LogWithMdc);
+FeatureDeclare(IsolateFailingHandlers);
+FeatureDeclare(Reconfigure);
+FeatureDeclare(ReconfigureWhileLogging);
+FeatureDeclare(ConfigureFromPublish);
+FeatureDeclare(DeepDeleteSharedFormatter);
+FeatureDeclare(GetRegistered);
+FeatureDeclare(InheritLevels);
+FeatureDeclare(InheritHandlers);
 
 /*
  * Describe the test case
@@ -56,10 +96,101 @@ Describe("Logger",
                  Run(NewAndDelete, FixtureLogger),
                  Run(Getters, FixtureLogger),
                  Run(Setters, FixtureLogger),
-                 Run(ManageHandlers, FixtureLogger)
+                 Run(ManageHandlers, FixtureLogger),
+                 Run(LogFromCallSite, FixtureLogger),
+                 Run(LogFields, FixtureLogger),
+                 Run(LogWithMdc, FixtureLogger),
+                 Run(IsolateFailingHandlers, FixtureLogger),
+                 Run(Reconfigure, FixtureLogger),
+                 Run(ReconfigureWhileLogging, FixtureLogger),
+                 Run(ConfigureFromPublish, FixtureLogger),
+                 Run(DeepDeleteSharedFormatter)
+         ),
+         Trait(
+                 "Registry",
+                 Run(GetRegistered),
+                 Run(InheritLevels),
+                 Run(InheritHandlers)
          )
 )
 
+/*
+ * Define callbacks
+ */
+Logger_Err_T publishCallback(Logger_Handler_T handler, Logger_Record_T record) {
+    assert_not_null(handler);
+    assert_not_null(record);
+    assert_less(gPublishCalls, sizeof(gCallSites) / sizeof(gCallSites[0]));
+    gCallSites[gPublishCalls++] = Logger_Record_getCallSite(record);
+    gLastFieldsCount = Logger_Record_getFieldsCount(record);
+    assert_less_equal(gLastFieldsCount, sizeof(gLastFields) / sizeof(gLastFields[0]));
+    for (size_t i = 0; i < gLastFieldsCount; i++) {
+        gLastFields[i] = Logger_Record_getFields(record)[i];
+    }
+    strncpy(gLastMessage, Logger_Record_getMessage(record), sizeof(gLastMessage) - 1);
+    gLastMdc = Logger_Record_getMdc(record);
+    return LOGGER_ERR_OK;
+}
+
+Logger_Err_T failingPublishCallback(Logger_Handler_T handler, Logger_Record_T record) {
+    assert_not_null(handler);
+    assert_not_null(record);
+    gFailingPublishCalls++;
+    return LOGGER_ERR_IO;
+}
+
+Logger_Err_T concurrentPublishCallback(Logger_Handler_T handler, Logger_Record_T record) {
+    assert_not_null(handler);
+    assert_not_null(record);
+    __atomic_fetch_add(&gConcurrentPublishCalls, 1, __ATOMIC_RELAXED);
+    return LOGGER_ERR_OK;
+}
+
+Logger_Err_T configuringPublishCallback(Logger_Handler_T handler, Logger_Record_T record) {
+    assert_not_null(handler);
+    assert_not_null(record);
+    const struct timespec delay = {.tv_sec=0, .tv_nsec=20 * 1000 * 1000};
+    while (!__atomic_load_n(&gWriterStarted, __ATOMIC_ACQUIRE)) {
+        /* wait for the writer */
+    }
+    nanosleep(&delay, NULL);  /* let it wait for this publish to end */
+    Logger_setLevel(Logger_get("EXPECTED_REGISTERED_NAME"), LOGGER_LEVEL_ERROR);
+    return LOGGER_ERR_OK;
+}
+
+void flushCallback(Logger_Handler_T handler) {
+    assert_not_null(handler);
+}
+
+void closeCallback(Logger_Handler_T handler) {
+    assert_not_null(handler);
+}
+
+void formatterCloseCallback(Logger_Formatter_T formatter) {
+    assert_not_null(formatter);
+    gFormatterCloseCalls++;
+}
+
+/*
+ * Define helpers
+ */
+static void *Helper_logUntilStopped(void *arg) {
+    Logger_T logger = arg;
+    while (!__atomic_load_n(&gStopLogging, __ATOMIC_RELAXED)) {
+        assert_equal(LOGGER_ERR_OK, Logger_logInfo(logger, "%s", "EXPECTED_MESSAGE"));
+    }
+    return NULL;
+}
+
+static void *Helper_addHandler(void *arg) {
+    Logger_T logger = arg;
+    Logger_Handler_T handler = Logger_Handler_new(publishCallback, flushCallback, closeCallback);
+    assert_not_null(handler);
+    __atomic_store_n(&gWriterStarted, true, __ATOMIC_RELEASE);
+    assert_equal(handler, Logger_addHandler(logger, handler));
+    return NULL;
+}
+
 /*
  * Define setups
  */
@@ -189,3 +320,346 @@ FeatureDefine(ManageHandlers) {
     assert_null(Logger_removeHandler(sut, context->HANDLER1));
     assert_null(Logger_removeHandler(sut, context->HANDLER2));
 }
+
+FeatureDefine(LogFromCallSite) {
+    Context_T context = traits_context;
+    Logger_T sut = context->sut;
+    Logger_Handler_T handler = Logger_Handler_new(publishCallback, flushCallback, closeCallback);
+    assert_not_null(handler);
+    Logger_addHandler(sut, handler);
+    Logger_setLevel(sut, LOGGER_LEVEL_INFO);
+    gPublishCalls = 0;
+
+    for (size_t i = 0; i < 2; i++) {
+        assert_equal(LOGGER_ERR_OK, Logger_logInfo(sut, "%zu", i));
+    }
+    assert_equal(LOGGER_ERR_OK, Logger_logWarning(sut, "%s", "another call site"));
+    assert_equal(LOGGER_ERR_OK, Logger_logDebug(sut, "%s", "not loggable"));
+    assert_equal(3, gPublishCalls);
+
+    /* the same call site always passes the same descriptor */
+    assert_not_null(gCallSites[0]);
+    assert_equal(gCallSites[0], gCallSites[1]);
+    assert_not_equal(gCallSites[0], gCallSites[2]);
+    assert_string_equal(__FILE__, gCallSites[0]->file);
+    assert_string_equal("%zu", gCallSites[0]->format);
+    assert_equal(LOGGER_LEVEL_INFO, gCallSites[0]->level);
+    assert_equal(LOGGER_LEVEL_WARNING, gCallSites[2]->level);
+
+    /* records passing the logger level but not the handler one are counted as filtered by the handler */
+    assert_equal(0, Logger_Handler_getStats(handler).filtered);
+    Logger_Handler_setLevel(handler, LOGGER_LEVEL_WARNING);
+    assert_equal(LOGGER_ERR_OK, Logger_logInfo(sut, "%s", "filtered by the handler"));
+    assert_equal(3, gPublishCalls);
+    assert_equal(1, Logger_Handler_getStats(handler).filtered);
+
+    assert_equal(handler, Logger_removeHandler(sut, handler));
+    Logger_Handler_delete(&handler);
+}
+
+FeatureDefine(LogFields) {
+    Context_T context = traits_context;
+    Logger_T sut = context->sut;
+    Logger_Handler_T handler = Logger_Handler_new(publishCallback, flushCallback, closeCallback);
+    assert_not_null(handler);
+    Logger_addHandler(sut, handler);
+    Logger_setLevel(sut, LOGGER_LEVEL_INFO);
+    gPublishCalls = 0;
+
+    const char *path = "/index.html";
+    assert_equal(LOGGER_ERR_OK, Logger_logFields(
+            sut, LOGGER_LEVEL_INFO, "request served 100%", LOGGER_INT("status", 200), LOGGER_STR("path", path)
+    ));
+    assert_equal(LOGGER_ERR_OK, Logger_logFields(sut, LOGGER_LEVEL_DEBUG, "not loggable", LOGGER_BOOL("hit", true)));
+    assert_equal(1, gPublishCalls);
+
+    /* the message is taken as is, the fields in order */
+    assert_string_equal("request served 100%", gLastMessage);
+    assert_equal(2, gLastFieldsCount);
+    assert_string_equal("status", gLastFields[0].key);
+    assert_equal(LOGGER_FIELD_TYPE_INT, gLastFields[0].type);
+    assert_equal(200, gLastFields[0].value.asInt);
+    assert_string_equal("path", gLastFields[1].key);
+    assert_equal(LOGGER_FIELD_TYPE_STR, gLastFields[1].type);
+    assert_equal(path, gLastFields[1].value.asStr);
+
+    /* plain records carry no fields */
+    assert_equal(LOGGER_ERR_OK, Logger_logInfo(sut, "%s", "no fields"));
+    assert_equal(0, gLastFieldsCount);
+
+    assert_equal(handler, Logger_removeHandler(sut, handler));
+    Logger_Handler_delete(&handler);
+}
+
+FeatureDefine(LogWithMdc) {
+    Context_T context = traits_context;
+    Logger_T sut = context->sut;
+    Logger_Handler_T handler = Logger_Handler_new(publishCallback, flushCallback, closeCallback);
+    assert_not_null(handler);
+    Logger_addHandler(sut, handler);
+    Logger_setLevel(sut, LOGGER_LEVEL_INFO);
+    gPublishCalls = 0;
+
+    assert_equal(LOGGER_ERR_OK, Logger_logInfo(sut, "%s", "no context"));
+    assert_null(gLastMdc);
+
+    /* records share the snapshot of the thread */
+    assert_equal(LOGGER_ERR_OK, Logger_Mdc_push("request", "EXPECTED_REQUEST"));
+    assert_equal(LOGGER_ERR_OK, Logger_logInfo(sut, "%s", "first"));
+    assert_equal(Logger_Mdc_current(), gLastMdc);
+    assert_equal(LOGGER_ERR_OK, Logger_logFields(sut, LOGGER_LEVEL_INFO, "second", LOGGER_BOOL("hit", true)));
+    assert_equal(Logger_Mdc_current(), gLastMdc);
+    assert_string_equal("EXPECTED_REQUEST", Logger_Mdc_get(gLastMdc, "request"));
+    Logger_Mdc_pop();
+
+    assert_equal(LOGGER_ERR_OK, Logger_logInfo(sut, "%s", "no context"));
+    assert_null(gLastMdc);
+    assert_equal(4, gPublishCalls);
+
+    assert_equal(handler, Logger_removeHandler(sut, handler));
+    Logger_Handler_delete(&handler);
+}
+
+FeatureDefine(IsolateFailingHandlers) {
+    Context_T context = traits_context;
+    Logger_T sut = context->sut;
+    Logger_Handler_T failingHandler = Logger_Handler_new(failingPublishCallback, flushCallback, closeCallback);
+    assert_not_null(failingHandler);
+    Logger_Handler_T handler = Logger_Handler_new(publishCallback, flushCallback, closeCallback);
+    assert_not_null(handler);
+    Logger_addHandler(sut, handler);
+    Logger_addHandler(sut, failingHandler);
+    gFailingPublishCalls = 0;
+
+    /* handlers do not back off unless asked to */
+    assert_equal(LOGGER_ERR_IO, Logger_logInfo(sut, "%s", "zeroth"));
+    assert_equal(1, gFailingPublishCalls);
+    assert_equal(false, Logger_Handler_isBackingOff(failingHandler));
+
+    Logger_Handler_setBackoff(failingHandler, 60000, 60000);
+    gPublishCalls = 0;
+    gFailingPublishCalls = 0;
+
+    /* the healthy handler is always reached, the failing one is skipped while backing off */
+    assert_equal(LOGGER_ERR_IO, Logger_logInfo(sut, "%s", "first"));
+    assert_equal(LOGGER_ERR_IO, Logger_logInfo(sut, "%s", "second"));
+    assert_equal(2, gPublishCalls);
+    assert_equal(1, gFailingPublishCalls);
+    assert_equal(2, Logger_Handler_getStats(failingHandler).errors);
+    assert_equal(1, Logger_Handler_getStats(failingHandler).drops);
+    assert_equal(0, Logger_Handler_getStats(handler).errors);
+    assert_equal(true, Logger_Handler_isBackingOff(failingHandler));
+
+    Logger_Handler_setBackoff(failingHandler, 0, 0);
+    assert_equal(false, Logger_Handler_isBackingOff(failingHandler));
+    assert_equal(LOGGER_ERR_IO, Logger_logInfo(sut, "%s", "third"));
+    assert_equal(LOGGER_ERR_IO, Logger_logInfo(sut, "%s", "fourth"));
+    assert_equal(4, gPublishCalls);
+    assert_equal(3, gFailingPublishCalls);
+
+    assert_equal(failingHandler, Logger_removeHandler(sut, failingHandler));
+    assert_equal(handler, Logger_removeHandler(sut, handler));
+    Logger_Handler_delete(&failingHandler);
+    Logger_Handler_delete(&handler);
+}
+
+FeatureDefine(Reconfigure) {
+    Context_T context = traits_context;
+    Logger_T sut = context->sut;
+    Logger_Handler_T handler = Logger_Handler_new(publishCallback, flushCallback, closeCallback);
+    Logger_Handler_T failingHandler = Logger_Handler_new(failingPublishCallback, flushCallback, closeCallback);
+    assert_not_null(handler);
+    assert_not_null(failingHandler);
+    assert_equal(handler, Logger_addHandler(sut, handler));
+    gPublishCalls = 0;
+    gFailingPublishCalls = 0;
+
+    /* level and handlers are replaced together, dispatch follows the given order */
+    const Logger_Handler_T HANDLERS[] = {failingHandler, handler};
+    assert_equal(LOGGER_ERR_OK, Logger_reconfigure(sut, LOGGER_LEVEL_ERROR, HANDLERS, 2));
+    assert_equal(LOGGER_LEVEL_ERROR, Logger_getLevel(sut));
+    assert_equal(LOGGER_ERR_OK, Logger_logWarning(sut, "%s", "not loggable"));
+    assert_equal(LOGGER_ERR_IO, Logger_logError(sut, "%s", "EXPECTED_MESSAGE"));
+    assert_equal(1, gPublishCalls);
+    assert_equal(1, gFailingPublishCalls);
+
+    assert_equal(LOGGER_ERR_OK, Logger_reconfigure(sut, LOGGER_LEVEL_DEBUG, &handler, 1));
+    assert_equal(LOGGER_ERR_OK, Logger_logDebug(sut, "%s", "EXPECTED_MESSAGE"));
+    assert_equal(2, gPublishCalls);
+    assert_equal(1, gFailingPublishCalls);
+    Logger_Handler_delete(&failingHandler);
+
+    assert_equal(LOGGER_ERR_OK, Logger_reconfigure(sut, LOGGER_LEVEL_DEBUG, NULL, 0));
+    assert_null(Logger_popHandler(sut));
+    Logger_Handler_delete(&handler);
+}
+
+FeatureDefine(ReconfigureWhileLogging) {
+    Context_T context = traits_context;
+    Logger_T sut = context->sut;
+    pthread_t threads[4];
+    Logger_Handler_T handler = Logger_Handler_new(concurrentPublishCallback, flushCallback, closeCallback);
+    assert_not_null(handler);
+    assert_equal(handler, Logger_addHandler(sut, handler));
+    Logger_setLevel(sut, LOGGER_LEVEL_INFO);
+
+    for (size_t i = 0; i < sizeof(threads) / sizeof(threads[0]); i++) {
+        assert_equal(0, pthread_create(&threads[i], NULL, Helper_logUntilStopped, sut));
+    }
+    while (0 == __atomic_load_n(&gConcurrentPublishCalls, __ATOMIC_RELAXED)) {
+        /* wait for the threads to be logging */
+    }
+    /* handlers left out are deleted right away: a thread still publishing through them would crash */
+    for (size_t i = 0; i < 1000; i++) {
+        Logger_Handler_T next = Logger_Handler_new(concurrentPublishCallback, flushCallback, closeCallback);
+        assert_not_null(next);
+        const Logger_Handler_T HANDLERS[] = {next, next};
+        assert_equal(LOGGER_ERR_OK, Logger_reconfigure(sut, i % 2 ? LOGGER_LEVEL_INFO : LOGGER_LEVEL_DEBUG, HANDLERS, 2));
+        Logger_Handler_delete(&handler);
+        handler = next;
+    }
+    __atomic_store_n(&gStopLogging, true, __ATOMIC_RELAXED);
+    for (size_t i = 0; i < sizeof(threads) / sizeof(threads[0]); i++) {
+        assert_equal(0, pthread_join(threads[i], NULL));
+    }
+
+    assert_equal(handler, Logger_popHandler(sut));
+    assert_equal(handler, Logger_popHandler(sut));
+    Logger_Handler_delete(&handler);
+}
+
+FeatureDefine(ConfigureFromPublish) {
+    Context_T context = traits_context;
+    Logger_T sut = context->sut;
+    pthread_t thread;
+    Logger_Handler_T handler = Logger_Handler_new(configuringPublishCallback, flushCallback, closeCallback);
+    assert_not_null(handler);
+    assert_equal(handler, Logger_addHandler(sut, handler));
+
+    /* the writer waits for this publish to end without keeping the rest of the configuration locked */
+    assert_equal(0, pthread_create(&thread, NULL, Helper_addHandler, sut));
+    assert_equal(LOGGER_ERR_OK, Logger_logInfo(sut, "%s", "EXPECTED_MESSAGE"));
+    assert_equal(0, pthread_join(thread, NULL));
+    assert_equal(LOGGER_LEVEL_ERROR, Logger_getLevel(Logger_get("EXPECTED_REGISTERED_NAME")));
+
+    for (Logger_Handler_T popped = Logger_popHandler(sut); popped; popped = Logger_popHandler(sut)) {
+        Logger_Handler_delete(&popped);
+    }
+}
+
+FeatureDefine(DeepDeleteSharedFormatter) {
+    (void) traits_context;
+    Logger_Formatter_T shared = Logger_Formatter_newSimpleFormatter();
+    Logger_Formatter_T own = Logger_Formatter_newSimpleFormatter();
+    assert_not_null(shared);
+    assert_not_null(own);
+    Logger_Formatter_setCloseCallback(shared, formatterCloseCallback);
+    Logger_Formatter_setCloseCallback(own, formatterCloseCallback);
+
+    Logger_T sut = Logger_new("EXPECTED_LOGGER_NAME", LOGGER_LEVEL_DEBUG);
+    assert_not_null(sut);
+    Logger_Formatter_T formatters[] = {shared, own, shared, shared};
+    for (size_t i = 0; i < sizeof(formatters) / sizeof(formatters[0]); i++) {
+        Logger_Handler_T handler = Logger_Handler_new(publishCallback, flushCallback, closeCallback);
+        assert_not_null(handler);
+        Logger_Handler_setFormatter(handler, formatters[i]);
+        assert_equal(handler, Logger_addHandler(sut, handler));
+    }
+
+    /* another logger holds its own reference to the shared formatter */
+    Logger_T other = Logger_new("EXPECTED_OTHER_LOGGER_NAME", LOGGER_LEVEL_DEBUG);
+    assert_not_null(other);
+    Logger_Handler_T handler = Logger_Handler_new(publishCallback, flushCallback, closeCallback);
+    assert_not_null(handler);
+    Logger_Handler_setFormatter(handler, Logger_Formatter_retain(shared));
+    assert_equal(handler, Logger_addHandler(other, handler));
+
+    Logger_deepDelete(&sut);
+    assert_null(sut);
+    assert_equal(1, gFormatterCloseCalls);
+    Logger_deepDelete(&other);
+    assert_equal(2, gFormatterCloseCalls);
+}
+
+FeatureDefine(GetRegistered) {
+    (void) traits_context;
+    char name[] = "db.pool.conn";
+
+    Logger_T sut = Logger_get(name);
+    assert_not_null(sut);
+    name[0] = 'X';  /* names are copied */
+    assert_equal(sut, Logger_get("db.pool.conn"));
+    assert_string_equal("db.pool.conn", Logger_getName(sut));
+
+    /* ancestors are registered along */
+    Logger_T pool = Logger_getParent(sut);
+    assert_not_null(pool);
+    assert_equal(Logger_get("db.pool"), pool);
+    assert_equal(Logger_get("db"), Logger_getParent(pool));
+    assert_equal(Logger_get(""), Logger_getParent(Logger_get("db")));
+    assert_null(Logger_getParent(Logger_get("")));
+    assert_equal(Logger_get(""), Logger_getParent(Logger_get("cache")));
+    assert_not_equal(Logger_get("db.pool"), Logger_get("db.poo"));
+}
+
+FeatureDefine(InheritLevels) {
+    (void) traits_context;
+    Logger_T root = Logger_get("");
+    Logger_T db = Logger_get("db");
+    Logger_T sut = Logger_get("db.pool.conn");
+    assert_equal(LOGGER_REGISTRY_ROOT_LEVEL, Logger_getLevel(sut));
+
+    /* level changes are pushed down to the descendants that inherit them */
+    Logger_setLevel(db, LOGGER_LEVEL_ERROR);
+    assert_equal(LOGGER_LEVEL_ERROR, Logger_getLevel(sut));
+    assert_false(Logger_isLoggable(sut, LOGGER_LEVEL_WARNING));
+    Logger_setLevel(root, LOGGER_LEVEL_DEBUG);
+    assert_equal(LOGGER_LEVEL_ERROR, Logger_getLevel(sut));
+    assert_equal(LOGGER_LEVEL_DEBUG, Logger_getLevel(Logger_get("cache")));
+
+    /* an explicit level stops inheritance until it is reset */
+    Logger_setLevel(sut, LOGGER_LEVEL_NOTICE);
+    Logger_setLevel(db, LOGGER_LEVEL_FATAL);
+    assert_equal(LOGGER_LEVEL_NOTICE, Logger_getLevel(sut));
+    assert_equal(LOGGER_LEVEL_FATAL, Logger_getLevel(Logger_get("db.pool")));
+    Logger_resetLevel(sut);
+    assert_equal(LOGGER_LEVEL_FATAL, Logger_getLevel(sut));
+    Logger_resetLevel(db);
+    assert_equal(LOGGER_LEVEL_DEBUG, Logger_getLevel(sut));
+
+    /* loggers created later take the current level */
+    Logger_setLevel(db, LOGGER_LEVEL_WARNING);
+    assert_equal(LOGGER_LEVEL_WARNING, Logger_getLevel(Logger_get("db.replica")));
+}
+
+FeatureDefine(InheritHandlers) {
+    (void) traits_context;
+    Logger_T db = Logger_get("db");
+    Logger_T sut = Logger_get("db.pool.conn");
+    Logger_Handler_T handler = Logger_Handler_new(publishCallback, flushCallback, closeCallback);
+    assert_not_null(handler);
+    assert_equal(handler, Logger_addHandler(db, handler));
+    gPublishCalls = 0;
+
+    assert_equal(LOGGER_ERR_OK, Logger_logInfo(sut, "%s", "EXPECTED_MESSAGE"));
+    assert_equal(1, gPublishCalls);
+    assert_string_equal("EXPECTED_MESSAGE", gLastMessage);
+
+    /* propagation stops at the first logger that does not propagate */
+    assert_true(Logger_getPropagate(sut));
+    Logger_setPropagate(Logger_get("db.pool"), false);
+    assert_equal(LOGGER_ERR_OK, Logger_logInfo(sut, "%s", "ANOTHER_MESSAGE"));
+    assert_equal(1, gPublishCalls);
+    Logger_setPropagate(Logger_get("db.pool"), true);
+
+    /* the level of the issuing logger applies, not the ones of the ancestors */
+    Logger_setLevel(db, LOGGER_LEVEL_FATAL);
+    Logger_setLevel(sut, LOGGER_LEVEL_DEBUG);
+    assert_equal(LOGGER_ERR_OK, Logger_logDebug(sut, "%s", "ANOTHER_MESSAGE"));
+    assert_equal(2, gPublishCalls);
+    assert_equal(LOGGER_ERR_OK, Logger_logDebug(db, "%s", "ANOTHER_MESSAGE"));
+    assert_equal(2, gPublishCalls);
+
+    assert_equal(handler, Logger_removeHandler(db, handler));
+    Logger_Handler_delete(&handler);
+}
@@ -0,0 +1,267 @@
+/*
+ * C Source File
+ *
+ * Author: daddinuz
+ * email:  daddinuz@gmail.com
+ * Date:   October 19, 2026
+ */
+
+#include <stdlib.h>
+#include <pthread.h>
+#include "traits/traits.h"
+#include "traits-unit/traits-unit.h"
+#include "logger_builtin_formatters.h"
+#include "logger_builtin_handlers.h"
+#include "logger.h"
+
+/*
+ * Define context
+ */
+typedef struct Context_T {
+    Logger_Record_T RECORD;
+    Logger_T sut;
+} *Context_T;
+
+/*
+ * Define the counting allocator
+ */
+typedef struct Counters_T {
+    size_t allocations;
+    size_t deallocations;
+} Counters_T;
+
+static Counters_T gCounters = {0, 0};
+static Counters_T gOtherCounters = {0, 0};
+static pthread_barrier_t gBarrier;
+
+static void *countingMalloc(size_t size, void *userdata) {
+    Counters_T *counters = userdata;
+    counters->allocations++;
+    return malloc(size);
+}
+
+static void *countingRealloc(void *ptr, size_t size, void *userdata) {
+    Counters_T *counters = userdata;
+    counters->allocations++;
+    return realloc(ptr, size);
+}
+
+static void countingFree(void *ptr, void *userdata) {
+    Counters_T *counters = userdata;
+    if (ptr) {
+        counters->deallocations++;
+    }
+    free(ptr);
+}
+
+/*
+ * Define helpers
+ */
+
+/*
+ * Fill the arena and the output buffer of a new thread, which ends after the allocator is swapped.
+ */
+static void *Helper_logThenWait(void *arg) {
+    Logger_T sut = arg;
+    assert_equal(LOGGER_ERR_OK, Logger_logError(sut, "%s", "EXPECTED_MESSAGE"));
+    pthread_barrier_wait(&gBarrier);
+    pthread_barrier_wait(&gBarrier);
+    return NULL;
+}
+
+/*
+ * Declare setups
+ */
+SetupDeclare(SetupCountingAllocator);
+
+/*
+ * Declare teardowns
+ */
+TeardownDeclare(TeardownCountingAllocator);
+
+/*
+ * Declare fixtures
+ */
+FixtureDeclare(FixtureCountingAllocator);
+
+/*
+ * Declare features
+ */
+FeatureDeclare(CountLibraryAllocations);
+FeatureDeclare(RestoreDefaultAllocator);
+FeatureDeclare(LogRecordWithoutAllocations);
+FeatureDeclare(LogWithoutAllocations);
+FeatureDeclare(DisabledLevelWithoutAllocations);
+FeatureDeclare(DisabledCallSiteWithoutAllocations);
+FeatureDeclare(CachesOutliveAllocatorSwap);
+
+/*
+ * Describe the test case
+ */
+Describe("LoggerAlloc",
+         Trait(
+                 "Counting",
+                 Run(CountLibraryAllocations, FixtureCountingAllocator),
+                 Run(RestoreDefaultAllocator, FixtureCountingAllocator),
+                 Run(LogRecordWithoutAllocations, FixtureCountingAllocator),
+                 Run(LogWithoutAllocations, FixtureCountingAllocator),
+                 Run(DisabledLevelWithoutAllocations, FixtureCountingAllocator),
+                 Run(DisabledCallSiteWithoutAllocations, FixtureCountingAllocator),
+                 Run(CachesOutliveAllocatorSwap, FixtureCountingAllocator)
+         )
+)
+
+/*
+ * Define setups
+ */
+SetupDefine(SetupCountingAllocator) {
+    Logger_setAllocator(countingMalloc, countingRealloc, countingFree, &gCounters);
+    Context_T context = malloc(sizeof(*context));
+    assert_not_null(context);
+    context->RECORD = Logger_Record_new(
+            "EXPECTED_LOGGER_NAME", LOGGER_LEVEL_WARNING, "EXPECTED_FILE", 42, "EXPECTED_FUNCTION", 0,
+            Logger_String_new("EXPECTED_MESSAGE")
+    );
+    assert_not_null(context->RECORD);
+    context->sut = Logger_new("EXPECTED_LOGGER_NAME", LOGGER_LEVEL_INFO);
+    assert_not_null(context->sut);
+    Logger_Formatter_T formatter = Logger_Formatter_newJsonFormatter();
+    assert_not_null(formatter);
+    Logger_Handler_Result_T result = Logger_Handler_newFileHandler(LOGGER_LEVEL_INFO, formatter, "/dev/null");
+    assert_equal(LOGGER_ERR_OK, result.err);
+    assert_equal(result.handler, Logger_addHandler(context->sut, result.handler));
+    gCounters.allocations = 0;
+    gCounters.deallocations = 0;
+    return context;
+}
+
+/*
+ * Define teardowns
+ */
+TeardownDefine(TeardownCountingAllocator) {
+    assert_not_null(traits_context);
+    Context_T context = traits_context;
+    Logger_String_T message = Logger_Record_getMessage(context->RECORD);
+    Logger_String_delete(&message);
+    Logger_Record_delete(&context->RECORD);
+    Logger_deepDelete(&context->sut);
+    assert_null(context->sut);
+    free(context);
+}
+
+/*
+ * Define fixtures
+ */
+FixtureDefine(FixtureCountingAllocator, SetupCountingAllocator, TeardownCountingAllocator);
+
+/*
+ * Define features
+ */
+FeatureDefine(CountLibraryAllocations) {
+    (void) traits_context;
+
+    Logger_T logger = Logger_new("ANOTHER_LOGGER_NAME", LOGGER_LEVEL_INFO);
+    assert_not_null(logger);
+    Logger_String_T message = Logger_String_new("ANOTHER_MESSAGE");
+    assert_not_null(message);
+    assert_equal(2, gCounters.allocations);
+
+    Logger_String_delete(&message);
+    Logger_delete(&logger);
+    assert_equal(2, gCounters.deallocations);
+}
+
+FeatureDefine(RestoreDefaultAllocator) {
+    (void) traits_context;
+
+    /* both allocators are backed by the standard library, so the fixture memory can be freed either way */
+    Logger_setAllocator(NULL, NULL, NULL, NULL);
+    Logger_String_T message = Logger_String_new("ANOTHER_MESSAGE");
+    assert_not_null(message);
+    Logger_String_delete(&message);
+    assert_equal(0, gCounters.allocations);
+    assert_equal(0, gCounters.deallocations);
+}
+
+FeatureDefine(LogRecordWithoutAllocations) {
+    Context_T context = traits_context;
+
+    /* warm up: thread-local buffers and stdio buffers are allocated once */
+    for (size_t i = 0; i < 2; i++) {
+        assert_equal(LOGGER_ERR_OK, Logger_logRecord(context->sut, context->RECORD));
+    }
+    gCounters.allocations = 0;
+    for (size_t i = 0; i < 100; i++) {
+        assert_equal(LOGGER_ERR_OK, Logger_logRecord(context->sut, context->RECORD));
+    }
+    assert_equal(0, gCounters.allocations);
+}
+
+FeatureDefine(LogWithoutAllocations) {
+    Context_T context = traits_context;
+    Logger_Formatter_T formatter = Logger_Formatter_newSimpleFormatter();
+    assert_not_null(formatter);
+    Logger_Handler_Result_T result = Logger_Handler_newFileHandler(LOGGER_LEVEL_INFO, formatter, "/dev/null");
+    assert_equal(LOGGER_ERR_OK, result.err);
+    assert_equal(result.handler, Logger_addHandler(context->sut, result.handler));
+
+    /* warm up: the arena grows to fit the largest request once */
+    for (size_t i = 0; i < 2; i++) {
+        assert_equal(LOGGER_ERR_OK, Logger_logError(context->sut, "%s %zu", "EXPECTED_MESSAGE", i));
+    }
+    gCounters.allocations = 0;
+    for (size_t i = 0; i < 100; i++) {
+        assert_equal(LOGGER_ERR_OK, Logger_logError(context->sut, "%s %zu", "EXPECTED_MESSAGE", i));
+    }
+    assert_equal(0, gCounters.allocations);
+}
+
+FeatureDefine(DisabledLevelWithoutAllocations) {
+    Context_T context = traits_context;
+
+    for (size_t i = 0; i < 100; i++) {
+        assert_equal(LOGGER_ERR_OK, Logger_logDebug(context->sut, "%zu", i));
+    }
+    assert_equal(0, gCounters.allocations);
+}
+
+FeatureDefine(DisabledCallSiteWithoutAllocations) {
+    Context_T context = traits_context;
+
+    for (size_t i = 0; i < 101; i++) {
+        if (1 == i) {
+            Logger_CallSite_disable(__FILE__, __func__, 0, 0);
+            gCounters.allocations = 0;
+        }
+        assert_equal(LOGGER_ERR_OK, Logger_logError(context->sut, "%zu", i));
+    }
+    assert_equal(0, gCounters.allocations);
+}
+
+FeatureDefine(CachesOutliveAllocatorSwap) {
+    Context_T context = traits_context;
+    pthread_t thread;
+    assert_equal(0, pthread_barrier_init(&gBarrier, NULL, 2));
+
+    /* the caches of this thread are replaced on their next use */
+    assert_equal(LOGGER_ERR_OK, Logger_logRecord(context->sut, context->RECORD));
+    Logger_setAllocator(countingMalloc, countingRealloc, countingFree, &gOtherCounters);
+    const size_t deallocations = gCounters.deallocations;
+    assert_equal(LOGGER_ERR_OK, Logger_logRecord(context->sut, context->RECORD));
+    assert_equal(deallocations + 1, gCounters.deallocations);
+    assert_greater(gOtherCounters.allocations, 0);
+
+    /* those of a thread ending after the swap go back to the allocator that allocated them */
+    Logger_setAllocator(countingMalloc, countingRealloc, countingFree, &gCounters);
+    assert_equal(0, pthread_create(&thread, NULL, Helper_logThenWait, context->sut));
+    pthread_barrier_wait(&gBarrier);
+    Logger_setAllocator(countingMalloc, countingRealloc, countingFree, &gOtherCounters);
+    const size_t threadDeallocations = gCounters.deallocations, otherDeallocations = gOtherCounters.deallocations;
+    pthread_barrier_wait(&gBarrier);
+    assert_equal(0, pthread_join(thread, NULL));
+    assert_equal(threadDeallocations + 2, gCounters.deallocations);  /* the arena chunk and the output buffer */
+    assert_equal(otherDeallocations, gOtherCounters.deallocations);
+
+    Logger_setAllocator(countingMalloc, countingRealloc, countingFree, &gCounters);
+    pthread_barrier_destroy(&gBarrier);
+}
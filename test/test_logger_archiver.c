@@ -0,0 +1,167 @@
+/*
+ * C Source File
+ *
+ * Author: daddinuz
+ * email:  daddinuz@gmail.com
+ * Date:   October 19, 2026
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "traits/traits.h"
+#include "traits-unit/traits-unit.h"
+#include "logger_archiver.h"
+
+/*
+ * Declare features
+ */
+FeatureDeclare(ArchiveFiles);
+FeatureDeclare(CountFailuresAndDrops);
+FeatureDeclare(KeepExistingArchives);
+
+/*
+ * Describe the test case
+ */
+Describe("LoggerArchiver",
+         Trait(
+                 "Basic",
+                 Run(ArchiveFiles),
+                 Run(CountFailuresAndDrops),
+                 Run(KeepExistingArchives)
+         )
+)
+
+/*
+ * Define helpers
+ */
+
+/*
+ * Write lines log lines to path.
+ */
+static void Helper_writeFile(const char *path, size_t lines) {
+    FILE *file = fopen(path, "w");
+    assert_not_null(file);
+    for (size_t i = 0; i < lines; i++) {
+        fprintf(file, "2026-10-19 12:00:00 NOTICE [app] served /index.html in %zu ms\n", i % 97);
+    }
+    assert_equal(0, fclose(file));
+}
+
+static long Helper_fileSize(const char *path) {
+    FILE *file = fopen(path, "rb");
+    assert_not_null(file);
+    assert_equal(0, fseek(file, 0, SEEK_END));
+    const long size = ftell(file);
+    fclose(file);
+    return size;
+}
+
+/*
+ * Define features
+ */
+FeatureDefine(ArchiveFiles) {
+    (void) traits_context;
+    const size_t FILES = 4;
+    const size_t LINES = 4096;  /* several blocks */
+    const Logger_Compress_Codec_T CODECS[] = {LOGGER_COMPRESS_CODEC_LZ, LOGGER_COMPRESS_CODEC_ZLIB};
+    const char *const EXTENSIONS[] = {".lgz", ".gz"};
+    char directory[] = "/tmp/logger_archiver_XXXXXX";
+    char path[64];
+    char archivedPath[64];
+    assert_not_null(mkdtemp(directory));
+
+    for (size_t i = 0; i < sizeof(CODECS) / sizeof(CODECS[0]); i++) {
+        Logger_Archiver_Result_T result = Logger_Archiver_new(CODECS[i], 2, FILES);
+        if (LOGGER_COMPRESS_CODEC_ZLIB == CODECS[i] && !Logger_Compress_hasZlib()) {
+            assert_equal(LOGGER_ERR_INVALID_CONFIG, result.err);
+            assert_null(result.archiver);
+            continue;
+        }
+        assert_equal(LOGGER_ERR_OK, result.err);
+        long rawSize = 0;
+        for (size_t j = 0; j < FILES; j++) {
+            snprintf(path, sizeof(path), "%s/app.log.%zu", directory, j);
+            Helper_writeFile(path, LINES);
+            rawSize = Helper_fileSize(path);
+            assert_true(Logger_Archiver_submit(result.archiver, path));
+        }
+        Logger_Archiver_wait(result.archiver);
+        const Logger_Archiver_Stats_T stats = Logger_Archiver_getStats(result.archiver);
+        assert_equal(FILES, stats.archived);
+        assert_equal(0, stats.failed);
+        assert_equal(0, stats.dropped);
+        Logger_Archiver_delete(&result.archiver);
+        assert_null(result.archiver);
+
+        for (size_t j = 0; j < FILES; j++) {
+            snprintf(path, sizeof(path), "%s/app.log.%zu", directory, j);
+            snprintf(archivedPath, sizeof(archivedPath), "%s%s", path, EXTENSIONS[i]);
+            assert_not_equal(0, access(path, F_OK));
+            assert_less(Helper_fileSize(archivedPath) * 4, rawSize);
+            if (LOGGER_COMPRESS_CODEC_ZLIB == CODECS[i]) {
+                unsigned char magic[2] = {0};
+                FILE *file = fopen(archivedPath, "rb");
+                assert_not_null(file);
+                assert_equal(sizeof(magic), fread(magic, 1, sizeof(magic), file));
+                fclose(file);
+                assert_equal(0x1f, magic[0]);
+                assert_equal(0x8b, magic[1]);
+            }
+            unlink(archivedPath);
+        }
+    }
+    assert_equal(0, rmdir(directory));
+}
+
+FeatureDefine(CountFailuresAndDrops) {
+    (void) traits_context;
+    const size_t SUBMISSIONS = 64;
+    Logger_Archiver_Result_T result = Logger_Archiver_new(LOGGER_COMPRESS_CODEC_LZ, 1, 1);
+    assert_equal(LOGGER_ERR_OK, result.err);
+
+    /* the queue holds one file, submitting never waits for room */
+    size_t queued = 0;
+    for (size_t i = 0; i < SUBMISSIONS; i++) {
+        queued += Logger_Archiver_submit(result.archiver, "/tmp/logger_archiver_missing/app.log") ? 1 : 0;
+    }
+    Logger_Archiver_wait(result.archiver);
+    const Logger_Archiver_Stats_T stats = Logger_Archiver_getStats(result.archiver);
+    assert_greater_equal(queued, 1);
+    assert_equal(queued, stats.failed);
+    assert_equal(SUBMISSIONS - queued, stats.dropped);
+    assert_equal(0, stats.archived);
+    Logger_Archiver_delete(&result.archiver);
+}
+
+FeatureDefine(KeepExistingArchives) {
+    (void) traits_context;
+    const size_t RUNS = 3;
+    const char *const EXPECTED_ARCHIVES[] = {"app.log.lgz", "app.log.1.lgz", "app.log.2.lgz"};
+    char directory[] = "/tmp/logger_archiver_XXXXXX";
+    char path[64];
+    char archivedPath[64];
+    assert_not_null(mkdtemp(directory));
+    snprintf(path, sizeof(path), "%s/app.log", directory);
+
+    /* the same file name comes back, e.g. after a restart */
+    Logger_Archiver_Result_T result = Logger_Archiver_new(LOGGER_COMPRESS_CODEC_LZ, 1, 1);
+    assert_equal(LOGGER_ERR_OK, result.err);
+    for (size_t i = 0; i < RUNS; i++) {
+        Helper_writeFile(path, i + 1);
+        assert_true(Logger_Archiver_submit(result.archiver, path));
+        Logger_Archiver_wait(result.archiver);
+    }
+    const Logger_Archiver_Stats_T stats = Logger_Archiver_getStats(result.archiver);
+    assert_equal(RUNS, stats.archived);
+    assert_equal(0, stats.failed);
+    Logger_Archiver_delete(&result.archiver);
+
+    for (size_t i = 0; i < RUNS; i++) {
+        snprintf(archivedPath, sizeof(archivedPath), "%s/%s", directory, EXPECTED_ARCHIVES[i]);
+        assert_equal(0, access(archivedPath, F_OK));
+        unlink(archivedPath);
+    }
+    assert_equal(0, rmdir(directory));
+}
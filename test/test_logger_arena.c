@@ -0,0 +1,156 @@
+/*
+ * C Source File
+ *
+ * Author: daddinuz
+ * email:  daddinuz@gmail.com
+ * Date:   October 19, 2026
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <pthread.h>
+#include "traits/traits.h"
+#include "traits-unit/traits-unit.h"
+#include "logger_arena.h"
+
+/*
+ * Declare features
+ */
+FeatureDeclare(AllocateAligned);
+FeatureDeclare(ReleaseInStackOrder);
+FeatureDeclare(GrowAndCompact);
+FeatureDeclare(Printf);
+FeatureDeclare(AllocateFromLaterDestructor);
+
+/*
+ * Describe the test case
+ */
+Describe("LoggerArena",
+         Trait(
+                 "Basic",
+                 Run(AllocateAligned),
+                 Run(ReleaseInStackOrder),
+                 Run(GrowAndCompact),
+                 Run(Printf),
+                 Run(AllocateFromLaterDestructor)
+         )
+)
+
+/*
+ * Define helpers
+ */
+static char *Helper_printf(const char *fmt, ...) {
+    va_list args;
+    va_start(args, fmt);
+    char *str = Logger_Arena_vprintf(fmt, args);
+    va_end(args);
+    return str;
+}
+
+/*
+ * A key created after the arena's one, its destructor runs once the arena's has.
+ */
+static pthread_key_t gLaterKey;
+static bool gLaterAllocated = false;
+
+static void Helper_laterDestructor(void *value) {
+    (void) value;
+    char *ptr = Logger_Arena_allocate(16);
+    if (ptr) {
+        memset(ptr, 0xFF, 16);
+        Logger_Arena_release(ptr);
+        gLaterAllocated = true;
+    }
+}
+
+static void *Helper_thread(void *arg) {
+    (void) arg;
+    Logger_Arena_release(Logger_Arena_allocate(16));
+    pthread_key_create(&gLaterKey, Helper_laterDestructor);
+    pthread_setspecific(gLaterKey, &gLaterKey);
+    return NULL;
+}
+
+/*
+ * Define features
+ */
+FeatureDefine(AllocateAligned) {
+    (void) traits_context;
+
+    void *first = Logger_Arena_allocate(1);
+    assert_not_null(first);
+    for (size_t size = 1; size < 64; size++) {
+        void *ptr = Logger_Arena_allocate(size);
+        assert_not_null(ptr);
+        assert_equal(0, (uintptr_t) ptr % (2 * sizeof(void *)));
+        memset(ptr, 0xFF, size);
+    }
+    Logger_Arena_release(first);
+}
+
+FeatureDefine(ReleaseInStackOrder) {
+    (void) traits_context;
+
+    void *first = Logger_Arena_allocate(16);
+    void *second = Logger_Arena_allocate(16);
+    assert_not_null(first);
+    assert_not_null(second);
+    assert_not_equal(first, second);
+
+    Logger_Arena_release(second);
+    assert_equal(second, Logger_Arena_allocate(16));
+
+    /* releasing the first block takes the second with it, releasing the second again does nothing */
+    Logger_Arena_release(first);
+    const size_t used = Logger_Arena_getUsed();
+    Logger_Arena_release(second);
+    assert_equal(used, Logger_Arena_getUsed());
+    assert_equal(first, Logger_Arena_allocate(16));
+    Logger_Arena_release(first);
+}
+
+FeatureDefine(GrowAndCompact) {
+    (void) traits_context;
+
+    void *first = Logger_Arena_allocate(LOGGER_ARENA_CHUNK_SIZE / 2);
+    assert_not_null(first);
+    void *large = Logger_Arena_allocate(4 * LOGGER_ARENA_CHUNK_SIZE);
+    assert_not_null(large);
+    memset(large, 0xFF, 4 * LOGGER_ARENA_CHUNK_SIZE);
+    assert_true(Logger_Arena_getUsed() >= 4 * LOGGER_ARENA_CHUNK_SIZE + LOGGER_ARENA_CHUNK_SIZE / 2);
+
+    /* once empty, the chunks are merged: everything fits back in a single one */
+    Logger_Arena_release(first);
+    first = Logger_Arena_allocate(LOGGER_ARENA_CHUNK_SIZE / 2);
+    assert_not_null(first);
+    large = Logger_Arena_allocate(4 * LOGGER_ARENA_CHUNK_SIZE);
+    assert_not_null(large);
+    assert_equal((uintptr_t) first + LOGGER_ARENA_CHUNK_SIZE / 2, (uintptr_t) large);
+    Logger_Arena_release(first);
+}
+
+FeatureDefine(Printf) {
+    (void) traits_context;
+
+    char *first = Helper_printf("%s %d", "EXPECTED_STRING", 42);
+    assert_not_null(first);
+    assert_string_equal("EXPECTED_STRING 42", first);
+
+    /* longer than what is left in the chunk */
+    char *second = Helper_printf("%*s", LOGGER_ARENA_CHUNK_SIZE, "EXPECTED_STRING");
+    assert_not_null(second);
+    assert_equal(LOGGER_ARENA_CHUNK_SIZE, strlen(second));
+    assert_string_equal("EXPECTED_STRING", second + LOGGER_ARENA_CHUNK_SIZE - strlen("EXPECTED_STRING"));
+    assert_string_equal("EXPECTED_STRING 42", first);
+    Logger_Arena_release(first);
+}
+
+FeatureDefine(AllocateFromLaterDestructor) {
+    (void) traits_context;
+    pthread_t thread;
+
+    assert_equal(0, pthread_create(&thread, NULL, Helper_thread, NULL));
+    assert_equal(0, pthread_join(thread, NULL));
+    assert_true(gLaterAllocated);
+}
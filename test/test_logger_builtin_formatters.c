@@ -0,0 +1,621 @@
+/*
+ * C Source File
+ *
+ * Author: daddinuz
+ * email:  daddinuz@gmail.com
+ * Date:   October 19, 2026
+ */
+
+#include <math.h>
+#include <pthread.h>
+#include "traits/traits.h"
+#include "traits-unit/traits-unit.h"
+#include "logger_binary.h"
+#include "logger_intern.h"
+#include "logger_builtin_formatters.h"
+
+/*
+ * Define context
+ */
+typedef struct Context_T {
+    Logger_Record_T RECORD;
+    Logger_Formatter_T sut;
+} *Context_T;
+
+/*
+ * Define globals
+ */
+#define FIELDS_SIZE 5
+
+static Logger_Field_T gFields[FIELDS_SIZE];
+
+/*
+ * Declare setups
+ */
+SetupDeclare(SetupSimpleFormatter);
+SetupDeclare(SetupJsonFormatter);
+SetupDeclare(SetupLogfmtFormatter);
+SetupDeclare(SetupBinaryFormatter);
+
+/*
+ * Declare teardowns
+ */
+TeardownDeclare(TeardownFormatter);
+
+/*
+ * Declare fixtures
+ */
+FixtureDeclare(FixtureSimpleFormatter);
+FixtureDeclare(FixtureJsonFormatter);
+FixtureDeclare(FixtureLogfmtFormatter);
+FixtureDeclare(FixtureBinaryFormatter);
+
+/*
+ * Declare features
+ */
+FeatureDeclare(SimpleFormat);
+FeatureDeclare(SimpleFields);
+FeatureDeclare(SimpleMdc);
+FeatureDeclare(JsonFormat);
+FeatureDeclare(JsonEscape);
+FeatureDeclare(JsonFields);
+FeatureDeclare(JsonMdc);
+FeatureDeclare(LogfmtFormat);
+FeatureDeclare(LogfmtQuoting);
+FeatureDeclare(LogfmtFields);
+FeatureDeclare(LogfmtMdc);
+FeatureDeclare(BinaryFormat);
+FeatureDeclare(BinaryFields);
+FeatureDeclare(BinaryFullTable);
+FeatureDeclare(BinaryDefinitionsPrecedeRecords);
+
+/*
+ * Describe the test case
+ */
+Describe("LoggerBuiltinFormatters",
+         Trait(
+                 "Simple",
+                 Run(SimpleFormat, FixtureSimpleFormatter),
+                 Run(SimpleFields, FixtureSimpleFormatter),
+                 Run(SimpleMdc, FixtureSimpleFormatter)
+         ),
+         Trait(
+                 "Json",
+                 Run(JsonFormat, FixtureJsonFormatter),
+                 Run(JsonEscape, FixtureJsonFormatter),
+                 Run(JsonFields, FixtureJsonFormatter),
+                 Run(JsonMdc, FixtureJsonFormatter)
+         ),
+         Trait(
+                 "Logfmt",
+                 Run(LogfmtFormat, FixtureLogfmtFormatter),
+                 Run(LogfmtQuoting, FixtureLogfmtFormatter),
+                 Run(LogfmtFields, FixtureLogfmtFormatter),
+                 Run(LogfmtMdc, FixtureLogfmtFormatter)
+         ),
+         Trait(
+                 "Binary",
+                 Run(BinaryFormat, FixtureBinaryFormatter),
+                 Run(BinaryFields, FixtureBinaryFormatter),
+                 Run(BinaryFullTable, FixtureBinaryFormatter),
+                 Run(BinaryDefinitionsPrecedeRecords, FixtureBinaryFormatter)
+         )
+)
+
+/*
+ * Define helpers
+ */
+static Context_T Helper_newContext(Logger_Formatter_T formatter) {
+    assert_not_null(formatter);
+    Context_T context = malloc(sizeof(*context));
+    assert_not_null(context);
+    context->RECORD = Logger_Record_new(
+            "EXPECTED_LOGGER_NAME", LOGGER_LEVEL_WARNING, "EXPECTED_FILE", 42, "EXPECTED_FUNCTION", 0,
+            Logger_String_new("EXPECTED_MESSAGE")
+    );
+    assert_not_null(context->RECORD);
+    context->sut = formatter;
+    return context;
+}
+
+/*
+ * Attach one field of each type to record.
+ */
+static void Helper_setFields(Logger_Record_T record) {
+    gFields[0] = LOGGER_INT("int", -42);
+    gFields[1] = LOGGER_UINT("uint", 42);
+    gFields[2] = LOGGER_DOUBLE("double", 0.5);
+    gFields[3] = LOGGER_BOOL("bool", true);
+    gFields[4] = LOGGER_STR("str", "a \"quoted\" value");
+    Logger_Record_setFields(record, gFields, FIELDS_SIZE);
+}
+
+/*
+ * Push a context on this thread and attach it to record.
+ */
+static void Helper_setMdc(Logger_Record_T record) {
+    assert_equal(LOGGER_ERR_OK, Logger_Mdc_push("request", "42"));
+    assert_equal(LOGGER_ERR_OK, Logger_Mdc_push("tenant", "a \"quoted\" value"));
+    Logger_Record_setMdc(record, Logger_Mdc_current());
+}
+
+/*
+ * Read the frame at *offset, return its type and move *offset past the frame header.
+ */
+static int Helper_nextFrame(const unsigned char *data, size_t size, size_t *offset, size_t *payloadSize) {
+    uint64_t value = 0;
+    const size_t read = Logger_Binary_decodeVarint(data + *offset, size - *offset, &value);
+    assert_greater(read, 0);
+    *payloadSize = (size_t) value - 1;
+    *offset += read + 1;
+    return data[*offset - 1];
+}
+
+/*
+ * Format the record of context, return the number of definition frames in front of it
+ * and store the scope of its epoch frame, if any, in scope.
+ */
+static size_t Helper_countDefinitions(Context_T context, uint64_t *scope) {
+    size_t offset = 0, payloadSize = 0, definitions = 0;
+    int64_t epoch = 0;
+    int type = 0;
+    char *formattedRecord = Logger_Formatter_formatRecord(context->sut, context->RECORD);
+    assert_not_null(formattedRecord);
+    const unsigned char *data = (const unsigned char *) formattedRecord;
+    const size_t size = Logger_Formatter_sizeFormattedRecord(context->sut, formattedRecord);
+    while (LOGGER_BINARY_FRAME_RECORD != (type = Helper_nextFrame(data, size, &offset, &payloadSize))) {
+        if (LOGGER_BINARY_FRAME_EPOCH == type) {
+            const size_t read = Logger_Binary_decodeSignedVarint(data + offset, size - offset, &epoch);
+            assert_greater(Logger_Binary_decodeVarint(data + offset + read, size - offset - read, scope), 0);
+        }
+        definitions += LOGGER_BINARY_FRAME_DEFINITION == type;
+        offset += payloadSize;
+    }
+    Logger_Formatter_deleteFormattedRecord(context->sut, formattedRecord);
+    return definitions;
+}
+
+static void *Helper_countDefinitionsThread(void *arg) {
+    static uint64_t scope = 0;
+    static size_t definitions = 0;
+    definitions = Helper_countDefinitions(arg, &scope);
+    return &definitions;
+}
+
+/*
+ * Define setups
+ */
+SetupDefine(SetupSimpleFormatter) {
+    return Helper_newContext(Logger_Formatter_newSimpleFormatter());
+}
+
+SetupDefine(SetupJsonFormatter) {
+    return Helper_newContext(Logger_Formatter_newJsonFormatter());
+}
+
+SetupDefine(SetupLogfmtFormatter) {
+    return Helper_newContext(Logger_Formatter_newLogfmtFormatter());
+}
+
+SetupDefine(SetupBinaryFormatter) {
+    return Helper_newContext(Logger_Formatter_newBinaryFormatter());
+}
+
+/*
+ * Define teardowns
+ */
+TeardownDefine(TeardownFormatter) {
+    assert_not_null(traits_context);
+    Context_T context = traits_context;
+    Logger_String_T message = Logger_Record_getMessage(context->RECORD);
+    Logger_String_delete(&message);
+    Logger_Record_delete(&context->RECORD);
+    assert_null(context->RECORD);
+    Logger_Formatter_delete(&context->sut);
+    assert_null(context->sut);
+    free(context);
+}
+
+/*
+ * Define fixtures
+ */
+FixtureDefine(FixtureSimpleFormatter, SetupSimpleFormatter, TeardownFormatter);
+FixtureDefine(FixtureJsonFormatter, SetupJsonFormatter, TeardownFormatter);
+FixtureDefine(FixtureLogfmtFormatter, SetupLogfmtFormatter, TeardownFormatter);
+FixtureDefine(FixtureBinaryFormatter, SetupBinaryFormatter, TeardownFormatter);
+
+/*
+ * Define features
+ */
+FeatureDefine(SimpleFormat) {
+    Context_T context = traits_context;
+    char *formattedRecord = Logger_Formatter_formatRecord(context->sut, context->RECORD);
+    assert_not_null(formattedRecord);
+    assert_string_equal(
+            "EXPECTED_LOGGER_NAME [WARNING] 1970-01-01 00:00:00 UTC EXPECTED_FILE:42:EXPECTED_FUNCTION\n"
+                    "EXPECTED_MESSAGE\n",
+            formattedRecord
+    );
+    Logger_Formatter_deleteFormattedRecord(context->sut, formattedRecord);
+}
+
+FeatureDefine(SimpleFields) {
+    Context_T context = traits_context;
+    const Logger_Field_T NULL_STR[] = {LOGGER_STR("str", NULL)};
+
+    Helper_setFields(context->RECORD);
+    char *formattedRecord = Logger_Formatter_formatRecord(context->sut, context->RECORD);
+    assert_not_null(formattedRecord);
+    assert_string_equal(
+            "EXPECTED_LOGGER_NAME [WARNING] 1970-01-01 00:00:00 UTC EXPECTED_FILE:42:EXPECTED_FUNCTION\n"
+                    "EXPECTED_MESSAGE int=-42 uint=42 double=0.5 bool=true str=a \"quoted\" value\n",
+            formattedRecord
+    );
+    assert_equal(strlen(formattedRecord), Logger_Formatter_sizeFormattedRecord(context->sut, formattedRecord));
+    Logger_Formatter_deleteFormattedRecord(context->sut, formattedRecord);
+
+    Logger_Record_setFields(context->RECORD, NULL_STR, 1);
+    formattedRecord = Logger_Formatter_formatRecord(context->sut, context->RECORD);
+    assert_not_null(formattedRecord);
+    assert_not_null(strstr(formattedRecord, "EXPECTED_MESSAGE str=(null)\n"));
+    Logger_Formatter_deleteFormattedRecord(context->sut, formattedRecord);
+}
+
+FeatureDefine(SimpleMdc) {
+    Context_T context = traits_context;
+    const Logger_Field_T FIELDS[] = {LOGGER_INT("status", 200)};
+
+    Helper_setMdc(context->RECORD);
+    Logger_Record_setFields(context->RECORD, FIELDS, 1);
+    char *formattedRecord = Logger_Formatter_formatRecord(context->sut, context->RECORD);
+    assert_not_null(formattedRecord);
+    assert_string_equal(
+            "EXPECTED_LOGGER_NAME [WARNING] 1970-01-01 00:00:00 UTC EXPECTED_FILE:42:EXPECTED_FUNCTION\n"
+                    "EXPECTED_MESSAGE request=42 tenant=a \"quoted\" value status=200\n",
+            formattedRecord
+    );
+    Logger_Formatter_deleteFormattedRecord(context->sut, formattedRecord);
+    Logger_Mdc_clear();
+}
+
+FeatureDefine(JsonFormat) {
+    Context_T context = traits_context;
+    char *formattedRecord = Logger_Formatter_formatRecord(context->sut, context->RECORD);
+    assert_not_null(formattedRecord);
+    assert_string_equal(
+            "{\"logger\":\"EXPECTED_LOGGER_NAME\",\"level\":\"WARNING\",\"timestamp\":\"1970-01-01T00:00:00Z\","
+                    "\"file\":\"EXPECTED_FILE\",\"line\":42,\"function\":\"EXPECTED_FUNCTION\","
+                    "\"message\":\"EXPECTED_MESSAGE\"}\n",
+            formattedRecord
+    );
+    Logger_Formatter_deleteFormattedRecord(context->sut, formattedRecord);
+}
+
+FeatureDefine(JsonEscape) {
+    Context_T context = traits_context;
+    Logger_String_T message = Logger_Record_getMessage(context->RECORD);
+    Logger_String_delete(&message);
+
+    /* long enough to cross several vector-sized chunks, with escapes at chunk boundaries */
+    message = Logger_String_new(
+            "0123456789abcde\"0123456789abcdef0123456789abcde\\"
+                    "tab\there, newline\nthere, bell\a and a very long tail without anything to escape at all"
+    );
+    assert_not_null(message);
+    Logger_Record_setMessage(context->RECORD, message);
+
+    char *formattedRecord = Logger_Formatter_formatRecord(context->sut, context->RECORD);
+    assert_not_null(formattedRecord);
+    assert_string_equal(
+            "{\"logger\":\"EXPECTED_LOGGER_NAME\",\"level\":\"WARNING\",\"timestamp\":\"1970-01-01T00:00:00Z\","
+                    "\"file\":\"EXPECTED_FILE\",\"line\":42,\"function\":\"EXPECTED_FUNCTION\","
+                    "\"message\":\"0123456789abcde\\\"0123456789abcdef0123456789abcde\\\\"
+                    "tab\\there, newline\\nthere, bell\\u0007 and a very long tail without anything to escape at all\"}\n",
+            formattedRecord
+    );
+    Logger_Formatter_deleteFormattedRecord(context->sut, formattedRecord);
+}
+
+FeatureDefine(JsonFields) {
+    Context_T context = traits_context;
+    const Logger_Field_T NOT_FINITE[] = {LOGGER_DOUBLE("nan", NAN), LOGGER_STR("str", NULL)};
+
+    Helper_setFields(context->RECORD);
+    char *formattedRecord = Logger_Formatter_formatRecord(context->sut, context->RECORD);
+    assert_not_null(formattedRecord);
+    assert_string_equal(
+            "{\"logger\":\"EXPECTED_LOGGER_NAME\",\"level\":\"WARNING\",\"timestamp\":\"1970-01-01T00:00:00Z\","
+                    "\"file\":\"EXPECTED_FILE\",\"line\":42,\"function\":\"EXPECTED_FUNCTION\","
+                    "\"message\":\"EXPECTED_MESSAGE\",\"fields\":{\"int\":-42,\"uint\":42,\"double\":0.5,"
+                    "\"bool\":true,\"str\":\"a \\\"quoted\\\" value\"}}\n",
+            formattedRecord
+    );
+    Logger_Formatter_deleteFormattedRecord(context->sut, formattedRecord);
+
+    Logger_Record_setFields(context->RECORD, NOT_FINITE, 2);
+    formattedRecord = Logger_Formatter_formatRecord(context->sut, context->RECORD);
+    assert_not_null(formattedRecord);
+    assert_not_null(strstr(formattedRecord, ",\"fields\":{\"nan\":null,\"str\":null}}\n"));
+    Logger_Formatter_deleteFormattedRecord(context->sut, formattedRecord);
+}
+
+FeatureDefine(JsonMdc) {
+    Context_T context = traits_context;
+    Helper_setMdc(context->RECORD);
+    char *formattedRecord = Logger_Formatter_formatRecord(context->sut, context->RECORD);
+    assert_not_null(formattedRecord);
+    assert_not_null(strstr(
+            formattedRecord,
+            ",\"message\":\"EXPECTED_MESSAGE\",\"mdc\":{\"request\":\"42\",\"tenant\":\"a \\\"quoted\\\" value\"}}\n"
+    ));
+    Logger_Formatter_deleteFormattedRecord(context->sut, formattedRecord);
+    Logger_Mdc_clear();
+}
+
+FeatureDefine(LogfmtFormat) {
+    Context_T context = traits_context;
+    char *formattedRecord = Logger_Formatter_formatRecord(context->sut, context->RECORD);
+    assert_not_null(formattedRecord);
+    assert_string_equal(
+            "timestamp=1970-01-01T00:00:00Z level=WARNING logger=EXPECTED_LOGGER_NAME file=EXPECTED_FILE line=42 "
+                    "function=EXPECTED_FUNCTION message=EXPECTED_MESSAGE\n",
+            formattedRecord
+    );
+    assert_equal(strlen(formattedRecord), Logger_Formatter_sizeFormattedRecord(context->sut, formattedRecord));
+    Logger_Formatter_deleteFormattedRecord(context->sut, formattedRecord);
+}
+
+FeatureDefine(LogfmtQuoting) {
+    Context_T context = traits_context;
+    const char *EXPECTED_MESSAGES[][2] = {
+            {"",                          "message=\"\""},
+            {"unquoted/path-1.0",         "message=unquoted/path-1.0"},
+            {"two words",                 "message=\"two words\""},
+            {"key=value",                 "message=\"key=value\""},
+            {"say \"hi\"\\now",           "message=\"say \\\"hi\\\"\\\\now\""},
+            {"tab\tnewline\nbell\a",      "message=\"tab\\tnewline\\nbell\\u0007\""},
+            /* long enough to cross several vector-sized chunks */
+            {"0123456789abcdef0123456789abcdef0123456789abcdef",
+                    "message=0123456789abcdef0123456789abcdef0123456789abcdef"},
+            {"0123456789abcdef0123456789abcdef0123456789abcd=f",
+                    "message=\"0123456789abcdef0123456789abcdef0123456789abcd=f\""},
+    };
+
+    for (size_t i = 0; i < sizeof(EXPECTED_MESSAGES) / sizeof(EXPECTED_MESSAGES[0]); i++) {
+        Logger_String_T message = Logger_Record_getMessage(context->RECORD);
+        Logger_String_delete(&message);
+        message = Logger_String_new(EXPECTED_MESSAGES[i][0]);
+        assert_not_null(message);
+        Logger_Record_setMessage(context->RECORD, message);
+
+        char *formattedRecord = Logger_Formatter_formatRecord(context->sut, context->RECORD);
+        assert_not_null(formattedRecord);
+        const char *actual = strstr(formattedRecord, " message=") + 1;
+        assert_equal(strlen(EXPECTED_MESSAGES[i][1]) + 1, strlen(actual));
+        assert_equal(0, strncmp(EXPECTED_MESSAGES[i][1], actual, strlen(EXPECTED_MESSAGES[i][1])));
+        Logger_Formatter_deleteFormattedRecord(context->sut, formattedRecord);
+    }
+}
+
+FeatureDefine(LogfmtFields) {
+    Context_T context = traits_context;
+    const Logger_Field_T ODD_KEY[] = {LOGGER_STR("odd key=", ""), LOGGER_STR("str", NULL)};
+
+    Helper_setFields(context->RECORD);
+    char *formattedRecord = Logger_Formatter_formatRecord(context->sut, context->RECORD);
+    assert_not_null(formattedRecord);
+    assert_not_null(strstr(
+            formattedRecord,
+            " message=EXPECTED_MESSAGE int=-42 uint=42 double=0.5 bool=true str=\"a \\\"quoted\\\" value\"\n"
+    ));
+    Logger_Formatter_deleteFormattedRecord(context->sut, formattedRecord);
+
+    Logger_Record_setFields(context->RECORD, ODD_KEY, 2);
+    formattedRecord = Logger_Formatter_formatRecord(context->sut, context->RECORD);
+    assert_not_null(formattedRecord);
+    assert_not_null(strstr(formattedRecord, " message=EXPECTED_MESSAGE odd_key_=\"\" str=(null)\n"));
+    Logger_Formatter_deleteFormattedRecord(context->sut, formattedRecord);
+}
+
+FeatureDefine(LogfmtMdc) {
+    Context_T context = traits_context;
+    Helper_setMdc(context->RECORD);
+    char *formattedRecord = Logger_Formatter_formatRecord(context->sut, context->RECORD);
+    assert_not_null(formattedRecord);
+    assert_not_null(strstr(
+            formattedRecord, " message=EXPECTED_MESSAGE request=42 tenant=\"a \\\"quoted\\\" value\"\n"
+    ));
+    Logger_Formatter_deleteFormattedRecord(context->sut, formattedRecord);
+    Logger_Mdc_clear();
+}
+
+FeatureDefine(BinaryFormat) {
+    Context_T context = traits_context;
+    size_t offset = 0, payloadSize = 0, expectedOffset = 0;
+    uint64_t value = 0;
+
+    char *formattedRecord = Logger_Formatter_formatRecord(context->sut, context->RECORD);
+    assert_not_null(formattedRecord);
+    const unsigned char *data = (const unsigned char *) formattedRecord;
+    const size_t size = Logger_Formatter_sizeFormattedRecord(context->sut, formattedRecord);
+
+    /* epoch and the three definitions come first */
+    assert_equal(LOGGER_BINARY_FRAME_EPOCH, Helper_nextFrame(data, size, &offset, &payloadSize));
+    offset += payloadSize;
+    const char *EXPECTED_DEFINITIONS[] = {
+            Logger_Record_getLoggerName(context->RECORD),
+            Logger_Record_getFile(context->RECORD),
+            Logger_Record_getFunction(context->RECORD)
+    };
+    for (size_t i = 0; i < 3; i++) {
+        assert_equal(LOGGER_BINARY_FRAME_DEFINITION, Helper_nextFrame(data, size, &offset, &payloadSize));
+        expectedOffset = offset + payloadSize;
+        offset += Logger_Binary_decodeVarint(data + offset, size - offset, &value);
+        assert_equal(Logger_Intern_getId(EXPECTED_DEFINITIONS[i]), value);
+        assert_equal(strlen(EXPECTED_DEFINITIONS[i]), expectedOffset - offset);
+        assert_equal(0, memcmp(EXPECTED_DEFINITIONS[i], data + offset, expectedOffset - offset));
+        offset = expectedOffset;
+    }
+
+    assert_equal(LOGGER_BINARY_FRAME_RECORD, Helper_nextFrame(data, size, &offset, &payloadSize));
+    expectedOffset = offset + payloadSize;
+    offset += Logger_Binary_decodeVarint(data + offset, size - offset, &value);
+    assert_equal(LOGGER_LEVEL_WARNING, value);
+    offset += Logger_Binary_decodeVarint(data + offset, size - offset, &value);
+    assert_equal(42, value);
+    offset = expectedOffset - strlen("EXPECTED_MESSAGE");
+    assert_equal(0, memcmp("EXPECTED_MESSAGE", data + offset, expectedOffset - offset));
+    assert_equal(size, expectedOffset);
+    Logger_Formatter_deleteFormattedRecord(context->sut, formattedRecord);
+
+    /* strings already defined are not emitted again */
+    formattedRecord = Logger_Formatter_formatRecord(context->sut, context->RECORD);
+    assert_not_null(formattedRecord);
+    data = (const unsigned char *) formattedRecord;
+    offset = 0;
+    assert_equal(LOGGER_BINARY_FRAME_RECORD, Helper_nextFrame(data, size, &offset, &payloadSize));
+    assert_equal(Logger_Formatter_sizeFormattedRecord(context->sut, formattedRecord), offset + payloadSize);
+    Logger_Formatter_deleteFormattedRecord(context->sut, formattedRecord);
+}
+
+FeatureDefine(BinaryFields) {
+    Context_T context = traits_context;
+    size_t offset = 0, payloadSize = 0;
+    uint64_t value = 0;
+    int64_t signedValue = 0;
+
+    Helper_setFields(context->RECORD);
+    char *formattedRecord = Logger_Formatter_formatRecord(context->sut, context->RECORD);
+    assert_not_null(formattedRecord);
+    const unsigned char *data = (const unsigned char *) formattedRecord;
+    const size_t size = Logger_Formatter_sizeFormattedRecord(context->sut, formattedRecord);
+
+    /* skip epoch and definitions, the fields frame comes right before the record */
+    int type = 0;
+    while (LOGGER_BINARY_FRAME_FIELDS != (type = Helper_nextFrame(data, size, &offset, &payloadSize))) {
+        assert_not_equal(LOGGER_BINARY_FRAME_RECORD, type);
+        offset += payloadSize;
+    }
+    const size_t expectedOffset = offset + payloadSize;
+    offset += Logger_Binary_decodeVarint(data + offset, size - offset, &value);
+    assert_equal(5, value);
+
+    offset += Logger_Binary_decodeVarint(data + offset, size - offset, &value);
+    assert_equal(0, memcmp("int", data + offset, value));
+    offset += value;
+    assert_equal(LOGGER_FIELD_TYPE_INT, data[offset++]);
+    offset += Logger_Binary_decodeSignedVarint(data + offset, size - offset, &signedValue);
+    assert_equal(-42, signedValue);
+
+    offset += Logger_Binary_decodeVarint(data + offset, size - offset, &value);
+    offset += value;
+    assert_equal(LOGGER_FIELD_TYPE_UINT, data[offset++]);
+    offset += Logger_Binary_decodeVarint(data + offset, size - offset, &value);
+    assert_equal(42, value);
+
+    offset += Logger_Binary_decodeVarint(data + offset, size - offset, &value);
+    offset += value;
+    assert_equal(LOGGER_FIELD_TYPE_DOUBLE, data[offset++]);
+    assert_equal(0x3F, data[offset + 7]);   /* 0.5 is 0x3FE0000000000000 */
+    assert_equal(0xE0, data[offset + 6]);
+    offset += 8;
+
+    offset += Logger_Binary_decodeVarint(data + offset, size - offset, &value);
+    offset += value;
+    assert_equal(LOGGER_FIELD_TYPE_BOOL, data[offset++]);
+    assert_equal(1, data[offset++]);
+
+    offset += Logger_Binary_decodeVarint(data + offset, size - offset, &value);
+    offset += value;
+    assert_equal(LOGGER_FIELD_TYPE_STR, data[offset++]);
+    offset += Logger_Binary_decodeVarint(data + offset, size - offset, &value);
+    assert_equal(strlen(gFields[4].value.asStr), value);
+    assert_equal(0, memcmp(gFields[4].value.asStr, data + offset, value));
+    assert_equal(expectedOffset, offset + value);
+
+    offset = expectedOffset;
+    assert_equal(LOGGER_BINARY_FRAME_RECORD, Helper_nextFrame(data, size, &offset, &payloadSize));
+    Logger_Formatter_deleteFormattedRecord(context->sut, formattedRecord);
+
+    /* a NULL string is written as "(null)" */
+    const Logger_Field_T NULL_STR[] = {LOGGER_STR("str", NULL)};
+    Logger_Record_setFields(context->RECORD, NULL_STR, 1);
+    formattedRecord = Logger_Formatter_formatRecord(context->sut, context->RECORD);
+    assert_not_null(formattedRecord);
+    data = (const unsigned char *) formattedRecord;
+    const size_t nullSize = Logger_Formatter_sizeFormattedRecord(context->sut, formattedRecord);
+    offset = 0;
+    while (LOGGER_BINARY_FRAME_FIELDS != (type = Helper_nextFrame(data, nullSize, &offset, &payloadSize))) {
+        offset += payloadSize;
+    }
+    offset += Logger_Binary_decodeVarint(data + offset, nullSize - offset, &value);
+    assert_equal(1, value);
+    offset += Logger_Binary_decodeVarint(data + offset, nullSize - offset, &value);
+    offset += value;
+    assert_equal(LOGGER_FIELD_TYPE_STR, data[offset++]);
+    offset += Logger_Binary_decodeVarint(data + offset, nullSize - offset, &value);
+    assert_equal(strlen("(null)"), value);
+    assert_equal(0, memcmp("(null)", data + offset, value));
+    Logger_Formatter_deleteFormattedRecord(context->sut, formattedRecord);
+}
+
+FeatureDefine(BinaryFullTable) {
+    Context_T context = traits_context;
+    size_t offset = 0, payloadSize = 0;
+    uint64_t value = 0;
+    int64_t delta = 0;
+    char str[32];
+
+    for (size_t i = 0; Logger_Intern_getSize() < LOGGER_INTERN_CAPACITY; i++) {
+        snprintf(str, sizeof(str), "EXPECTED_STRING_%zu", i);
+        assert_not_equal(LOGGER_INTERN_NO_ID, Logger_Intern_getId(str));
+    }
+
+    /* strings that no longer fit are written without a definition, the record is not lost */
+    char *formattedRecord = Logger_Formatter_formatRecord(context->sut, context->RECORD);
+    assert_not_null(formattedRecord);
+    const unsigned char *data = (const unsigned char *) formattedRecord;
+    const size_t size = Logger_Formatter_sizeFormattedRecord(context->sut, formattedRecord);
+    assert_equal(LOGGER_BINARY_FRAME_EPOCH, Helper_nextFrame(data, size, &offset, &payloadSize));
+    offset += payloadSize;
+    assert_equal(LOGGER_BINARY_FRAME_RECORD, Helper_nextFrame(data, size, &offset, &payloadSize));
+    offset += Logger_Binary_decodeVarint(data + offset, size - offset, &value);
+    offset += Logger_Binary_decodeVarint(data + offset, size - offset, &value);
+    offset += Logger_Binary_decodeSignedVarint(data + offset, size - offset, &delta);
+    for (size_t i = 0; i < 3; i++) {
+        offset += Logger_Binary_decodeVarint(data + offset, size - offset, &value);
+        assert_equal(LOGGER_INTERN_NO_ID, value);
+    }
+    Logger_Formatter_deleteFormattedRecord(context->sut, formattedRecord);
+}
+
+FeatureDefine(BinaryDefinitionsPrecedeRecords) {
+    Context_T context = traits_context;
+    size_t offset = 0, payloadSize = 0;
+    pthread_t thread;
+    void *definitions = NULL;
+
+    /* until the first record is deleted, a record formatted by another thread may reach the stream before it */
+    char *formattedRecord = Logger_Formatter_formatRecord(context->sut, context->RECORD);
+    assert_not_null(formattedRecord);
+    assert_equal(0, pthread_create(&thread, NULL, Helper_countDefinitionsThread, context));
+    assert_equal(0, pthread_join(thread, &definitions));
+    assert_equal(3, *(size_t *) definitions);
+    Logger_Formatter_deleteFormattedRecord(context->sut, formattedRecord);
+
+    /* the definitions are part of the stream now */
+    formattedRecord = Logger_Formatter_formatRecord(context->sut, context->RECORD);
+    assert_not_null(formattedRecord);
+    const unsigned char *data = (const unsigned char *) formattedRecord;
+    const size_t size = Logger_Formatter_sizeFormattedRecord(context->sut, formattedRecord);
+    assert_equal(LOGGER_BINARY_FRAME_RECORD, Helper_nextFrame(data, size, &offset, &payloadSize));
+    Logger_Formatter_deleteFormattedRecord(context->sut, formattedRecord);
+
+    /* a reset starts a new scope, its epoch frame is not a repeat of the previous one */
+    uint64_t scope = 0, resetScope = 0;
+    Logger_Formatter_reset(context->sut);
+    assert_equal(3, Helper_countDefinitions(context, &scope));
+    Logger_Formatter_reset(context->sut);
+    assert_equal(3, Helper_countDefinitions(context, &resetScope));
+    assert_not_equal(scope, resetScope);
+}
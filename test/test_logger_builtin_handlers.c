@@ -0,0 +1,588 @@
+/*
+ * C Source File
+ *
+ * Author: daddinuz
+ * email:  daddinuz@gmail.com
+ * Date:   October 19, 2026
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/wait.h>
+#include "traits/traits.h"
+#include "traits-unit/traits-unit.h"
+#include "logger_binary.h"
+#include "logger_builtin_formatters.h"
+#include "logger_builtin_handlers.h"
+
+/*
+ * Define globals
+ */
+static size_t gPublishCalls = 0;
+static size_t gFlushCalls = 0;
+static size_t gCloseCalls = 0;
+static char gLastMessage[64] = "";
+
+/*
+ * Define context
+ */
+typedef struct Context_T {
+    Logger_Record_T RECORD;
+    Logger_Handler_T sut;
+} *Context_T;
+
+/*
+ * Declare callbacks
+ */
+static Logger_Err_T publishCallback(Logger_Handler_T handler, Logger_Record_T record);
+static void flushCallback(Logger_Handler_T handler);
+static void closeCallback(Logger_Handler_T handler);
+
+/*
+ * Declare setups
+ */
+SetupDeclare(SetupDedupHandler);
+
+/*
+ * Declare teardowns
+ */
+TeardownDeclare(TeardownDedupHandler);
+
+/*
+ * Declare fixtures
+ */
+FixtureDeclare(FixtureDedupHandler);
+
+/*
+ * Declare features
+ */
+FeatureDeclare(DedupCollapsesRepeats);
+FeatureDeclare(DedupFlushesPendingRepeats);
+FeatureDeclare(DedupSummarizesAfterTimeout);
+FeatureDeclare(CompressedFileRoundTrip);
+FeatureDeclare(CompressedFileReportsWriteErrors);
+FeatureDeclare(RotatedFilesAreArchived);
+FeatureDeclare(RotatedFilesSurviveRestart);
+FeatureDeclare(RotatedBinaryFilesStandAlone);
+FeatureDeclare(AppendedBinaryRunsDecode);
+
+/*
+ * Describe the test case
+ */
+Describe("LoggerBuiltinHandlers",
+         Trait(
+                 "Dedup",
+                 Run(DedupCollapsesRepeats, FixtureDedupHandler),
+                 Run(DedupFlushesPendingRepeats, FixtureDedupHandler),
+                 Run(DedupSummarizesAfterTimeout, FixtureDedupHandler)
+         ),
+         Trait(
+                 "Compressed",
+                 Run(CompressedFileRoundTrip, FixtureDedupHandler),
+                 Run(CompressedFileReportsWriteErrors, FixtureDedupHandler),
+                 Run(RotatedFilesAreArchived, FixtureDedupHandler),
+                 Run(RotatedFilesSurviveRestart, FixtureDedupHandler)
+         ),
+         Trait(
+                 "Rotating",
+                 Run(RotatedBinaryFilesStandAlone, FixtureDedupHandler)
+         ),
+         Trait(
+                 "File",
+                 Run(AppendedBinaryRunsDecode, FixtureDedupHandler)
+         )
+)
+
+/*
+ * Define callbacks
+ */
+Logger_Err_T publishCallback(Logger_Handler_T handler, Logger_Record_T record) {
+    assert_not_null(handler);
+    assert_not_null(record);
+    __atomic_add_fetch(&gPublishCalls, 1, __ATOMIC_RELAXED);  /* also called by the dedup timer */
+    strncpy(gLastMessage, Logger_Record_getMessage(record), sizeof(gLastMessage) - 1);
+    return LOGGER_ERR_OK;
+}
+
+void flushCallback(Logger_Handler_T handler) {
+    assert_not_null(handler);
+    gFlushCalls++;
+}
+
+void closeCallback(Logger_Handler_T handler) {
+    assert_not_null(handler);
+    gCloseCalls++;
+}
+
+/*
+ * Define helpers
+ */
+
+/*
+ * Append one record of loggerName to filePath from a new process, as a later run of the program would:
+ * its interning table starts empty, so the ids of different runs overlap.
+ */
+static void Helper_appendBinaryRun(const char *filePath, const char *loggerName) {
+    const pid_t pid = fork();
+    assert_not_equal(-1, pid);
+    if (0 == pid) {
+        Logger_String_T message = Logger_String_new(loggerName);
+        Logger_Record_T record = Logger_Record_new(
+                loggerName, LOGGER_LEVEL_ERROR, "EXPECTED_FILE", 42, "EXPECTED_FUNCTION", 0, message
+        );
+        Logger_Formatter_T formatter = Logger_Formatter_newBinaryFormatter();
+        Logger_Handler_Result_T result = Logger_Handler_newFileHandler(LOGGER_LEVEL_DEBUG, formatter, filePath);
+        const bool published = LOGGER_ERR_OK == result.err &&
+                               LOGGER_ERR_OK == Logger_Handler_publish(result.handler, record);
+        Logger_Handler_delete(&result.handler);
+        _exit(published ? EXIT_SUCCESS : EXIT_FAILURE);
+    }
+    int status = 0;
+    assert_equal(pid, waitpid(pid, &status, 0));
+    assert_true(WIFEXITED(status));
+    assert_equal(EXIT_SUCCESS, WEXITSTATUS(status));
+}
+
+/*
+ * Decode the blocks of a compressed file, returning the decoded content (to be freed, NUL terminated) and its size.
+ */
+static char *Helper_decompressFile(const char *path, size_t *size, size_t *blocks) {
+    unsigned char headerBytes[LOGGER_COMPRESS_HEADER_SIZE];
+    char *content = NULL;
+    FILE *file = fopen(path, "rb");
+    assert_not_null(file);
+    *size = 0;
+    *blocks = 0;
+    while (sizeof(headerBytes) == fread(headerBytes, 1, sizeof(headerBytes), file)) {
+        Logger_Compress_Header_T header;
+        assert_true(Logger_Compress_readHeader(headerBytes, &header));
+        void *payload = malloc(header.size);
+        content = realloc(content, *size + header.rawSize + 1);
+        assert_not_null(payload);
+        assert_not_null(content);
+        assert_equal(header.size, fread(payload, 1, header.size, file));
+        assert_true(Logger_Compress_decodeBlock(&header, payload, content + *size));
+        *size += header.rawSize;
+        (*blocks)++;
+        free(payload);
+    }
+    fclose(file);
+    if (content) {
+        content[*size] = '\0';
+    }
+    return content;
+}
+
+/*
+ * Define setups
+ */
+SetupDefine(SetupDedupHandler) {
+    gPublishCalls = 0;
+    gFlushCalls = 0;
+    gCloseCalls = 0;
+    Context_T context = malloc(sizeof(*context));
+    assert_not_null(context);
+    context->RECORD = Logger_Record_new(
+            "EXPECTED_LOGGER_NAME", LOGGER_LEVEL_ERROR, "EXPECTED_FILE", 42, "EXPECTED_FUNCTION", 0,
+            Logger_String_new("EXPECTED_MESSAGE")
+    );
+    assert_not_null(context->RECORD);
+    Logger_Handler_T handler = Logger_Handler_new(publishCallback, flushCallback, closeCallback);
+    assert_not_null(handler);
+    Logger_Handler_Result_T result = Logger_Handler_newDedupHandler(handler, 0);
+    assert_equal(LOGGER_ERR_OK, result.err);
+    assert_not_null(result.handler);
+    context->sut = result.handler;
+    return context;
+}
+
+/*
+ * Define teardowns
+ */
+TeardownDefine(TeardownDedupHandler) {
+    assert_not_null(traits_context);
+    Context_T context = traits_context;
+    Logger_String_T message = Logger_Record_getMessage(context->RECORD);
+    Logger_String_delete(&message);
+    Logger_Record_delete(&context->RECORD);
+    assert_null(context->RECORD);
+    if (context->sut) {
+        Logger_Handler_delete(&context->sut);
+    }
+    free(context);
+}
+
+/*
+ * Define fixtures
+ */
+FixtureDefine(FixtureDedupHandler, SetupDedupHandler, TeardownDedupHandler);
+
+/*
+ * Define features
+ */
+FeatureDefine(DedupCollapsesRepeats) {
+    Context_T context = traits_context;
+
+    for (size_t i = 0; i < 5; i++) {
+        assert_equal(LOGGER_ERR_OK, Logger_Handler_publish(context->sut, context->RECORD));
+    }
+    assert_equal(1, gPublishCalls);
+    assert_string_equal("EXPECTED_MESSAGE", gLastMessage);
+
+    /* a different level breaks the run */
+    Logger_Record_setLevel(context->RECORD, LOGGER_LEVEL_FATAL);
+    assert_equal(LOGGER_ERR_OK, Logger_Handler_publish(context->sut, context->RECORD));
+    assert_equal(3, gPublishCalls);
+    assert_string_equal("EXPECTED_MESSAGE", gLastMessage);
+
+    Logger_String_T message = Logger_Record_getMessage(context->RECORD);
+    Logger_String_delete(&message);
+    Logger_Record_setMessage(context->RECORD, Logger_String_new("ANOTHER_MESSAGE"));
+    assert_equal(LOGGER_ERR_OK, Logger_Handler_publish(context->sut, context->RECORD));
+    assert_equal(4, gPublishCalls);
+    assert_string_equal("ANOTHER_MESSAGE", gLastMessage);
+
+    /* a NULL string field differs from an empty one */
+    const Logger_Field_T NULL_STR[] = {LOGGER_STR("str", NULL)};
+    const Logger_Field_T EMPTY_STR[] = {LOGGER_STR("str", "")};
+    Logger_Record_setFields(context->RECORD, NULL_STR, 1);
+    assert_equal(LOGGER_ERR_OK, Logger_Handler_publish(context->sut, context->RECORD));
+    assert_equal(LOGGER_ERR_OK, Logger_Handler_publish(context->sut, context->RECORD));
+    assert_equal(5, gPublishCalls);
+    Logger_Record_setFields(context->RECORD, EMPTY_STR, 1);
+    assert_equal(LOGGER_ERR_OK, Logger_Handler_publish(context->sut, context->RECORD));
+    assert_equal(7, gPublishCalls);
+    Logger_Record_setFields(context->RECORD, NULL, 0);
+}
+
+FeatureDefine(DedupFlushesPendingRepeats) {
+    Context_T context = traits_context;
+
+    for (size_t i = 0; i < 3; i++) {
+        assert_equal(LOGGER_ERR_OK, Logger_Handler_publish(context->sut, context->RECORD));
+    }
+    assert_equal(1, gPublishCalls);
+
+    Logger_Handler_flush(context->sut);
+    assert_equal(2, gPublishCalls);
+    assert_equal(1, gFlushCalls);
+    assert_string_equal("last message repeated 2 times", gLastMessage);
+
+    /* nothing pending anymore, the wrapped handler is closed along with the wrapper */
+    Logger_Handler_delete(&context->sut);
+    assert_null(context->sut);
+    assert_equal(2, gPublishCalls);
+    assert_equal(1, gCloseCalls);
+}
+
+FeatureDefine(DedupSummarizesAfterTimeout) {
+    Context_T context = traits_context;
+    Logger_Handler_T handler = Logger_Handler_new(publishCallback, flushCallback, closeCallback);
+    assert_not_null(handler);
+    Logger_Handler_Result_T result = Logger_Handler_newDedupHandler(handler, 10);
+    assert_equal(LOGGER_ERR_OK, result.err);
+
+    for (size_t i = 0; i < 3; i++) {
+        assert_equal(LOGGER_ERR_OK, Logger_Handler_publish(result.handler, context->RECORD));
+    }
+    /* no record arrives after the run, the timer summarizes it */
+    for (size_t i = 0; i < 1000 && __atomic_load_n(&gPublishCalls, __ATOMIC_RELAXED) < 2; i++) {
+        usleep(1000);
+    }
+    assert_equal(2, __atomic_load_n(&gPublishCalls, __ATOMIC_RELAXED));
+    assert_equal(0, gFlushCalls);
+
+    Logger_Handler_delete(&result.handler);
+    assert_equal(2, gPublishCalls);
+    assert_equal(1, gCloseCalls);
+    assert_string_equal("last message repeated 2 times", gLastMessage);
+}
+
+FeatureDefine(CompressedFileRoundTrip) {
+    Context_T context = traits_context;
+    const size_t RECORDS = 200;
+    const size_t BLOCK_SIZE = 64;  /* smaller than a record, which then spans blocks */
+    const Logger_Compress_Codec_T CODECS[] = {LOGGER_COMPRESS_CODEC_LZ, LOGGER_COMPRESS_CODEC_ZLIB};
+    char filePath[] = "/tmp/logger_compressed_XXXXXX";
+    const int fd = mkstemp(filePath);
+    assert_greater_equal(fd, 0);
+    close(fd);
+
+    Logger_Formatter_T formatter = Logger_Formatter_newSimpleFormatter();
+    assert_not_null(formatter);
+    char *formatted = Logger_Formatter_formatRecord(formatter, context->RECORD);
+    assert_not_null(formatted);
+    const size_t lineSize = Logger_Formatter_sizeFormattedRecord(formatter, formatted);
+    assert_greater(lineSize, BLOCK_SIZE);
+    char *line = malloc(lineSize);
+    assert_not_null(line);
+    memcpy(line, formatted, lineSize);
+    Logger_Formatter_deleteFormattedRecord(formatter, formatted);
+
+    for (size_t i = 0; i < sizeof(CODECS) / sizeof(CODECS[0]); i++) {
+        Logger_Handler_Result_T result = Logger_Handler_newCompressedFileHandler(
+                LOGGER_LEVEL_DEBUG, formatter, filePath, CODECS[i], (i + 1) * BLOCK_SIZE * 32
+        );
+        if (LOGGER_COMPRESS_CODEC_ZLIB == CODECS[i] && !Logger_Compress_hasZlib()) {
+            assert_equal(LOGGER_ERR_INVALID_CONFIG, result.err);
+            assert_null(result.handler);
+            continue;
+        }
+        assert_equal(LOGGER_ERR_OK, result.err);
+        for (size_t j = 0; j < RECORDS; j++) {
+            assert_equal(LOGGER_ERR_OK, Logger_Handler_publish(result.handler, context->RECORD));
+        }
+        Logger_Handler_delete(&result.handler);
+
+        size_t size = 0;
+        size_t blocks = 0;
+        char *content = Helper_decompressFile(filePath, &size, &blocks);
+        assert_equal(RECORDS * lineSize, size);
+        assert_greater(blocks, 1);
+        for (size_t j = 0; j < RECORDS; j++) {
+            assert_equal(0, memcmp(line, content + j * lineSize, lineSize));
+        }
+        free(content);
+
+        /* repeated records compress well */
+        FILE *file = fopen(filePath, "rb");
+        assert_not_null(file);
+        assert_equal(0, fseek(file, 0, SEEK_END));
+        assert_less(ftell(file) * 4, (long) size);
+        fclose(file);
+        assert_equal(0, truncate(filePath, 0));  /* the handler appends */
+    }
+
+    /* a record larger than the block spans several of them */
+    Logger_Handler_Result_T result = Logger_Handler_newCompressedFileHandler(
+            LOGGER_LEVEL_DEBUG, formatter, filePath, LOGGER_COMPRESS_CODEC_LZ, BLOCK_SIZE
+    );
+    assert_equal(LOGGER_ERR_OK, result.err);
+    assert_equal(LOGGER_ERR_OK, Logger_Handler_publish(result.handler, context->RECORD));
+    Logger_Handler_flush(result.handler);
+    size_t size = 0;
+    size_t blocks = 0;
+    char *content = Helper_decompressFile(filePath, &size, &blocks);
+    assert_equal(lineSize, size);
+    assert_equal((lineSize + BLOCK_SIZE - 1) / BLOCK_SIZE, blocks);
+    assert_equal(0, memcmp(line, content, lineSize));
+    free(content);
+    Logger_Handler_delete(&result.handler);
+
+    assert_equal(LOGGER_ERR_NO_ENTITY, Logger_Handler_newCompressedFileHandler(
+            LOGGER_LEVEL_DEBUG, formatter, "/tmp/logger_compressed_missing/file", LOGGER_COMPRESS_CODEC_LZ, BLOCK_SIZE
+    ).err);
+    unlink(filePath);
+    free(line);
+    Logger_Formatter_delete(&formatter);
+}
+
+FeatureDefine(CompressedFileReportsWriteErrors) {
+    Context_T context = traits_context;
+    Logger_Formatter_T formatter = Logger_Formatter_newSimpleFormatter();
+    assert_not_null(formatter);
+
+    /* every write of the worker fails */
+    Logger_Handler_Result_T result = Logger_Handler_newCompressedFileHandler(
+            LOGGER_LEVEL_DEBUG, formatter, "/dev/full", LOGGER_COMPRESS_CODEC_LZ, 4096
+    );
+    assert_equal(LOGGER_ERR_OK, result.err);
+
+    /* the record waits in the block being filled until the flush hands it to the worker */
+    assert_equal(LOGGER_ERR_OK, Logger_Handler_publish(result.handler, context->RECORD));
+    assert_equal(0, Logger_Handler_getStats(result.handler).errors);
+    Logger_Handler_flush(result.handler);
+    assert_equal(1, Logger_Handler_getStats(result.handler).errors);
+
+    /* the flush already reported it, the next publish does not */
+    assert_equal(LOGGER_ERR_OK, Logger_Handler_publish(result.handler, context->RECORD));
+    assert_equal(1, Logger_Handler_getStats(result.handler).errors);
+    Logger_Handler_delete(&result.handler);
+
+    /* records spanning several blocks wait for the worker, which already failed when publish returns */
+    result = Logger_Handler_newCompressedFileHandler(
+            LOGGER_LEVEL_DEBUG, formatter, "/dev/full", LOGGER_COMPRESS_CODEC_LZ, 8
+    );
+    assert_equal(LOGGER_ERR_OK, result.err);
+    assert_equal(LOGGER_ERR_IO, Logger_Handler_publish(result.handler, context->RECORD));
+    assert_equal(1, Logger_Handler_getStats(result.handler).errors);
+    Logger_Handler_delete(&result.handler);
+    Logger_Formatter_delete(&formatter);
+}
+
+FeatureDefine(RotatedFilesAreArchived) {
+    Context_T context = traits_context;
+    const size_t RECORDS_PER_FILE = 10;
+    const size_t FILES = 5;
+    char directory[] = "/tmp/logger_archived_XXXXXX";
+    char filePath[64];
+    char rotatedFilePath[80];
+    assert_not_null(mkdtemp(directory));
+    snprintf(filePath, sizeof(filePath), "%s/app.log", directory);
+
+    Logger_Formatter_T formatter = Logger_Formatter_newSimpleFormatter();
+    assert_not_null(formatter);
+    char *formatted = Logger_Formatter_formatRecord(formatter, context->RECORD);
+    assert_not_null(formatted);
+    const size_t lineSize = Logger_Formatter_sizeFormattedRecord(formatter, formatted);
+    Logger_Formatter_deleteFormattedRecord(formatter, formatted);
+
+    Logger_Archiver_Result_T archiverResult = Logger_Archiver_new(LOGGER_COMPRESS_CODEC_LZ, 2, FILES);
+    assert_equal(LOGGER_ERR_OK, archiverResult.err);
+    Logger_Handler_Result_T result = Logger_Handler_newArchivingRotatingFileHandler(
+            LOGGER_LEVEL_DEBUG, formatter, filePath, RECORDS_PER_FILE * lineSize, archiverResult.archiver
+    );
+    assert_equal(LOGGER_ERR_OK, result.err);
+    for (size_t i = 0; i < FILES * RECORDS_PER_FILE; i++) {
+        assert_equal(LOGGER_ERR_OK, Logger_Handler_publish(result.handler, context->RECORD));
+    }
+    Logger_Handler_delete(&result.handler);
+    Logger_Archiver_wait(archiverResult.archiver);
+    const Logger_Archiver_Stats_T stats = Logger_Archiver_getStats(archiverResult.archiver);
+    assert_equal(FILES - 1, stats.archived);
+    assert_equal(0, stats.failed);
+    assert_equal(0, stats.dropped);
+    Logger_Archiver_delete(&archiverResult.archiver);
+    assert_null(archiverResult.archiver);
+
+    /* every file but the last one is replaced by its compressed copy */
+    for (size_t i = 0; i < FILES - 1; i++) {
+        snprintf(rotatedFilePath, sizeof(rotatedFilePath), "%s.%zu", filePath, i);
+        assert_not_equal(0, access(rotatedFilePath, F_OK));
+        snprintf(rotatedFilePath, sizeof(rotatedFilePath), "%s.%zu.lgz", filePath, i);
+        size_t size = 0;
+        size_t blocks = 0;
+        char *content = Helper_decompressFile(rotatedFilePath, &size, &blocks);
+        assert_equal(RECORDS_PER_FILE * lineSize, size);
+        free(content);
+        unlink(rotatedFilePath);
+    }
+    snprintf(rotatedFilePath, sizeof(rotatedFilePath), "%s.%zu", filePath, FILES - 1);
+    assert_equal(0, access(rotatedFilePath, F_OK));
+    unlink(rotatedFilePath);
+    assert_equal(0, rmdir(directory));
+    Logger_Formatter_delete(&formatter);
+}
+
+FeatureDefine(RotatedFilesSurviveRestart) {
+    Context_T context = traits_context;
+    const size_t RECORDS_PER_RUN = 3;
+    const size_t RUNS = 2;
+    char directory[] = "/tmp/logger_restarted_XXXXXX";
+    char filePath[64];
+    char rotatedFilePath[80];
+    assert_not_null(mkdtemp(directory));
+    snprintf(filePath, sizeof(filePath), "%s/app.log", directory);
+
+    Logger_Formatter_T formatter = Logger_Formatter_newSimpleFormatter();
+    assert_not_null(formatter);
+    Logger_Archiver_Result_T archiverResult = Logger_Archiver_new(LOGGER_COMPRESS_CODEC_LZ, 1, RECORDS_PER_RUN);
+    assert_equal(LOGGER_ERR_OK, archiverResult.err);
+    for (size_t i = 0; i < RUNS; i++) {
+        Logger_Handler_Result_T result = Logger_Handler_newArchivingRotatingFileHandler(
+                LOGGER_LEVEL_DEBUG, formatter, filePath, 1, archiverResult.archiver  /* one record per file */
+        );
+        assert_equal(LOGGER_ERR_OK, result.err);
+        for (size_t j = 0; j < RECORDS_PER_RUN; j++) {
+            assert_equal(LOGGER_ERR_OK, Logger_Handler_publish(result.handler, context->RECORD));
+        }
+        Logger_Handler_delete(&result.handler);
+        Logger_Archiver_wait(archiverResult.archiver);
+    }
+    const Logger_Archiver_Stats_T stats = Logger_Archiver_getStats(archiverResult.archiver);
+    assert_equal(RUNS * RECORDS_PER_RUN - 1, stats.archived);
+    assert_equal(0, stats.failed);
+    Logger_Archiver_delete(&archiverResult.archiver);
+
+    /* the second run goes on from the last file of the first one, every record is in its own archive */
+    for (size_t i = 0; i < RUNS * RECORDS_PER_RUN - 1; i++) {
+        snprintf(rotatedFilePath, sizeof(rotatedFilePath), "%s.%zu.lgz", filePath, i);
+        size_t size = 0;
+        size_t blocks = 0;
+        char *content = Helper_decompressFile(rotatedFilePath, &size, &blocks);
+        assert_equal(1, blocks);
+        assert_not_null(strstr(content, "EXPECTED_MESSAGE"));
+        assert_null(strstr(strstr(content, "EXPECTED_MESSAGE") + 1, "EXPECTED_MESSAGE"));
+        free(content);
+        unlink(rotatedFilePath);
+    }
+    snprintf(rotatedFilePath, sizeof(rotatedFilePath), "%s.%zu", filePath, RUNS * RECORDS_PER_RUN - 1);
+    assert_equal(0, access(rotatedFilePath, F_OK));
+    unlink(rotatedFilePath);
+    assert_equal(0, rmdir(directory));
+    Logger_Formatter_delete(&formatter);
+}
+
+FeatureDefine(RotatedBinaryFilesStandAlone) {
+    Context_T context = traits_context;
+    const size_t FILES = 3;
+    char directory[] = "/tmp/logger_rotated_XXXXXX";
+    char filePath[64];
+    char rotatedFilePath[80];
+    assert_not_null(mkdtemp(directory));
+    snprintf(filePath, sizeof(filePath), "%s/app.log", directory);
+
+    Logger_Formatter_T formatter = Logger_Formatter_newBinaryFormatter();
+    assert_not_null(formatter);
+    Logger_Handler_Result_T result = Logger_Handler_newRotatingFileHandler(
+            LOGGER_LEVEL_DEBUG, formatter, filePath, 1  /* one record per file */
+    );
+    assert_equal(LOGGER_ERR_OK, result.err);
+    for (size_t i = 0; i < FILES; i++) {
+        assert_equal(LOGGER_ERR_OK, Logger_Handler_publish(result.handler, context->RECORD));
+    }
+    Logger_Handler_delete(&result.handler);
+
+    /* every file starts with the epoch, followed by the definitions of the record */
+    for (size_t i = 0; i < FILES; i++) {
+        unsigned char data[256];
+        uint64_t payloadSize = 0;
+        snprintf(rotatedFilePath, sizeof(rotatedFilePath), "%s.%zu", filePath, i);
+        FILE *file = fopen(rotatedFilePath, "rb");
+        assert_not_null(file);
+        const size_t size = fread(data, 1, sizeof(data), file);
+        fclose(file);
+        size_t offset = Logger_Binary_decodeVarint(data, size, &payloadSize);
+        assert_greater(offset, 0);
+        assert_equal(LOGGER_BINARY_FRAME_EPOCH, data[offset]);
+        offset += (size_t) payloadSize;
+        offset += Logger_Binary_decodeVarint(data + offset, size - offset, &payloadSize);
+        assert_equal(LOGGER_BINARY_FRAME_DEFINITION, data[offset]);
+        unlink(rotatedFilePath);
+    }
+    assert_equal(0, rmdir(directory));
+    Logger_Formatter_delete(&formatter);
+}
+
+FeatureDefine(AppendedBinaryRunsDecode) {
+    (void) traits_context;
+    char directory[] = "/tmp/logger_appended_XXXXXX";
+    char filePath[64];
+    char command[160];
+    char line[256];
+    assert_not_null(mkdtemp(directory));
+    snprintf(filePath, sizeof(filePath), "%s/app.log", directory);
+
+    /* both runs define their logger name with the same id, each epoch frame opens a new scope */
+    Helper_appendBinaryRun(filePath, "FIRST_RUN");
+    Helper_appendBinaryRun(filePath, "SECOND_RUN");
+
+    const char *EXPECTED_LOGGER_NAMES[] = {"FIRST_RUN", "SECOND_RUN"};
+    snprintf(command, sizeof(command), "%s %s", LOGGER_DECODE, filePath);
+    FILE *decoded = popen(command, "r");
+    assert_not_null(decoded);
+    for (size_t i = 0; i < 2; i++) {
+        /* the header line starts with the logger name, the message of the record repeats it */
+        assert_not_null(fgets(line, sizeof(line), decoded));
+        assert_equal(0, strncmp(EXPECTED_LOGGER_NAMES[i], line, strlen(EXPECTED_LOGGER_NAMES[i])));
+        assert_equal(' ', line[strlen(EXPECTED_LOGGER_NAMES[i])]);
+        assert_not_null(fgets(line, sizeof(line), decoded));
+        assert_equal(0, strncmp(EXPECTED_LOGGER_NAMES[i], line, strlen(EXPECTED_LOGGER_NAMES[i])));
+    }
+    assert_null(fgets(line, sizeof(line), decoded));
+    assert_equal(0, pclose(decoded));
+    unlink(filePath);
+    assert_equal(0, rmdir(directory));
+}
@@ -0,0 +1,247 @@
+/*
+ * C Source File
+ *
+ * Author: daddinuz
+ * email:  daddinuz@gmail.com
+ * Date:   October 19, 2026
+ */
+
+#include "traits/traits.h"
+#include "traits-unit/traits-unit.h"
+#include "logger.h"
+
+/*
+ * Define globals
+ */
+static size_t gPublishCalls = 0;
+static size_t gLastSuppressed = 0;
+static size_t gBetaLine = 0;
+
+/*
+ * Declare callbacks
+ */
+static Logger_Err_T publishCallback(Logger_Handler_T handler, Logger_Record_T record);
+static void flushCallback(Logger_Handler_T handler);
+static void closeCallback(Logger_Handler_T handler);
+
+/*
+ * Declare setups
+ */
+SetupDeclare(SetupLoggerCallSite);
+
+/*
+ * Declare teardowns
+ */
+TeardownDeclare(TeardownLoggerCallSite);
+
+/*
+ * Declare fixtures
+ */
+FixtureDeclare(FixtureLoggerCallSite);
+
+/*
+ * Declare features
+ */
+FeatureDeclare(EnableByFunction);
+FeatureDeclare(EnableByLineRange);
+FeatureDeclare(DisableByFileGlob);
+FeatureDeclare(RulesApplyToNewCallSites);
+FeatureDeclare(Sampling);
+FeatureDeclare(RateLimit);
+
+/*
+ * Describe the test case
+ */
+Describe("LoggerCallSite",
+         Trait(
+                 "Dynamic",
+                 Run(EnableByFunction, FixtureLoggerCallSite),
+                 Run(EnableByLineRange, FixtureLoggerCallSite),
+                 Run(DisableByFileGlob, FixtureLoggerCallSite),
+                 Run(RulesApplyToNewCallSites, FixtureLoggerCallSite)
+         ),
+         Trait(
+                 "Limits",
+                 Run(Sampling, FixtureLoggerCallSite),
+                 Run(RateLimit, FixtureLoggerCallSite)
+         )
+)
+
+/*
+ * Define helpers
+ */
+static void Helper_logFromAlpha(Logger_T logger) {
+    Logger_logDebug(logger, "%s", "alpha");
+}
+
+static void Helper_logFromBeta(Logger_T logger) {
+    gBetaLine = __LINE__; Logger_logDebug(logger, "%s", "beta");
+}
+
+static void Helper_logFromGamma(Logger_T logger) {
+    Logger_logDebug(logger, "%s", "gamma");
+}
+
+static void Helper_logFromDelta(Logger_T logger) {
+    Logger_logError(logger, "%s", "delta");
+}
+
+static void Helper_logFromEpsilon(Logger_T logger) {
+    Logger_logError(logger, "%s", "epsilon");
+}
+
+/*
+ * Define callbacks
+ */
+Logger_Err_T publishCallback(Logger_Handler_T handler, Logger_Record_T record) {
+    assert_not_null(handler);
+    assert_not_null(record);
+    gPublishCalls++;
+    gLastSuppressed = Logger_Record_getSuppressed(record);
+    return LOGGER_ERR_OK;
+}
+
+void flushCallback(Logger_Handler_T handler) {
+    assert_not_null(handler);
+}
+
+void closeCallback(Logger_Handler_T handler) {
+    assert_not_null(handler);
+}
+
+/*
+ * Define setups
+ */
+SetupDefine(SetupLoggerCallSite) {
+    gPublishCalls = 0;
+    gLastSuppressed = 0;
+    Logger_T sut = Logger_new("EXPECTED_LOGGER_NAME", LOGGER_LEVEL_INFO);
+    assert_not_null(sut);
+    Logger_Handler_T handler = Logger_Handler_new(publishCallback, flushCallback, closeCallback);
+    assert_not_null(handler);
+    Logger_Handler_setLevel(handler, LOGGER_LEVEL_INFO);
+    assert_equal(handler, Logger_addHandler(sut, handler));
+    return sut;
+}
+
+/*
+ * Define teardowns
+ */
+TeardownDefine(TeardownLoggerCallSite) {
+    assert_not_null(traits_context);
+    Logger_T sut = traits_context;
+    Logger_Handler_T handler = Logger_popHandler(sut);
+    assert_not_null(handler);
+    Logger_Handler_delete(&handler);
+    Logger_delete(&sut);
+    assert_null(sut);
+}
+
+/*
+ * Define fixtures
+ */
+FixtureDefine(FixtureLoggerCallSite, SetupLoggerCallSite, TeardownLoggerCallSite);
+
+/*
+ * Define features
+ */
+FeatureDefine(EnableByFunction) {
+    Logger_T sut = traits_context;
+
+    Helper_logFromAlpha(sut);
+    Helper_logFromBeta(sut);
+    assert_equal(0, gPublishCalls);
+
+    assert_equal(1, Logger_CallSite_enable(NULL, "Helper_logFromAlpha", 0, 0));
+    Helper_logFromAlpha(sut);
+    Helper_logFromBeta(sut);
+    assert_equal(1, gPublishCalls);
+
+    assert_equal(1, Logger_CallSite_reset(NULL, "Helper_logFromAlpha", 0, 0));
+    Helper_logFromAlpha(sut);
+    assert_equal(1, gPublishCalls);
+}
+
+FeatureDefine(EnableByLineRange) {
+    Logger_T sut = traits_context;
+
+    Helper_logFromAlpha(sut);
+    Helper_logFromBeta(sut);
+    assert_equal(0, gPublishCalls);
+
+    assert_equal(1, Logger_CallSite_enable("*test_logger_callsite.c", NULL, gBetaLine, gBetaLine));
+    Helper_logFromAlpha(sut);
+    Helper_logFromBeta(sut);
+    assert_equal(1, gPublishCalls);
+
+    assert_equal(0, Logger_CallSite_enable("*another_file.c", NULL, 0, 0));
+    Helper_logFromAlpha(sut);
+    assert_equal(1, gPublishCalls);
+}
+
+FeatureDefine(DisableByFileGlob) {
+    Logger_T sut = traits_context;
+
+    Helper_logFromDelta(sut);
+    assert_equal(1, gPublishCalls);
+
+    assert_equal(1, Logger_CallSite_disable("*test_logger_callsite.c", NULL, 0, 0));
+    Helper_logFromDelta(sut);
+    assert_equal(1, gPublishCalls);
+
+    assert_equal(1, Logger_CallSite_reset("*test_logger_callsite.c", NULL, 0, 0));
+    Helper_logFromDelta(sut);
+    assert_equal(2, gPublishCalls);
+}
+
+FeatureDefine(RulesApplyToNewCallSites) {
+    Logger_T sut = traits_context;
+
+    assert_equal(0, Logger_CallSite_enable(NULL, "Helper_logFromGamma", 0, 0));
+    Helper_logFromGamma(sut);
+    assert_equal(1, gPublishCalls);
+
+    /* the last matching rule wins */
+    assert_equal(1, Logger_CallSite_disable(NULL, NULL, 0, 0));
+    assert_equal(0, Logger_CallSite_enable(NULL, "Helper_logFromAlpha", 0, 0));
+    Helper_logFromGamma(sut);
+    Helper_logFromAlpha(sut);
+    assert_equal(2, gPublishCalls);
+}
+
+FeatureDefine(Sampling) {
+    Logger_T sut = traits_context;
+
+    Helper_logFromEpsilon(sut);
+    assert_equal(1, gPublishCalls);
+
+    assert_equal(1, Logger_CallSite_setSampling(NULL, "Helper_logFromEpsilon", 0, 0, 3));
+    for (size_t i = 0; i < 7; i++) {
+        Helper_logFromEpsilon(sut);
+    }
+    assert_equal(4, gPublishCalls);
+    assert_equal(2, gLastSuppressed);
+
+    assert_equal(1, Logger_CallSite_setSampling(NULL, "Helper_logFromEpsilon", 0, 0, 0));
+    Helper_logFromEpsilon(sut);
+    Helper_logFromEpsilon(sut);
+    assert_equal(6, gPublishCalls);
+    assert_equal(0, gLastSuppressed);
+}
+
+FeatureDefine(RateLimit) {
+    Logger_T sut = traits_context;
+
+    assert_equal(0, Logger_CallSite_setRateLimit(NULL, "Helper_logFromEpsilon", 0, 0, 1, 2));
+    for (size_t i = 0; i < 5; i++) {
+        Helper_logFromEpsilon(sut);
+    }
+    assert_equal(2, gPublishCalls);
+    assert_equal(0, gLastSuppressed);
+
+    /* the suppressed records are reported by the next record that gets through */
+    assert_equal(1, Logger_CallSite_setRateLimit(NULL, "Helper_logFromEpsilon", 0, 0, 0, 0));
+    Helper_logFromEpsilon(sut);
+    assert_equal(3, gPublishCalls);
+    assert_equal(3, gLastSuppressed);
+}
@@ -0,0 +1,146 @@
+/*
+ * C Source File
+ *
+ * Author: daddinuz
+ * email:  daddinuz@gmail.com
+ * Date:   October 19, 2026
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "traits/traits.h"
+#include "traits-unit/traits-unit.h"
+#include "logger_compress.h"
+
+/*
+ * Declare features
+ */
+FeatureDeclare(RoundTrip);
+FeatureDeclare(StoreIncompressible);
+FeatureDeclare(RejectMalformed);
+
+/*
+ * Describe the test case
+ */
+Describe("LoggerCompress",
+         Trait(
+                 "Basic",
+                 Run(RoundTrip),
+                 Run(StoreIncompressible),
+                 Run(RejectMalformed)
+         )
+)
+
+/*
+ * Define helpers
+ */
+static uint32_t gSeed = 42;
+
+static unsigned char Helper_random(void) {
+    gSeed = gSeed * UINT32_C(1664525) + UINT32_C(1013904223);
+    return (unsigned char) (gSeed >> 24);
+}
+
+/*
+ * Encode data into a block with codec, decode it back and compare, returning the size of the block.
+ */
+static size_t Helper_roundTrip(Logger_Compress_Codec_T codec, const unsigned char *data, size_t size) {
+    unsigned char *block = malloc(LOGGER_COMPRESS_HEADER_SIZE + size);
+    unsigned char *decoded = malloc(size + 1);
+    assert_not_null(block);
+    assert_not_null(decoded);
+
+    const size_t blockSize = Logger_Compress_encodeBlock(codec, data, size, block);
+    Logger_Compress_Header_T header;
+    assert_true(Logger_Compress_readHeader(block, &header));
+    assert_equal(size, header.rawSize);
+    assert_equal(blockSize, LOGGER_COMPRESS_HEADER_SIZE + header.size);
+    assert_true(Logger_Compress_decodeBlock(&header, block + LOGGER_COMPRESS_HEADER_SIZE, decoded));
+    assert_equal(0, memcmp(data, decoded, size));
+
+    free(decoded);
+    free(block);
+    return blockSize;
+}
+
+/*
+ * Define features
+ */
+FeatureDefine(RoundTrip) {
+    (void) traits_context;
+    const size_t SIZE = 256 * 1024;
+    unsigned char *data = malloc(SIZE);
+    assert_not_null(data);
+
+    /* log lines: repeated text with varying numbers, matches far apart and long runs */
+    size_t size = 0;
+    for (size_t i = 0; size + 128 < SIZE; i++) {
+        size += (size_t) snprintf(
+                (char *) data + size, 128, "2026-10-19 12:00:%02zu NOTICE [app] served /index.html in %zu ms\n",
+                i % 60, i * 7 % 1000
+        );
+    }
+    memset(data + size, 'x', SIZE - size);
+
+    const size_t LENGTHS[] = {0, 1, 5, 12, 13, 64, 1000, SIZE};
+    for (size_t i = 0; i < sizeof(LENGTHS) / sizeof(LENGTHS[0]); i++) {
+        Helper_roundTrip(LOGGER_COMPRESS_CODEC_LZ, data, LENGTHS[i]);
+        if (Logger_Compress_hasZlib()) {
+            Helper_roundTrip(LOGGER_COMPRESS_CODEC_ZLIB, data, LENGTHS[i]);
+        }
+    }
+    assert_less(Helper_roundTrip(LOGGER_COMPRESS_CODEC_LZ, data, SIZE) * 5, SIZE);
+    if (Logger_Compress_hasZlib()) {
+        assert_less(Helper_roundTrip(LOGGER_COMPRESS_CODEC_ZLIB, data, SIZE) * 8, SIZE);
+    }
+
+    /* matches overlapping what they write */
+    memset(data, 'a', SIZE);
+    assert_less(Helper_roundTrip(LOGGER_COMPRESS_CODEC_LZ, data, SIZE) * 200, SIZE);
+    free(data);
+}
+
+FeatureDefine(StoreIncompressible) {
+    (void) traits_context;
+    unsigned char data[4096];
+    unsigned char block[LOGGER_COMPRESS_HEADER_SIZE + sizeof(data)];
+    for (size_t i = 0; i < sizeof(data); i++) {
+        data[i] = Helper_random();
+    }
+    assert_equal(0, Logger_Compress_lz(data, sizeof(data), block, sizeof(data)));
+    assert_equal(sizeof(block), Helper_roundTrip(LOGGER_COMPRESS_CODEC_LZ, data, sizeof(data)));
+
+    Logger_Compress_Header_T header;
+    Logger_Compress_encodeBlock(LOGGER_COMPRESS_CODEC_LZ, data, sizeof(data), block);
+    assert_true(Logger_Compress_readHeader(block, &header));
+    assert_equal(LOGGER_COMPRESS_CODEC_STORED, header.codec);
+}
+
+FeatureDefine(RejectMalformed) {
+    (void) traits_context;
+    const char *TEXT = "abcdabcdabcdabcdabcdabcdabcdabcdabcdabcdabcd";
+    unsigned char compressed[64];
+    unsigned char decoded[64];
+    const size_t size = Logger_Compress_lz(TEXT, strlen(TEXT), compressed, sizeof(compressed));
+    assert_greater(size, 0);
+    assert_true(Logger_Compress_unlz(compressed, size, decoded, strlen(TEXT)));
+
+    /* truncated, wrong size, offset before the start */
+    for (size_t i = 0; i < size; i++) {
+        assert_false(Logger_Compress_unlz(compressed, i, decoded, strlen(TEXT)));
+    }
+    assert_false(Logger_Compress_unlz(compressed, size, decoded, strlen(TEXT) - 1));
+    const unsigned char FAR_MATCH[] = {0x10, 'a', 0x02, 0x00, 0x00};
+    assert_false(Logger_Compress_unlz(FAR_MATCH, sizeof(FAR_MATCH), decoded, 5));
+
+    unsigned char header[LOGGER_COMPRESS_HEADER_SIZE + 1];
+    Logger_Compress_Header_T parsed;
+    Logger_Compress_encodeBlock(LOGGER_COMPRESS_CODEC_LZ, "x", 1, header);
+    assert_true(Logger_Compress_readHeader(header, &parsed));
+    header[0] = 'X';
+    assert_false(Logger_Compress_readHeader(header, &parsed));
+    header[0] = 'L';
+    header[4] = 7;
+    assert_false(Logger_Compress_readHeader(header, &parsed));
+}
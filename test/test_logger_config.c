@@ -0,0 +1,308 @@
+/*
+ * C Source File
+ *
+ * Author: daddinuz
+ * email:  daddinuz@gmail.com
+ * Date:   October 19, 2026
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "traits/traits.h"
+#include "traits-unit/traits-unit.h"
+#include "logger_config.h"
+
+/*
+ * Define globals
+ */
+static size_t gPublishCalls = 0;
+
+/*
+ * Define context
+ */
+typedef struct Context_T {
+    char directory[32];
+    char configPath[64];
+    char logPath[64];
+} *Context_T;
+
+/*
+ * Declare setups
+ */
+SetupDeclare(SetupConfig);
+
+/*
+ * Declare teardowns
+ */
+TeardownDeclare(TeardownConfig);
+
+/*
+ * Declare fixtures
+ */
+FixtureDeclare(FixtureConfig);
+
+/*
+ * Declare features
+ */
+FeatureDeclare(LoadAndApply);
+FeatureDeclare(RejectInvalid);
+FeatureDeclare(ReloadKeepsUnchangedHandlers);
+FeatureDeclare(ReloadKeepsCurrentOnErrors);
+FeatureDeclare(ReloadAppendsAndKeepsOtherHandlers);
+FeatureDeclare(WatchForChanges);
+
+/*
+ * Describe the test case
+ */
+Describe("LoggerConfig",
+         Trait(
+                 "Basic",
+                 Run(LoadAndApply, FixtureConfig),
+                 Run(RejectInvalid, FixtureConfig),
+                 Run(ReloadKeepsUnchangedHandlers, FixtureConfig),
+                 Run(ReloadKeepsCurrentOnErrors, FixtureConfig),
+                 Run(ReloadAppendsAndKeepsOtherHandlers, FixtureConfig)
+         ),
+         Trait(
+                 "Watch",
+                 Run(WatchForChanges, FixtureConfig)
+         )
+)
+
+/*
+ * Define callbacks
+ */
+static Logger_Err_T publishCallback(Logger_Handler_T handler, Logger_Record_T record) {
+    assert_not_null(handler);
+    assert_not_null(record);
+    gPublishCalls++;
+    return LOGGER_ERR_OK;
+}
+
+static void flushCallback(Logger_Handler_T handler) {
+    assert_not_null(handler);
+}
+
+static void closeCallback(Logger_Handler_T handler) {
+    assert_not_null(handler);
+}
+
+/*
+ * Define helpers
+ */
+static void Helper_writeConfig(Context_T context, const char *fmt) {
+    char tmpPath[80];
+    snprintf(tmpPath, sizeof(tmpPath), "%s.tmp", context->configPath);
+    FILE *file = fopen(tmpPath, "w");
+    assert_not_null(file);
+    fprintf(file, fmt, context->logPath);
+    assert_equal(0, fclose(file));
+    assert_equal(0, rename(tmpPath, context->configPath));  /* as editors do */
+}
+
+static size_t Helper_countLines(const char *path) {
+    size_t lines = 0;
+    int c;
+    FILE *file = fopen(path, "r");
+    assert_not_null(file);
+    while (EOF != (c = fgetc(file))) {
+        lines += '\n' == c;
+    }
+    fclose(file);
+    return lines;
+}
+
+static const char *CONFIG =
+        "# test configuration\n"
+        "[handler file]\n"
+        "type = file\n"
+        "path = %s\n"
+        "formatter = logfmt\n"
+        "\n"
+        "[logger]\n"
+        "level = ERROR\n"
+        "\n"
+        "[logger db.pool]\n"
+        "level = debug\n"
+        "handlers = file\n"
+        "propagate = false\n";
+
+/*
+ * Define setups
+ */
+SetupDefine(SetupConfig) {
+    Context_T context = malloc(sizeof(*context));
+    assert_not_null(context);
+    strcpy(context->directory, "/tmp/logger_config_XXXXXX");
+    assert_not_null(mkdtemp(context->directory));
+    snprintf(context->configPath, sizeof(context->configPath), "%s/logger.ini", context->directory);
+    snprintf(context->logPath, sizeof(context->logPath), "%s/logger.log", context->directory);
+    return context;
+}
+
+/*
+ * Define teardowns
+ */
+TeardownDefine(TeardownConfig) {
+    Context_T context = traits_context;
+    unlink(context->configPath);
+    unlink(context->logPath);
+    rmdir(context->directory);
+    free(context);
+}
+
+/*
+ * Define fixtures
+ */
+FixtureDefine(FixtureConfig, SetupConfig, TeardownConfig);
+
+/*
+ * Define features
+ */
+FeatureDefine(LoadAndApply) {
+    Context_T context = traits_context;
+    Helper_writeConfig(context, CONFIG);
+
+    Logger_Config_Result_T result = Logger_Config_load(context->configPath);
+    assert_equal(LOGGER_ERR_OK, result.err);
+    assert_not_null(result.config);
+    assert_equal(1, Logger_Config_getLoads(result.config));
+
+    Logger_T sut = Logger_get("db.pool.conn");
+    assert_equal(LOGGER_LEVEL_ERROR, Logger_getLevel(Logger_get("")));
+    assert_equal(LOGGER_LEVEL_DEBUG, Logger_getLevel(sut));
+    assert_false(Logger_getPropagate(Logger_get("db.pool")));
+    assert_equal(LOGGER_ERR_OK, Logger_logDebug(sut, "%s", "EXPECTED_MESSAGE"));
+    assert_equal(LOGGER_ERR_OK, Logger_logDebug(Logger_get("net"), "%s", "not loggable"));
+
+    /* the handlers go away with the configuration */
+    Logger_Config_delete(&result.config);
+    assert_null(result.config);
+    assert_equal(LOGGER_ERR_OK, Logger_logDebug(sut, "%s", "ANOTHER_MESSAGE"));
+    assert_equal(1, Helper_countLines(context->logPath));
+}
+
+FeatureDefine(RejectInvalid) {
+    Context_T context = traits_context;
+    const struct {
+        const char *config;
+        size_t line;
+    } INVALID[] = {
+            {"[logger]\nlevel = LOUD\n", 2},
+            {"[logger]\nhandlers = missing\n", 1},
+            {"level = INFO\n", 1},
+            {"[handler console]\ntype = console\ncolor = true\n", 3},
+            {"[handler console]\ntype = console\n[handler console]\ntype = console\n", 3},
+            {"[handler file]\ntype = file\n[logger]\n", 1},
+            {"[handler file]\ntype = file\npath = %s\nformatter = xml\n", 1},
+            {"[appender]\n", 1},
+            {"[handler file]\ntype = file\npath = %s\ncodec = lz\n", 1},
+            {"[handler archive]\ntype = compressed\npath = %s\ncodec = lz4\n", 4},
+    };
+
+    for (size_t i = 0; i < sizeof(INVALID) / sizeof(INVALID[0]); i++) {
+        Helper_writeConfig(context, INVALID[i].config);
+        Logger_Config_Result_T result = Logger_Config_load(context->configPath);
+        assert_equal(LOGGER_ERR_INVALID_CONFIG, result.err);
+        assert_null(result.config);
+        assert_equal(INVALID[i].line, result.line);
+    }
+
+    Logger_Config_Result_T result = Logger_Config_load("/tmp/logger_config_missing/logger.ini");
+    assert_equal(LOGGER_ERR_NO_ENTITY, result.err);
+    assert_null(result.config);
+}
+
+FeatureDefine(ReloadKeepsUnchangedHandlers) {
+    Context_T context = traits_context;
+    Helper_writeConfig(context, CONFIG);
+    Logger_Config_Result_T result = Logger_Config_load(context->configPath);
+    assert_equal(LOGGER_ERR_OK, result.err);
+    Logger_T sut = Logger_get("db.pool");
+    assert_equal(LOGGER_ERR_OK, Logger_logInfo(sut, "%s", "EXPECTED_MESSAGE"));
+
+    /* only levels change: the file is not reopened and db.pool inherits again */
+    Helper_writeConfig(
+            context,
+            "[handler file]\ntype = file\npath = %s\nformatter = logfmt\nlevel = WARNING\n"
+            "[logger]\nlevel = INFO\n[logger db]\nhandlers = file\n"
+    );
+    assert_equal(LOGGER_ERR_OK, Logger_Config_reload(result.config));
+    assert_equal(2, Logger_Config_getLoads(result.config));
+    assert_equal(LOGGER_LEVEL_INFO, Logger_getLevel(sut));
+    assert_true(Logger_getPropagate(sut));
+    assert_equal(LOGGER_ERR_OK, Logger_logInfo(sut, "%s", "filtered by the handler"));
+    assert_equal(LOGGER_ERR_OK, Logger_logWarning(sut, "%s", "ANOTHER_MESSAGE"));
+    Logger_Config_delete(&result.config);
+    assert_equal(2, Helper_countLines(context->logPath));
+}
+
+FeatureDefine(ReloadKeepsCurrentOnErrors) {
+    Context_T context = traits_context;
+    Helper_writeConfig(context, CONFIG);
+    Logger_Config_Result_T result = Logger_Config_load(context->configPath);
+    assert_equal(LOGGER_ERR_OK, result.err);
+
+    Helper_writeConfig(context, "[logger]\nlevel = DEBUG\n[logger db.pool]\nlevel = LOUD\n");
+    assert_equal(LOGGER_ERR_INVALID_CONFIG, Logger_Config_reload(result.config));
+    assert_equal(4, Logger_Config_getErrorLine(result.config));
+    assert_equal(1, Logger_Config_getLoads(result.config));
+    assert_equal(LOGGER_LEVEL_ERROR, Logger_getLevel(Logger_get("")));
+
+    Helper_writeConfig(context, "[handler file]\ntype = file\npath = /tmp/logger_config_missing/%s\n");
+    assert_equal(LOGGER_ERR_NO_ENTITY, Logger_Config_reload(result.config));
+    assert_equal(0, Logger_Config_getErrorLine(result.config));
+    assert_equal(LOGGER_ERR_OK, Logger_logDebug(Logger_get("db.pool"), "%s", "EXPECTED_MESSAGE"));
+    Logger_Config_delete(&result.config);
+    assert_equal(1, Helper_countLines(context->logPath));
+}
+
+FeatureDefine(ReloadAppendsAndKeepsOtherHandlers) {
+    Context_T context = traits_context;
+    Helper_writeConfig(context, CONFIG);
+    Logger_Config_Result_T result = Logger_Config_load(context->configPath);
+    assert_equal(LOGGER_ERR_OK, result.err);
+    Logger_T sut = Logger_get("db.pool");
+    Logger_Handler_T handler = Logger_Handler_new(publishCallback, flushCallback, closeCallback);
+    assert_not_null(handler);
+    assert_not_null(Logger_addHandler(sut, handler));
+    assert_equal(LOGGER_ERR_OK, Logger_logError(sut, "%s", "EXPECTED_MESSAGE"));
+    assert_equal(1, gPublishCalls);
+
+    /* a new formatter replaces the file handler, which must not truncate the file */
+    Helper_writeConfig(
+            context,
+            "[handler file]\ntype = file\npath = %s\nformatter = json\n[logger db.pool]\nhandlers = file\n"
+    );
+    assert_equal(LOGGER_ERR_OK, Logger_Config_reload(result.config));
+    assert_equal(LOGGER_ERR_OK, Logger_logError(sut, "%s", "ANOTHER_MESSAGE"));
+    assert_equal(2, gPublishCalls);
+    assert_equal(2, Helper_countLines(context->logPath));
+
+    /* the handler the application added outlives the configuration */
+    Logger_Config_delete(&result.config);
+    assert_equal(LOGGER_ERR_OK, Logger_logError(sut, "%s", "ANOTHER_MESSAGE"));
+    assert_equal(3, gPublishCalls);
+    assert_equal(2, Helper_countLines(context->logPath));
+    assert_equal(handler, Logger_removeHandler(sut, handler));
+    Logger_Handler_delete(&handler);
+}
+
+FeatureDefine(WatchForChanges) {
+    Context_T context = traits_context;
+    Helper_writeConfig(context, CONFIG);
+    Logger_Config_Result_T result = Logger_Config_load(context->configPath);
+    assert_equal(LOGGER_ERR_OK, result.err);
+    assert_equal(LOGGER_ERR_OK, Logger_Config_watch(result.config));
+    assert_equal(LOGGER_ERR_OK, Logger_Config_watch(result.config));
+
+    Helper_writeConfig(context, "[logger]\nlevel = NOTICE\n");
+    for (size_t i = 0; i < 200 && Logger_Config_getLoads(result.config) < 2; i++) {
+        usleep(10000);
+    }
+    assert_equal(2, Logger_Config_getLoads(result.config));
+    assert_equal(LOGGER_LEVEL_NOTICE, Logger_getLevel(Logger_get("db.pool")));
+    Logger_Config_delete(&result.config);
+}
@@ -16,6 +16,8 @@
  */
 size_t gFormatRecordCalls = 0;
 size_t gDeleteFormattedRecordCalls = 0;
+size_t gCloseCalls = 0;
+size_t gResetCalls = 0;
 char *G_EXPECTED_FORMATTED_RECORD = NULL;
 Logger_Record_T gRecord = NULL;
 
@@ -24,6 +26,10 @@ Logger_Record_T gRecord = NULL;
  */
 static char *formatRecordCallback(Logger_Record_T record);
 static void deleteRecordCallback(char *formattedRecord);
+static char *contextualFormatRecordCallback(Logger_Formatter_T formatter, Logger_Record_T record);
+static void contextualDeleteRecordCallback(Logger_Formatter_T formatter, char *formattedRecord);
+static void closeCallback(Logger_Formatter_T formatter);
+static void resetCallback(Logger_Formatter_T formatter);
 
 /*
  * Declare setups
@@ -45,6 +51,8 @@ FixtureDeclare(FixtureLoggerFormatter);
  */
 FeatureDeclare(NewAndDelete);
 FeatureDeclare(FormatRecordAndDelete);
+FeatureDeclare(RetainAndRelease);
+FeatureDeclare(ContextualFormatRecordAndReset);
 
 /*
  * Describe the test case
@@ -52,7 +60,9 @@ FeatureDeclare(FormatRecordAndDelete);
 Describe("LoggerFormatter",
          Trait(
                  "Basic",
-                 Run(FormatRecordAndDelete, FixtureLoggerFormatter)
+                 Run(FormatRecordAndDelete, FixtureLoggerFormatter),
+                 Run(RetainAndRelease),
+                 Run(ContextualFormatRecordAndReset, FixtureLoggerFormatter)
          )
 )
 
@@ -75,6 +85,29 @@ void deleteRecordCallback(char *formattedRecord) {
     gDeleteFormattedRecordCalls++;
 }
 
+char *contextualFormatRecordCallback(Logger_Formatter_T formatter, Logger_Record_T record) {
+    assert_not_null(formatter);
+    assert_equal(&gResetCalls, Logger_Formatter_getContext(formatter));
+    return formatRecordCallback(record);
+}
+
+void contextualDeleteRecordCallback(Logger_Formatter_T formatter, char *formattedRecord) {
+    assert_not_null(formatter);
+    assert_equal(&gResetCalls, Logger_Formatter_getContext(formatter));
+    deleteRecordCallback(formattedRecord);
+}
+
+void closeCallback(Logger_Formatter_T formatter) {
+    assert_not_null(formatter);
+    gCloseCalls++;
+}
+
+void resetCallback(Logger_Formatter_T formatter) {
+    assert_not_null(formatter);
+    size_t *resetCalls = Logger_Formatter_getContext(formatter);
+    (*resetCalls)++;
+}
+
 /*
  * Define setups
  */
@@ -127,3 +160,46 @@ FeatureDefine(FormatRecordAndDelete) {
     Logger_Formatter_deleteFormattedRecord(sut, formattedRecord);
     assert_equal(1, gDeleteFormattedRecordCalls);
 }
+
+FeatureDefine(RetainAndRelease) {
+    (void) traits_context;
+    Logger_Formatter_T sut = Logger_Formatter_new(formatRecordCallback, deleteRecordCallback);
+    assert_not_null(sut);
+    Logger_Formatter_setCloseCallback(sut, closeCallback);
+
+    Logger_Formatter_T owner1 = Logger_Formatter_retain(sut);
+    Logger_Formatter_T owner2 = Logger_Formatter_retain(sut);
+    assert_equal(sut, owner1);
+    assert_equal(sut, owner2);
+
+    Logger_Formatter_release(&owner2);
+    assert_null(owner2);
+    Logger_Formatter_release(&sut);
+    assert_null(sut);
+    assert_equal(0, gCloseCalls);
+
+    Logger_Formatter_release(&owner1);
+    assert_null(owner1);
+    assert_equal(1, gCloseCalls);
+}
+
+FeatureDefine(ContextualFormatRecordAndReset) {
+    (void) traits_context;
+    Logger_Formatter_T sut = Logger_Formatter_newContextual(contextualFormatRecordCallback, contextualDeleteRecordCallback);
+    assert_not_null(sut);
+    Logger_Formatter_setContext(sut, &gResetCalls);
+
+    /* without a reset callback there is nothing to forget */
+    Logger_Formatter_reset(sut);
+    assert_equal(0, gResetCalls);
+    Logger_Formatter_setResetCallback(sut, resetCallback);
+    Logger_Formatter_reset(sut);
+    assert_equal(1, gResetCalls);
+
+    char *formattedRecord = Logger_Formatter_formatRecord(sut, gRecord);
+    assert_equal(1, gFormatRecordCalls);
+    Logger_Formatter_deleteFormattedRecord(sut, formattedRecord);
+    assert_equal(1, gDeleteFormattedRecordCalls);
+    Logger_Formatter_delete(&sut);
+    assert_null(sut);
+}
@@ -48,6 +48,8 @@ FixtureDeclare(FixtureLoggerHandler);
  * Declare features
  */
 FeatureDeclare(PublishFlushAndClose);
+FeatureDeclare(Stats);
+FeatureDeclare(RetainAndRelease);
 
 /*
  * Describe the test case
@@ -55,7 +57,9 @@ FeatureDeclare(PublishFlushAndClose);
 Describe("LoggerHandler",
          Trait(
                  "Basic",
-                 Run(PublishFlushAndClose, FixtureLoggerHandler)
+                 Run(PublishFlushAndClose, FixtureLoggerHandler),
+                 Run(Stats, FixtureLoggerHandler),
+                 Run(RetainAndRelease, FixtureLoggerHandler)
          )
 )
 
@@ -170,3 +174,74 @@ FeatureDefine(PublishFlushAndClose) {
     assert_equal(2, gFlushCalls);
     assert_equal(2, gCloseCalls);
 }
+
+FeatureDefine(Stats) {
+    (void) traits_context;
+
+    sut = Logger_Handler_new(publishCallback, flushCallback, closeCallback);
+    assert_not_null(sut);
+
+    Logger_Handler_Stats_T stats = Logger_Handler_getStats(sut);
+    assert_equal(0, stats.published);
+    assert_equal(0, stats.bytesWritten);
+    assert_equal(0, stats.filtered);
+    assert_equal(0, stats.errors);
+    assert_equal(0, stats.drops);
+    assert_equal(0, stats.flushes);
+    assert_equal(0, stats.publishTime);
+
+    Logger_Handler_publish(sut, gRecord);
+    Logger_Handler_publish(sut, gRecord);
+    Logger_Handler_addBytesWritten(sut, 42);
+    Logger_Handler_flush(sut);
+    Logger_Handler_setLevel(sut, LOGGER_LEVEL_FATAL);
+    Logger_Record_setLevel(gRecord, LOGGER_LEVEL_ERROR);
+    assert_equal(false, Logger_Handler_isLoggable(sut, gRecord));
+    assert_equal(0, Logger_Handler_getStats(sut).filtered);
+    Logger_Handler_addFiltered(sut);
+
+    stats = Logger_Handler_getStats(sut);
+    assert_equal(2, stats.published);
+    assert_equal(42, stats.bytesWritten);
+    assert_equal(1, stats.filtered);
+    assert_equal(0, stats.errors);
+    assert_equal(0, stats.drops);
+    assert_equal(1, stats.flushes);
+    assert_equal(0, stats.publishTime);
+
+    /* the publish time is measured only on demand */
+    Logger_Handler_setPublishTiming(sut, true);
+    Logger_Handler_setLevel(sut, LOGGER_LEVEL_DEBUG);
+    Logger_Handler_publish(sut, gRecord);
+    assert_greater(Logger_Handler_getStats(sut).publishTime, 0);
+
+    Logger_Handler_delete(&sut);
+    assert_null(sut);
+}
+
+FeatureDefine(RetainAndRelease) {
+    (void) traits_context;
+
+    sut = Logger_Handler_new(publishCallback, flushCallback, closeCallback);
+    assert_not_null(sut);
+    Logger_Handler_setFormatter(sut, gFormatter);
+
+    Logger_Handler_T owner1 = Logger_Handler_retain(sut);
+    Logger_Handler_T owner2 = Logger_Handler_retain(sut);
+    assert_equal(sut, owner1);
+    assert_equal(sut, owner2);
+
+    Logger_Handler_release(&owner1);
+    assert_null(owner1);
+    Logger_Handler_release(&owner2);
+    assert_null(owner2);
+    assert_equal(0, gCloseCalls);
+    assert_equal(LOGGER_ERR_OK, Logger_Handler_publish(sut, gRecord));
+
+    /* the last reference closes the handler and leaves the formatter alone */
+    Logger_Handler_T last = sut;
+    Logger_Handler_release(&last);
+    assert_null(last);
+    assert_equal(1, gFlushCalls);
+    assert_equal(1, gCloseCalls);
+}
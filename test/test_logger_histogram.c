@@ -0,0 +1,61 @@
+/*
+ * C Source File
+ *
+ * Author: daddinuz
+ * email:  daddinuz@gmail.com
+ * Date:   October 19, 2026
+ */
+
+#include "traits/traits.h"
+#include "traits-unit/traits-unit.h"
+#include "logger_histogram.h"
+
+/*
+ * Declare features
+ */
+FeatureDeclare(RecordAndPercentiles);
+FeatureDeclare(Reset);
+
+/*
+ * Describe the test case
+ */
+Describe("LoggerHistogram",
+         Trait(
+                 "Basic",
+                 Run(RecordAndPercentiles),
+                 Run(Reset)
+         )
+)
+
+/*
+ * Define features
+ */
+FeatureDefine(RecordAndPercentiles) {
+    (void) traits_context;
+    assert_equal(0, Logger_Histogram_getCount(LOGGER_HISTOGRAM_PHASE_IO));
+    assert_equal(0, Logger_Histogram_getPercentile(LOGGER_HISTOGRAM_PHASE_IO, 50.0));
+
+    for (size_t i = 0; i < 999; i++) {
+        Logger_Histogram_record(LOGGER_HISTOGRAM_PHASE_IO, 1000);
+    }
+    Logger_Histogram_record(LOGGER_HISTOGRAM_PHASE_IO, 1000000);
+    assert_equal(1000, Logger_Histogram_getCount(LOGGER_HISTOGRAM_PHASE_IO));
+    assert_equal(0, Logger_Histogram_getCount(LOGGER_HISTOGRAM_PHASE_FORMAT));
+
+    /* values are converted to nanoseconds, compare them relative to each other */
+    const uint64_t median = Logger_Histogram_getPercentile(LOGGER_HISTOGRAM_PHASE_IO, 50.0);
+    assert_greater(median, 0);
+    assert_equal(median, Logger_Histogram_getPercentile(LOGGER_HISTOGRAM_PHASE_IO, 99.9));
+    const uint64_t max = Logger_Histogram_getPercentile(LOGGER_HISTOGRAM_PHASE_IO, 100.0);
+    assert_greater(max / median, 900);
+    assert_less(max / median, 1100);
+}
+
+FeatureDefine(Reset) {
+    (void) traits_context;
+    Logger_Histogram_record(LOGGER_HISTOGRAM_PHASE_TOTAL, 42);
+    assert_equal(1, Logger_Histogram_getCount(LOGGER_HISTOGRAM_PHASE_TOTAL));
+    Logger_Histogram_reset();
+    assert_equal(0, Logger_Histogram_getCount(LOGGER_HISTOGRAM_PHASE_TOTAL));
+    assert_equal(0, Logger_Histogram_getPercentile(LOGGER_HISTOGRAM_PHASE_TOTAL, 99.0));
+}
@@ -0,0 +1,173 @@
+/*
+ * C Source File
+ *
+ * Author: daddinuz
+ * email:  daddinuz@gmail.com
+ * Date:   October 19, 2026
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "traits/traits.h"
+#include "traits-unit/traits-unit.h"
+#include "helper_logger_hpp.h"
+#include "logger.h"
+
+/*
+ * The features drive test/helper_logger_hpp.cpp, which uses logger.hpp.
+ */
+
+/*
+ * Define globals
+ */
+static char gMessages[16][HELPER_MESSAGE_SIZE];
+static size_t gPublishCalls = 0;
+
+/*
+ * Declare callbacks
+ */
+static Logger_Err_T publishCallback(Logger_Handler_T handler, Logger_Record_T record);
+static void flushCallback(Logger_Handler_T handler);
+static void closeCallback(Logger_Handler_T handler);
+
+/*
+ * Declare setups
+ */
+SetupDeclare(SetupLogger);
+
+/*
+ * Declare teardowns
+ */
+TeardownDeclare(TeardownLogger);
+
+/*
+ * Declare fixtures
+ */
+FixtureDeclare(FixtureLogger);
+
+/*
+ * Declare features
+ */
+FeatureDeclare(RenderLikePrintf);
+FeatureDeclare(FilterByLevel);
+FeatureDeclare(DisableCallSite);
+FeatureDeclare(ShareHandles);
+
+/*
+ * Describe the test case
+ */
+Describe("LoggerHpp",
+         Trait(
+                 "Basic",
+                 Run(RenderLikePrintf, FixtureLogger),
+                 Run(FilterByLevel, FixtureLogger),
+                 Run(DisableCallSite, FixtureLogger)
+         ),
+         Trait(
+                 "Handles",
+                 Run(ShareHandles)
+         )
+)
+
+/*
+ * Define callbacks
+ */
+Logger_Err_T publishCallback(Logger_Handler_T handler, Logger_Record_T record) {
+    assert_not_null(handler);
+    assert_not_null(record);
+    assert_less(gPublishCalls, sizeof(gMessages) / sizeof(gMessages[0]));
+    strncpy(gMessages[gPublishCalls++], Logger_Record_getMessage(record), HELPER_MESSAGE_SIZE - 1);
+    return LOGGER_ERR_OK;
+}
+
+void flushCallback(Logger_Handler_T handler) {
+    assert_not_null(handler);
+}
+
+void closeCallback(Logger_Handler_T handler) {
+    assert_not_null(handler);
+}
+
+/*
+ * Define setups
+ */
+SetupDefine(SetupLogger) {
+    Logger_T sut = Logger_new("hpp", LOGGER_LEVEL_INFO);
+    assert_not_null(sut);
+    Logger_Handler_T handler = Logger_Handler_new(publishCallback, flushCallback, closeCallback);
+    assert_not_null(handler);
+    Logger_addHandler(sut, handler);
+    return sut;
+}
+
+/*
+ * Define teardowns
+ */
+TeardownDefine(TeardownLogger) {
+    Logger_T sut = traits_context;
+    Logger_Handler_T handler = Logger_popHandler(sut);
+    Logger_Handler_delete(&handler);
+    Logger_delete(&sut);
+}
+
+/*
+ * Define fixtures
+ */
+FixtureDefine(FixtureLogger, SetupLogger, TeardownLogger);
+
+/*
+ * Define features
+ */
+FeatureDefine(RenderLikePrintf) {
+    Logger_T sut = traits_context;
+    static char expected[16][HELPER_MESSAGE_SIZE];
+    const size_t count = Helper_logCases(sut, expected, sizeof(expected) / sizeof(expected[0]));
+    assert_less_equal(count, sizeof(expected) / sizeof(expected[0]));
+    assert_equal(count, gPublishCalls);
+    for (size_t i = 0; i < count; i++) {
+        assert_string_equal(expected[i], gMessages[i]);
+    }
+}
+
+FeatureDefine(FilterByLevel) {
+    Logger_T sut = traits_context;
+    Helper_logDebug(sut);
+    assert_equal(0, gPublishCalls);
+    Logger_setLevel(sut, LOGGER_LEVEL_DEBUG);
+    Helper_logDebug(sut);
+    assert_equal(1, gPublishCalls);
+    assert_string_equal("filtered by the logger level", gMessages[0]);
+}
+
+FeatureDefine(DisableCallSite) {
+    Logger_T sut = traits_context;
+    Helper_logFromCallSite(sut);
+    assert_equal(1, gPublishCalls);
+    assert_equal(1, Logger_CallSite_disable("*helper_logger_hpp.cpp", "Helper_logFromCallSite", 0, SIZE_MAX));
+    Helper_logFromCallSite(sut);
+    assert_equal(1, gPublishCalls);
+}
+
+FeatureDefine(ShareHandles) {
+    (void) traits_context;
+    char filePath[] = "/tmp/logger_hpp_XXXXXX";
+    const int fd = mkstemp(filePath);
+    assert_greater_equal(fd, 0);
+    close(fd);
+
+    assert_equal(LOGGER_ERR_OK, Helper_logThroughHandles(filePath));
+    size_t lines = 0;
+    int c;
+    FILE *file = fopen(filePath, "r");
+    assert_not_null(file);
+    while (EOF != (c = fgetc(file))) {
+        lines += '\n' == c;
+    }
+    fclose(file);
+    unlink(filePath);
+    assert_equal(3, lines);
+
+    assert_equal(LOGGER_ERR_NO_ENTITY, Helper_logThroughHandles("/tmp/logger_hpp_missing/logger.log"));
+}
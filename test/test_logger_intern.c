@@ -0,0 +1,113 @@
+/*
+ * C Source File
+ *
+ * Author: daddinuz
+ * email:  daddinuz@gmail.com
+ * Date:   October 19, 2026
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <pthread.h>
+#include "traits/traits.h"
+#include "traits-unit/traits-unit.h"
+#include "logger_intern.h"
+
+/*
+ * Define globals
+ */
+#define STRINGS_SIZE 256
+#define THREADS_SIZE 4
+
+static char gStrings[STRINGS_SIZE][8];
+static uint32_t gIds[THREADS_SIZE][STRINGS_SIZE];
+
+/*
+ * Declare features
+ */
+FeatureDeclare(InternByContent);
+FeatureDeclare(InternConcurrently);
+
+/*
+ * Describe the test case
+ */
+Describe("LoggerIntern",
+         Trait(
+                 "Basic",
+                 Run(InternByContent),
+                 Run(InternConcurrently)
+         )
+)
+
+/*
+ * Define helpers
+ */
+static void *Helper_internAll(void *arg) {
+    uint32_t *ids = arg;
+    for (size_t i = 0; i < STRINGS_SIZE; i++) {
+        ids[i] = Logger_Intern_getId(gStrings[i]);
+    }
+    return NULL;
+}
+
+/*
+ * Define features
+ */
+FeatureDefine(InternByContent) {
+    (void) traits_context;
+    static const char FIRST[] = "EXPECTED_STRING";
+    static const char SECOND[] = "ANOTHER_STRING";
+    char copy[sizeof(FIRST)];
+    const size_t initialSize = Logger_Intern_getSize();
+
+    const uint32_t firstId = Logger_Intern_getId(FIRST);
+    assert_not_equal(LOGGER_INTERN_NO_ID, firstId);
+    assert_equal(initialSize + 1, Logger_Intern_getSize());
+    assert_string_equal(FIRST, Logger_Intern_getString(firstId));
+    assert_not_equal(FIRST, Logger_Intern_getString(firstId));
+
+    /* same content, different pointer */
+    memcpy(copy, FIRST, sizeof(copy));
+    assert_equal(firstId, Logger_Intern_getId(copy));
+    assert_equal(initialSize + 1, Logger_Intern_getSize());
+
+    /* same pointer, different content */
+    memcpy(copy, SECOND, sizeof(SECOND));
+    const uint32_t secondId = Logger_Intern_getId(copy);
+    assert_not_equal(firstId, secondId);
+    assert_equal(initialSize + 2, Logger_Intern_getSize());
+    assert_string_equal(SECOND, Logger_Intern_getString(secondId));
+
+    /* repeats do not grow the table */
+    for (size_t i = 0; i < 16; i++) {
+        assert_equal(firstId, Logger_Intern_getId(FIRST));
+        assert_equal(secondId, Logger_Intern_getId(SECOND));
+    }
+    assert_equal(initialSize + 2, Logger_Intern_getSize());
+    assert_null(Logger_Intern_getString(LOGGER_INTERN_NO_ID));
+}
+
+FeatureDefine(InternConcurrently) {
+    (void) traits_context;
+    pthread_t threads[THREADS_SIZE];
+    const size_t initialSize = Logger_Intern_getSize();
+
+    for (size_t i = 0; i < STRINGS_SIZE; i++) {
+        snprintf(gStrings[i], sizeof(gStrings[i]), "s%zu", i);
+    }
+    for (size_t t = 0; t < THREADS_SIZE; t++) {
+        assert_equal(0, pthread_create(&threads[t], NULL, Helper_internAll, gIds[t]));
+    }
+    for (size_t t = 0; t < THREADS_SIZE; t++) {
+        assert_equal(0, pthread_join(threads[t], NULL));
+    }
+
+    assert_equal(initialSize + STRINGS_SIZE, Logger_Intern_getSize());
+    for (size_t i = 0; i < STRINGS_SIZE; i++) {
+        assert_not_equal(LOGGER_INTERN_NO_ID, gIds[0][i]);
+        assert_string_equal(gStrings[i], Logger_Intern_getString(gIds[0][i]));
+        for (size_t t = 1; t < THREADS_SIZE; t++) {
+            assert_equal(gIds[0][i], gIds[t][i]);
+        }
+    }
+}
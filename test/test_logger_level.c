@@ -15,6 +15,7 @@
  * Declare features
  */
 FeatureDeclare(GetLoggerLevelName);
+FeatureDeclare(GetLoggerLevelFromName);
 
 /*
  * Describe the test case
@@ -22,7 +23,8 @@ FeatureDeclare(GetLoggerLevelName);
 Describe("LoggerLevel",
          Trait(
                  "Basic",
-                 Run(GetLoggerLevelName)
+                 Run(GetLoggerLevelName),
+                 Run(GetLoggerLevelFromName)
          )
 )
 
@@ -36,3 +38,16 @@ FeatureDefine(GetLoggerLevelName) {
         assert_string_equal(EXPECTED[i], Logger_Level_getName(i));
     }
 }
+
+FeatureDefine(GetLoggerLevelFromName) {
+    (void) traits_context;
+    Logger_Level_T level = LOGGER_LEVEL_FATAL;
+    const char *const NAMES[] = {"DEBUG", "notice", "Info", "WARNING", "error", "FATAL"};
+    for (size_t i = 0, size = sizeof(NAMES) / sizeof(NAMES[0]); i < size; i++) {
+        assert_true(Logger_Level_fromName(NAMES[i], &level));
+        assert_equal(i, level);
+    }
+    assert_false(Logger_Level_fromName("WARN", &level));
+    assert_false(Logger_Level_fromName("", &level));
+    assert_equal(LOGGER_LEVEL_FATAL, level);
+}
@@ -0,0 +1,168 @@
+/*
+ * C Source File
+ *
+ * Author: daddinuz
+ * email:  daddinuz@gmail.com
+ * Date:   October 19, 2026
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "traits/traits.h"
+#include "traits-unit/traits-unit.h"
+#include "logger_builtin_loggers.h"
+#include "logger_level_spec.h"
+
+/*
+ * Declare features
+ */
+FeatureDeclare(MatchPatterns);
+FeatureDeclare(RejectMalformed);
+FeatureDeclare(ResolveFromEnvironment);
+FeatureDeclare(IgnoreMalformedEnvironment);
+FeatureDeclare(InheritUnlessMoreSpecific);
+
+/*
+ * Describe the test case
+ */
+Describe("LoggerLevelSpec",
+         Trait(
+                 "Basic",
+                 Run(MatchPatterns),
+                 Run(RejectMalformed)
+         ),
+         Trait(
+                 "Environment",
+                 Run(ResolveFromEnvironment),
+                 Run(IgnoreMalformedEnvironment),
+                 Run(InheritUnlessMoreSpecific)
+         )
+)
+
+/*
+ * Define features
+ */
+FeatureDefine(MatchPatterns) {
+    (void) traits_context;
+    const struct {
+        const char *name;
+        Logger_Level_T level;
+    } EXPECTED[] = {
+            {"db", LOGGER_LEVEL_DEBUG},
+            {"dbx", LOGGER_LEVEL_INFO},
+            {"db.pool", LOGGER_LEVEL_INFO},
+            {"net", LOGGER_LEVEL_INFO},
+            {"net.http", LOGGER_LEVEL_WARNING},
+            {"net.http.tls", LOGGER_LEVEL_ERROR},
+            {"net.https", LOGGER_LEVEL_ERROR},
+            {"net.tcp", LOGGER_LEVEL_NOTICE},
+            {"", LOGGER_LEVEL_INFO},
+    };
+    Logger_LevelSpec_Result_T result = Logger_LevelSpec_new(
+            " db = debug, net.* = WARNING,*=INFO, net.http*=ERROR, net.http=WARNING, net.tcp=FATAL, net.tcp=NOTICE,"
+    );
+    assert_equal(LOGGER_ERR_OK, result.err);
+    assert_not_null(result.spec);
+
+    for (size_t i = 0; i < sizeof(EXPECTED) / sizeof(EXPECTED[0]); i++) {
+        Logger_Level_T level = LOGGER_LEVEL_FATAL;
+        assert_true(Logger_LevelSpec_match(result.spec, EXPECTED[i].name, &level));
+        assert_equal(EXPECTED[i].level, level);
+    }
+    Logger_LevelSpec_delete(&result.spec);
+    assert_null(result.spec);
+
+    result = Logger_LevelSpec_new("db=ERROR,net.*=INFO");
+    assert_equal(LOGGER_ERR_OK, result.err);
+    Logger_Level_T level = LOGGER_LEVEL_FATAL;
+    assert_false(Logger_LevelSpec_match(result.spec, "d", &level));
+    assert_false(Logger_LevelSpec_match(result.spec, "db.pool", &level));
+    assert_false(Logger_LevelSpec_match(result.spec, "net", &level));
+    assert_false(Logger_LevelSpec_match(result.spec, "", &level));
+    assert_equal(LOGGER_LEVEL_FATAL, level);
+    Logger_LevelSpec_delete(&result.spec);
+
+    result = Logger_LevelSpec_new("");
+    assert_equal(LOGGER_ERR_OK, result.err);
+    assert_false(Logger_LevelSpec_match(result.spec, "db", &level));
+    Logger_LevelSpec_delete(&result.spec);
+}
+
+FeatureDefine(RejectMalformed) {
+    (void) traits_context;
+    const char *const MALFORMED[] = {"db", "db=", "db=LOUD", "db=DEBUG,net", "n*t=INFO", "**=INFO", "db=DEBUG INFO"};
+    for (size_t i = 0; i < sizeof(MALFORMED) / sizeof(MALFORMED[0]); i++) {
+        Logger_LevelSpec_Result_T result = Logger_LevelSpec_new(MALFORMED[i]);
+        assert_equal(LOGGER_ERR_INVALID_CONFIG, result.err);
+        assert_null(result.spec);
+    }
+}
+
+FeatureDefine(ResolveFromEnvironment) {
+    (void) traits_context;
+    assert_equal(0, setenv(LOGGER_LEVEL_SPEC_VARIABLE, "db=DEBUG,net.*=WARNING,app=ERROR", 1));
+    assert_equal(LOGGER_LEVEL_DEBUG, Logger_LevelSpec_resolve("db", LOGGER_LEVEL_INFO));
+    assert_equal(LOGGER_LEVEL_NOTICE, Logger_LevelSpec_resolve("cache", LOGGER_LEVEL_NOTICE));
+
+    /* parsed once */
+    assert_equal(0, setenv(LOGGER_LEVEL_SPEC_VARIABLE, "db=FATAL", 1));
+    Logger_T sut = Logger_new("db", LOGGER_LEVEL_INFO);
+    assert_not_null(sut);
+    assert_equal(LOGGER_LEVEL_DEBUG, Logger_getLevel(sut));
+    Logger_delete(&sut);
+
+    /* registered loggers matched by a pattern get their own level, the others inherit it */
+    assert_equal(LOGGER_LEVEL_INFO, Logger_getLevel(Logger_get("")));
+    assert_equal(LOGGER_LEVEL_WARNING, Logger_getLevel(Logger_get("net.http.tls")));
+    assert_equal(LOGGER_LEVEL_INFO, Logger_getLevel(Logger_get("net")));
+
+    /* net.http.tls is matched by the same pattern as net.http, so it keeps inheriting from it */
+    Logger_setLevel(Logger_get("net.http"), LOGGER_LEVEL_ERROR);
+    assert_equal(LOGGER_LEVEL_ERROR, Logger_getLevel(Logger_get("net.http.tls")));
+    Logger_resetLevel(Logger_get("net.http"));
+    assert_equal(LOGGER_LEVEL_INFO, Logger_getLevel(Logger_get("net.http")));
+    assert_equal(LOGGER_LEVEL_INFO, Logger_getLevel(Logger_get("net.http.tls")));
+
+    /* the handler of the builtin loggers gets the same level */
+    Logger_Result_T result = Logger_newStderrLogger("app", LOGGER_LEVEL_DEBUG);
+    assert_equal(LOGGER_ERR_OK, result.err);
+    assert_equal(LOGGER_LEVEL_ERROR, Logger_getLevel(result.logger));
+    Logger_Handler_T handler = Logger_popHandler(result.logger);
+    assert_equal(LOGGER_LEVEL_ERROR, Logger_Handler_getLevel(handler));
+    Logger_Formatter_T formatter = Logger_Handler_getFormatter(handler);
+    Logger_Handler_delete(&handler);
+    Logger_Formatter_delete(&formatter);
+    Logger_delete(&result.logger);
+}
+
+FeatureDefine(IgnoreMalformedEnvironment) {
+    (void) traits_context;
+    assert_equal(0, setenv(LOGGER_LEVEL_SPEC_VARIABLE, "db=DEBUG,net", 1));
+    assert_null(Logger_LevelSpec_getEnvironment());
+    Logger_T sut = Logger_new("db", LOGGER_LEVEL_INFO);
+    assert_not_null(sut);
+    assert_equal(LOGGER_LEVEL_INFO, Logger_getLevel(sut));
+    Logger_delete(&sut);
+}
+
+FeatureDefine(InheritUnlessMoreSpecific) {
+    (void) traits_context;
+    assert_equal(0, setenv(LOGGER_LEVEL_SPEC_VARIABLE, "db=DEBUG,*=INFO,db.pool.*=ERROR", 1));
+
+    /* the catch-all matches db as well, db.pool inherits from db */
+    assert_equal(LOGGER_LEVEL_INFO, Logger_getLevel(Logger_get("cache")));
+    assert_equal(LOGGER_LEVEL_DEBUG, Logger_getLevel(Logger_get("db.pool")));
+    assert_equal(LOGGER_LEVEL_ERROR, Logger_getLevel(Logger_get("db.pool.conn")));
+    Logger_setLevel(Logger_get("db"), LOGGER_LEVEL_WARNING);
+    assert_equal(LOGGER_LEVEL_WARNING, Logger_getLevel(Logger_get("db.pool")));
+    assert_equal(LOGGER_LEVEL_ERROR, Logger_getLevel(Logger_get("db.pool.conn")));
+
+    Logger_LevelSpec_T spec = Logger_LevelSpec_getEnvironment();
+    assert_not_null(spec);
+    Logger_Level_T level = LOGGER_LEVEL_FATAL;
+    assert_false(Logger_LevelSpec_matchBeyond(spec, "db.pool", strlen("db"), &level));
+    assert_true(Logger_LevelSpec_matchBeyond(spec, "db", 0, &level));
+    assert_equal(LOGGER_LEVEL_DEBUG, level);
+    assert_true(Logger_LevelSpec_matchBeyond(spec, "db.pool.conn", strlen("db.pool"), &level));
+    assert_equal(LOGGER_LEVEL_ERROR, level);
+}
@@ -0,0 +1,165 @@
+/*
+ * C Source File
+ *
+ * Author: daddinuz
+ * email:  daddinuz@gmail.com
+ * Date:   October 19, 2026
+ */
+
+#include <string.h>
+#include <stdbool.h>
+#include <pthread.h>
+#include "traits/traits.h"
+#include "traits-unit/traits-unit.h"
+#include "logger_mdc.h"
+
+/*
+ * Declare features
+ */
+FeatureDeclare(PushAndPop);
+FeatureDeclare(ReplaceKey);
+FeatureDeclare(SnapshotOutlivesPop);
+FeatureDeclare(HandOverToThread);
+FeatureDeclare(ReadFromLaterDestructor);
+
+/*
+ * Describe the test case
+ */
+Describe("LoggerMdc",
+         Trait(
+                 "Basic",
+                 Run(PushAndPop),
+                 Run(ReplaceKey),
+                 Run(SnapshotOutlivesPop),
+                 Run(HandOverToThread),
+                 Run(ReadFromLaterDestructor)
+         )
+)
+
+/*
+ * Define helpers
+ */
+static void *Helper_readRequest(void *arg) {
+    (void) arg;
+    static char value[32] = "";
+    Logger_Mdc_T current = Logger_Mdc_current();
+    if (current && Logger_Mdc_get(current, "request")) {
+        strncpy(value, Logger_Mdc_get(current, "request"), sizeof(value) - 1);
+    }
+    return value;
+}
+
+static void *Helper_adoptSnapshot(void *arg) {
+    Logger_Mdc_set(arg);
+    return Helper_readRequest(NULL);
+}
+
+/*
+ * A key created after the context's one, its destructor runs once the context's has.
+ */
+static pthread_key_t gLaterKey;
+static bool gLaterSawNoContext = false;
+
+static void Helper_laterDestructor(void *value) {
+    (void) value;
+    gLaterSawNoContext = NULL == Logger_Mdc_current();
+}
+
+static void *Helper_pushAndExit(void *arg) {
+    (void) arg;
+    Logger_Mdc_push("request", "EXPECTED_REQUEST");
+    pthread_key_create(&gLaterKey, Helper_laterDestructor);
+    pthread_setspecific(gLaterKey, &gLaterKey);
+    return NULL;
+}
+
+/*
+ * Define features
+ */
+FeatureDefine(PushAndPop) {
+    (void) traits_context;
+
+    assert_null(Logger_Mdc_current());
+    assert_equal(LOGGER_ERR_OK, Logger_Mdc_push("request", "EXPECTED_REQUEST"));
+    assert_equal(LOGGER_ERR_OK, Logger_Mdc_push("tenant", "EXPECTED_TENANT"));
+    Logger_Mdc_T current = Logger_Mdc_current();
+    assert_not_null(current);
+    assert_equal(2, Logger_Mdc_getSize(current));
+    assert_string_equal("request", Logger_Mdc_getEntries(current)[0].key);
+    assert_string_equal("EXPECTED_REQUEST", Logger_Mdc_getEntries(current)[0].value);
+    assert_string_equal("tenant", Logger_Mdc_getEntries(current)[1].key);
+    assert_string_equal("EXPECTED_TENANT", Logger_Mdc_get(current, "tenant"));
+    assert_null(Logger_Mdc_get(current, "trace"));
+
+    Logger_Mdc_pop();
+    current = Logger_Mdc_current();
+    assert_not_null(current);
+    assert_equal(1, Logger_Mdc_getSize(current));
+    assert_null(Logger_Mdc_get(current, "tenant"));
+    Logger_Mdc_pop();
+    assert_null(Logger_Mdc_current());
+}
+
+FeatureDefine(ReplaceKey) {
+    (void) traits_context;
+
+    char value[] = "EXPECTED_VALUE";
+    assert_equal(LOGGER_ERR_OK, Logger_Mdc_push("request", value));
+    assert_equal(LOGGER_ERR_OK, Logger_Mdc_push("tenant", "EXPECTED_TENANT"));
+    value[0] = 'X';  /* strings are copied on push */
+    assert_equal(LOGGER_ERR_OK, Logger_Mdc_push("request", "ANOTHER_VALUE"));
+
+    /* the key keeps its place, the innermost value wins */
+    Logger_Mdc_T current = Logger_Mdc_current();
+    assert_equal(2, Logger_Mdc_getSize(current));
+    assert_string_equal("request", Logger_Mdc_getEntries(current)[0].key);
+    assert_string_equal("ANOTHER_VALUE", Logger_Mdc_getEntries(current)[0].value);
+    Logger_Mdc_pop();
+    assert_string_equal("EXPECTED_VALUE", Logger_Mdc_get(Logger_Mdc_current(), "request"));
+    Logger_Mdc_clear();
+    assert_null(Logger_Mdc_current());
+}
+
+FeatureDefine(SnapshotOutlivesPop) {
+    (void) traits_context;
+
+    assert_equal(LOGGER_ERR_OK, Logger_Mdc_push("request", "EXPECTED_REQUEST"));
+    assert_equal(LOGGER_ERR_OK, Logger_Mdc_push("tenant", "EXPECTED_TENANT"));
+    Logger_Mdc_T snapshot = Logger_Mdc_retain(Logger_Mdc_current());
+    Logger_Mdc_clear();
+
+    assert_null(Logger_Mdc_current());
+    assert_string_equal("EXPECTED_REQUEST", Logger_Mdc_get(snapshot, "request"));
+    assert_string_equal("EXPECTED_TENANT", Logger_Mdc_get(snapshot, "tenant"));
+    Logger_Mdc_release(&snapshot);
+    assert_null(snapshot);
+}
+
+FeatureDefine(HandOverToThread) {
+    (void) traits_context;
+    pthread_t thread;
+    void *result = NULL;
+
+    assert_equal(LOGGER_ERR_OK, Logger_Mdc_push("request", "EXPECTED_REQUEST"));
+
+    /* contexts are per thread */
+    assert_equal(0, pthread_create(&thread, NULL, Helper_readRequest, NULL));
+    assert_equal(0, pthread_join(thread, &result));
+    assert_string_equal("", result);
+
+    /* unless a snapshot is handed over, the thread releases it on exit */
+    assert_equal(0, pthread_create(&thread, NULL, Helper_adoptSnapshot, Logger_Mdc_current()));
+    assert_equal(0, pthread_join(thread, &result));
+    assert_string_equal("EXPECTED_REQUEST", result);
+    assert_string_equal("EXPECTED_REQUEST", Logger_Mdc_get(Logger_Mdc_current(), "request"));
+    Logger_Mdc_clear();
+}
+
+FeatureDefine(ReadFromLaterDestructor) {
+    (void) traits_context;
+    pthread_t thread;
+
+    assert_equal(0, pthread_create(&thread, NULL, Helper_pushAndExit, NULL));
+    assert_equal(0, pthread_join(thread, NULL));
+    assert_true(gLaterSawNoContext);
+}
@@ -0,0 +1,406 @@
+/*
+ * C Source File
+ *
+ * Author: daddinuz
+ * email:  daddinuz@gmail.com
+ * Date:   October 19, 2026
+ */
+
+/*
+ * logger-decode: turn the output of the binary formatter back into text.
+ *
+ * Usage: logger-decode [-f simple|json|logfmt] [file...]
+ *
+ * All the given files (or stdin) are decoded as a single stream, applying frames in order: every
+ * epoch frame opens a new scope of definitions, so files appended to by several runs decode fine.
+ * Every file written by a file handler carries the definitions it uses, so a segment of a rotating
+ * file handler can also be decoded on its own.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include "logger.h"
+#include "logger_binary.h"
+#include "logger_builtin_formatters.h"
+
+typedef struct Input_T {
+    unsigned char *data;
+    size_t size;
+} Input_T;
+
+typedef struct Definitions_T {
+    char **strings;
+    size_t capacity;
+    time_t epoch;
+    uint64_t scope;
+    bool scoped;
+} Definitions_T;
+
+static const char *gProgramName = "logger-decode";
+
+static void die(const char *fmt, const char *arg) {
+    fprintf(stderr, "%s: ", gProgramName);
+    fprintf(stderr, fmt, arg);
+    fprintf(stderr, "\n");
+    exit(EXIT_FAILURE);
+}
+
+static void readStream(FILE *stream, const char *name, Input_T *input) {
+    unsigned char chunk[64 * 1024];
+    size_t read;
+    while ((read = fread(chunk, 1, sizeof(chunk), stream)) > 0) {
+        unsigned char *data = realloc(input->data, input->size + read);
+        if (!data) {
+            die("%s", Logger_Err_gerString(LOGGER_ERR_OUT_OF_MEMORY));
+        }
+        memcpy(data + input->size, chunk, read);
+        input->data = data;
+        input->size += read;
+    }
+    if (ferror(stream)) {
+        die("unable to read: %s", name);
+    }
+}
+
+static char *copyString(const unsigned char *data, size_t size) {
+    char *str = malloc(size + 1);
+    if (!str) {
+        die("%s", Logger_Err_gerString(LOGGER_ERR_OUT_OF_MEMORY));
+    }
+    memcpy(str, data, size);
+    str[size] = '\0';
+    return str;
+}
+
+/*
+ * Call visitor on each frame payload, return the number of trailing bytes that do not form a complete frame.
+ */
+static size_t forEachFrame(
+        const Input_T *input, void visitor(const unsigned char *payload, size_t size, void *arg), void *arg
+) {
+    size_t offset = 0;
+    while (offset < input->size) {
+        uint64_t size = 0;
+        const size_t read = Logger_Binary_decodeVarint(input->data + offset, input->size - offset, &size);
+        if (!read || size == 0 || size > input->size - offset - read) {
+            break;
+        }
+        visitor(input->data + offset + read, (size_t) size, arg);
+        offset += read + (size_t) size;
+    }
+    return input->size - offset;
+}
+
+static void clearDefinitions(Definitions_T *definitions) {
+    for (size_t i = 0; i < definitions->capacity; i++) {
+        free(definitions->strings[i]);
+        definitions->strings[i] = NULL;
+    }
+}
+
+/*
+ * Apply an epoch or definition frame, return false if the payload holds another frame type.
+ */
+static bool applyDefinition(Definitions_T *definitions, const unsigned char *payload, size_t size) {
+    size_t offset = 1;
+    switch (payload[0]) {
+        case LOGGER_BINARY_FRAME_EPOCH: {
+            int64_t epoch = 0;
+            uint64_t scope = 0;
+            const size_t read = Logger_Binary_decodeSignedVarint(payload + offset, size - offset, &epoch);
+            if (!read) {
+                die("%s", "malformed epoch frame");
+            }
+            offset += read;
+            const bool scoped = offset < size;
+            if (scoped && !Logger_Binary_decodeVarint(payload + offset, size - offset, &scope)) {
+                die("%s", "malformed epoch frame");
+            }
+            if (scoped && definitions->scoped && scope == definitions->scope) {
+                break;  /* a repeat, the scope goes on */
+            }
+            clearDefinitions(definitions);
+            definitions->epoch = (time_t) epoch;
+            definitions->scope = scope;
+            definitions->scoped = scoped;
+            break;
+        }
+        case LOGGER_BINARY_FRAME_DEFINITION: {
+            uint64_t id = 0;
+            const size_t read = Logger_Binary_decodeVarint(payload + offset, size - offset, &id);
+            if (!read || id > SIZE_MAX / 2 / sizeof(char *)) {
+                die("%s", "malformed definition frame");
+            }
+            offset += read;
+            if (id >= definitions->capacity) {
+                const size_t capacity = (size_t) id * 2 + 1;
+                char **strings = realloc(definitions->strings, capacity * sizeof(*strings));
+                if (!strings) {
+                    die("%s", Logger_Err_gerString(LOGGER_ERR_OUT_OF_MEMORY));
+                }
+                memset(strings + definitions->capacity, 0, (capacity - definitions->capacity) * sizeof(*strings));
+                definitions->strings = strings;
+                definitions->capacity = capacity;
+            }
+            free(definitions->strings[id]);
+            definitions->strings[id] = copyString(payload + offset, size - offset);
+            break;
+        }
+        default:
+            return false;
+    }
+    return true;
+}
+
+typedef struct Decoder_T {
+    Definitions_T definitions;
+    Logger_Formatter_T formatter;
+    size_t suppressed;
+    Logger_Field_T *fields;
+    size_t fieldsCount;
+} Decoder_T;
+
+static const char *lookup(const Definitions_T *definitions, uint64_t id) {
+    if (id >= definitions->capacity || !definitions->strings[id]) {
+        return "?";
+    }
+    return definitions->strings[id];
+}
+
+static void clearFields(Decoder_T *decoder) {
+    for (size_t i = 0; i < decoder->fieldsCount; i++) {
+        free((char *) decoder->fields[i].key);
+        if (LOGGER_FIELD_TYPE_STR == decoder->fields[i].type) {
+            free((char *) decoder->fields[i].value.asStr);
+        }
+    }
+    free(decoder->fields);
+    decoder->fields = NULL;
+    decoder->fieldsCount = 0;
+}
+
+/*
+ * Decode a length prefixed string at payload + *offset, advancing offset.
+ */
+static char *decodeString(const unsigned char *payload, size_t size, size_t *offset) {
+    uint64_t length = 0;
+    const size_t read = Logger_Binary_decodeVarint(payload + *offset, size - *offset, &length);
+    if (!read || length > size - *offset - read) {
+        die("%s", "malformed frame");
+    }
+    char *str = copyString(payload + *offset + read, (size_t) length);
+    *offset += read + (size_t) length;
+    return str;
+}
+
+static void decodeFields(Decoder_T *decoder, const unsigned char *payload, size_t size) {
+    uint64_t count = 0;
+    size_t offset = 1, read;
+
+    clearFields(decoder);
+    read = Logger_Binary_decodeVarint(payload + offset, size - offset, &count);
+    if (!read || count > size) {
+        die("%s", "malformed fields frame");
+    }
+    offset += read;
+    decoder->fields = calloc((size_t) count, sizeof(*decoder->fields));
+    if (count > 0 && !decoder->fields) {
+        die("%s", Logger_Err_gerString(LOGGER_ERR_OUT_OF_MEMORY));
+    }
+    for (; decoder->fieldsCount < count; decoder->fieldsCount++) {
+        Logger_Field_T *field = &decoder->fields[decoder->fieldsCount];
+        field->key = decodeString(payload, size, &offset);
+        if (offset >= size || payload[offset] > LOGGER_FIELD_TYPE_STR) {
+            die("%s", "malformed fields frame");
+        }
+        field->type = (Logger_Field_Type_T) payload[offset++];
+        switch (field->type) {
+            case LOGGER_FIELD_TYPE_INT: {
+                int64_t value = 0;
+                read = Logger_Binary_decodeSignedVarint(payload + offset, size - offset, &value);
+                field->value.asInt = (long long) value;
+                break;
+            }
+            case LOGGER_FIELD_TYPE_UINT: {
+                uint64_t value = 0;
+                read = Logger_Binary_decodeVarint(payload + offset, size - offset, &value);
+                field->value.asUint = (unsigned long long) value;
+                break;
+            }
+            case LOGGER_FIELD_TYPE_DOUBLE: {
+                uint64_t bits = 0;
+                read = size - offset >= 8 ? 8 : 0;
+                for (size_t i = 0; i < read; i++) {
+                    bits |= (uint64_t) payload[offset + i] << (8 * i);
+                }
+                memcpy(&field->value.asDouble, &bits, sizeof(bits));
+                break;
+            }
+            case LOGGER_FIELD_TYPE_BOOL:
+                read = size - offset >= 1 ? 1 : 0;
+                field->value.asBool = read && payload[offset];
+                break;
+            default:
+                field->value.asStr = decodeString(payload, size, &offset);
+                read = 0;
+                continue;
+        }
+        if (!read) {
+            die("%s", "malformed fields frame");
+        }
+        offset += read;
+    }
+}
+
+/*
+ * Rebuild the context of the next record as the context of this thread, so it can be attached to it.
+ */
+static void decodeMdc(const unsigned char *payload, size_t size) {
+    uint64_t count = 0;
+    size_t offset = 1;
+    const size_t read = Logger_Binary_decodeVarint(payload + offset, size - offset, &count);
+
+    if (!read || count > size) {
+        die("%s", "malformed context frame");
+    }
+    offset += read;
+    Logger_Mdc_clear();
+    for (uint64_t i = 0; i < count; i++) {
+        char *key = decodeString(payload, size, &offset);
+        char *value = decodeString(payload, size, &offset);
+        if (LOGGER_ERR_OK != Logger_Mdc_push(key, value)) {
+            die("%s", Logger_Err_gerString(LOGGER_ERR_OUT_OF_MEMORY));
+        }
+        free(key);
+        free(value);
+    }
+}
+
+static void decodeFrame(const unsigned char *payload, size_t size, void *arg) {
+    Decoder_T *decoder = arg;
+    uint64_t fields[6] = {0};
+    int64_t delta = 0;
+    size_t offset = 1, read;
+
+    if (applyDefinition(&decoder->definitions, payload, size)) {
+        return;
+    }
+    if (LOGGER_BINARY_FRAME_SUPPRESSED == payload[0]) {
+        uint64_t suppressed = 0;
+        if (!Logger_Binary_decodeVarint(payload + offset, size - offset, &suppressed)) {
+            die("%s", "malformed suppressed frame");
+        }
+        decoder->suppressed = (size_t) suppressed;
+        return;
+    }
+    if (LOGGER_BINARY_FRAME_FIELDS == payload[0]) {
+        decodeFields(decoder, payload, size);
+        return;
+    }
+    if (LOGGER_BINARY_FRAME_MDC == payload[0]) {
+        decodeMdc(payload, size);
+        return;
+    }
+    if (LOGGER_BINARY_FRAME_RECORD != payload[0]) {
+        return;
+    }
+    for (size_t i = 0; i < sizeof(fields) / sizeof(fields[0]); i++) {
+        read = 2 == i ?
+               Logger_Binary_decodeSignedVarint(payload + offset, size - offset, &delta) :
+               Logger_Binary_decodeVarint(payload + offset, size - offset, &fields[i]);
+        if (!read) {
+            die("%s", "malformed record frame");
+        }
+        offset += read;
+    }
+    if (fields[0] > LOGGER_LEVEL_FATAL) {
+        die("%s", "malformed record frame");
+    }
+
+    char *text = copyString(payload + offset, size - offset);
+    Logger_String_T message = Logger_String_new(text);
+    free(text);
+    if (!message) {
+        die("%s", Logger_Err_gerString(LOGGER_ERR_OUT_OF_MEMORY));
+    }
+    Logger_Record_T record = Logger_Record_new(
+            lookup(&decoder->definitions, fields[3]), (Logger_Level_T) fields[0], lookup(&decoder->definitions, fields[4]),
+            (size_t) fields[1], lookup(&decoder->definitions, fields[5]), decoder->definitions.epoch + (time_t) delta,
+            message
+    );
+    if (!record) {
+        die("%s", Logger_Err_gerString(LOGGER_ERR_OUT_OF_MEMORY));
+    }
+    Logger_Record_setSuppressed(record, decoder->suppressed);
+    Logger_Record_setFields(record, decoder->fields, decoder->fieldsCount);
+    Logger_Record_setMdc(record, Logger_Mdc_current());
+    decoder->suppressed = 0;
+
+    char *log = Logger_Formatter_formatRecord(decoder->formatter, record);
+    if (!log) {
+        die("%s", Logger_Err_gerString(LOGGER_ERR_OUT_OF_MEMORY));
+    }
+    fwrite(log, 1, Logger_Formatter_sizeFormattedRecord(decoder->formatter, log), stdout);
+    Logger_Formatter_deleteFormattedRecord(decoder->formatter, log);
+    Logger_Record_delete(&record);
+    Logger_String_delete(&message);
+    clearFields(decoder);
+    Logger_Mdc_clear();
+}
+
+int main(int argc, char *argv[]) {
+    Logger_Formatter_T formatter = NULL;
+    Input_T input = {.data=NULL, .size=0};
+    int i = 1;
+
+    if (argc > 0) {
+        gProgramName = argv[0];
+    }
+    if (i + 1 < argc && 0 == strcmp("-f", argv[i])) {
+        if (0 == strcmp("simple", argv[i + 1])) {
+            formatter = Logger_Formatter_newSimpleFormatter();
+        } else if (0 == strcmp("json", argv[i + 1])) {
+            formatter = Logger_Formatter_newJsonFormatter();
+        } else if (0 == strcmp("logfmt", argv[i + 1])) {
+            formatter = Logger_Formatter_newLogfmtFormatter();
+        } else {
+            die("unknown formatter: %s", argv[i + 1]);
+        }
+        i += 2;
+    } else {
+        formatter = Logger_Formatter_newSimpleFormatter();
+    }
+    if (!formatter) {
+        die("%s", Logger_Err_gerString(LOGGER_ERR_OUT_OF_MEMORY));
+    }
+
+    if (i >= argc) {
+        readStream(stdin, "stdin", &input);
+    }
+    for (; i < argc; i++) {
+        FILE *stream = fopen(argv[i], "rb");
+        if (!stream) {
+            die("unable to open: %s", argv[i]);
+        }
+        readStream(stream, argv[i], &input);
+        fclose(stream);
+    }
+
+    Decoder_T decoder = {
+            .definitions={.strings=NULL, .capacity=0, .epoch=0, .scope=0, .scoped=false},
+            .formatter=formatter, .suppressed=0, .fields=NULL, .fieldsCount=0
+    };
+    const size_t trailing = forEachFrame(&input, decodeFrame, &decoder);
+    if (trailing > 0) {
+        fprintf(stderr, "%s: ignoring %zu trailing bytes of a truncated frame\n", gProgramName, trailing);
+    }
+
+    clearFields(&decoder);
+    clearDefinitions(&decoder.definitions);
+    free(decoder.definitions.strings);
+    free(input.data);
+    Logger_Formatter_delete(&formatter);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,135 @@
+/*
+ * C Source File
+ *
+ * Author: daddinuz
+ * email:  daddinuz@gmail.com
+ * Date:   October 19, 2026
+ */
+
+/*
+ * logger-decompress: turn the output of the compressed file handler back into what the formatter wrote.
+ *
+ * Usage: logger-decompress [file...]
+ *
+ * The files (or stdin) are written to stdout one after the other. Corrupted blocks are skipped up to
+ * the next block header, a truncated last block is ignored.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include "logger_err.h"
+#include "logger_compress.h"
+
+typedef struct Input_T {
+    unsigned char *data;
+    size_t size;
+} Input_T;
+
+static const char *gProgramName = "logger-decompress";
+
+static void die(const char *fmt, const char *arg) {
+    fprintf(stderr, "%s: ", gProgramName);
+    fprintf(stderr, fmt, arg);
+    fprintf(stderr, "\n");
+    exit(EXIT_FAILURE);
+}
+
+static void readStream(FILE *stream, const char *name, Input_T *input) {
+    unsigned char chunk[64 * 1024];
+    size_t read;
+    input->size = 0;
+    while ((read = fread(chunk, 1, sizeof(chunk), stream)) > 0) {
+        unsigned char *data = realloc(input->data, input->size + read);
+        if (!data) {
+            die("%s", Logger_Err_gerString(LOGGER_ERR_OUT_OF_MEMORY));
+        }
+        memcpy(data + input->size, chunk, read);
+        input->data = data;
+        input->size += read;
+    }
+    if (ferror(stream)) {
+        die("unable to read: %s", name);
+    }
+}
+
+/*
+ * Find the next block header after offset, input->size if none.
+ */
+static size_t resync(const Input_T *input, size_t offset) {
+    for (offset++; offset + LOGGER_COMPRESS_HEADER_SIZE <= input->size; offset++) {
+        if (0 == memcmp(input->data + offset, LOGGER_COMPRESS_MAGIC, 4)) {
+            return offset;
+        }
+    }
+    return input->size;
+}
+
+static void decompress(const Input_T *input, const char *name) {
+    unsigned char *output = NULL;
+    size_t capacity = 0;
+    size_t offset = 0;
+
+    while (offset < input->size) {
+        Logger_Compress_Header_T header;
+        if (input->size - offset < LOGGER_COMPRESS_HEADER_SIZE) {
+            fprintf(stderr, "%s: %s: ignoring %zu trailing bytes\n", gProgramName, name, input->size - offset);
+            break;
+        }
+        if (!Logger_Compress_readHeader(input->data + offset, &header)) {
+            const size_t next = resync(input, offset);
+            fprintf(stderr, "%s: %s: skipping %zu corrupted bytes\n", gProgramName, name, next - offset);
+            offset = next;
+            continue;
+        }
+        const unsigned char *payload = input->data + offset + LOGGER_COMPRESS_HEADER_SIZE;
+        if (header.size > input->size - offset - LOGGER_COMPRESS_HEADER_SIZE) {
+            fprintf(stderr, "%s: %s: ignoring a truncated block\n", gProgramName, name);
+            break;
+        }
+        if (header.rawSize > capacity) {
+            free(output);
+            capacity = header.rawSize;
+            output = malloc(capacity);
+            if (!output) {
+                die("%s", Logger_Err_gerString(LOGGER_ERR_OUT_OF_MEMORY));
+            }
+        }
+        if (!Logger_Compress_decodeBlock(&header, payload, output)) {
+            const size_t next = resync(input, offset);
+            fprintf(stderr, "%s: %s: skipping %zu corrupted bytes\n", gProgramName, name, next - offset);
+            offset = next;
+            continue;
+        }
+        if (header.rawSize > 0 && fwrite(output, 1, header.rawSize, stdout) != header.rawSize) {
+            die("unable to write: %s", "stdout");
+        }
+        offset += LOGGER_COMPRESS_HEADER_SIZE + header.size;
+    }
+    free(output);
+}
+
+int main(int argc, char *argv[]) {
+    Input_T input = {.data=NULL, .size=0};
+
+    if (argc > 0) {
+        gProgramName = argv[0];
+    }
+    if (argc < 2) {
+        readStream(stdin, "stdin", &input);
+        decompress(&input, "stdin");
+    }
+    for (int i = 1; i < argc; i++) {
+        FILE *stream = fopen(argv[i], "rb");
+        if (!stream) {
+            die("unable to open: %s", argv[i]);
+        }
+        readStream(stream, argv[i], &input);
+        fclose(stream);
+        decompress(&input, argv[i]);
+    }
+
+    free(input.data);
+    return EXIT_SUCCESS;
+}